@@ -2,6 +2,11 @@
 #include "ecc/hamming_code.hpp"
 #include "ecc/reed_solomon.hpp"
 #include "ecc/bch_code.hpp"
+#include "ecc/gaussian_noise.hpp"
+#include "ecc/packed_codewords.hpp"
+#include "ecc/spsc_ring.hpp"
+#include "ecc/concatenated_code.hpp"
+#include "ecc/thread_pool.hpp"
 #include "../src/error_simulator.cpp"
 #include <iostream>
 #include <fstream>
@@ -11,6 +16,13 @@
 #include <chrono>
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <exception>
+#include <stdexcept>
+#include <bit>
+#include <sstream>
+#include <set>
+#include <atomic>
 #include <random>
 #include <concepts>
 #include <ranges>
@@ -59,10 +71,299 @@ namespace ecc::benchmark
         size_t iterations_per_point = 10000;
         size_t min_errors = 100;         // Minimum errors for statistical significance
         size_t max_iterations = 1000000; // Maximum iterations per SNR point
+        double target_relative_error = 0.0;  // Stop once CI half-width / estimate <= target (0 = off)
+        double confidence_level = 0.95;      // Level of the reported confidence intervals
+        bool importance_sampling = false;            // Draw errors at a biased rate and reweight per trial
+        double importance_flip_probability = 0.0;    // Biased raw bit-flip probability (0 = auto)
+        size_t trials_per_seed = 10000;              // Trials behind each record of a sharded sweep
+        bool pipelined = false;                      // Run each simulation stage on its own thread
+        size_t pipeline_batch_size = 256;            // Trials per batch handed between pipeline stages
+        size_t pipeline_depth = 8;                   // Batches in flight across the pipeline
         bool save_to_csv = true;
         std::string output_directory = "ber_results/";
     };
 
+    /// Two-sided confidence interval of an estimated rate
+    struct ConfidenceInterval
+    {
+        double low = 0.0;
+        double high = 0.0;
+    };
+
+    /// Standard normal quantile (bisection on erfc; only used a few times per point)
+    inline double normal_quantile(double p)
+    {
+        double low = -40.0, high = 40.0;
+        for (int i = 0; i < 200; ++i)
+        {
+            const double mid = 0.5 * (low + high);
+            if (0.5 * std::erfc(-mid / std::sqrt(2.0)) < p)
+                low = mid;
+            else
+                high = mid;
+        }
+        return 0.5 * (low + high);
+    }
+
+    /// Running mean and normal-approximation interval of per-trial weighted indicators
+    ///
+    /// Plain Monte Carlo adds 0/1 (or error fraction) per trial; importance sampling adds the same
+    /// scaled by the trial's likelihood ratio, and the interval follows from the sample variance.
+    class RateEstimator
+    {
+    private:
+        double sum = 0.0;
+        double sum_squares = 0.0;
+        size_t trials = 0;
+        size_t events = 0;
+
+    public:
+        RateEstimator() = default;
+
+        RateEstimator(double sum, double sum_squares, size_t trials, size_t events) noexcept
+            : sum(sum), sum_squares(sum_squares), trials(trials), events(events) {}
+
+        void add(double value) noexcept
+        {
+            sum += value;
+            sum_squares += value * value;
+            ++trials;
+            events += value > 0.0;
+        }
+
+        /// Combine with an estimator over disjoint trials
+        void merge(const RateEstimator &other) noexcept
+        {
+            sum += other.sum;
+            sum_squares += other.sum_squares;
+            trials += other.trials;
+            events += other.events;
+        }
+
+        [[nodiscard]] double get_sum() const noexcept { return sum; }
+        [[nodiscard]] double get_sum_squares() const noexcept { return sum_squares; }
+        [[nodiscard]] size_t get_trials() const noexcept { return trials; }
+        [[nodiscard]] size_t get_events() const noexcept { return events; }
+        [[nodiscard]] double mean() const noexcept { return trials ? sum / trials : 0.0; }
+
+        [[nodiscard]] double half_width(double z) const noexcept
+        {
+            if (trials < 2)
+            {
+                return std::numeric_limits<double>::infinity();
+            }
+            const double m = mean();
+            const double variance = std::max(0.0, (sum_squares - trials * m * m) / (trials - 1));
+            return z * std::sqrt(variance / trials);
+        }
+
+        /// With no events yet, the upper end is the exact zero-event bound -ln(1 - confidence) / trials
+        [[nodiscard]] ConfidenceInterval interval(double confidence) const
+        {
+            if (events == 0)
+            {
+                return {0.0, trials ? -std::log(1.0 - confidence) / trials : 1.0};
+            }
+            const double hw = half_width(normal_quantile(0.5 + 0.5 * confidence));
+            return {std::max(0.0, mean() - hw), mean() + hw};
+        }
+
+        /// True once an event was seen and the interval half-width is within `target` of the mean
+        [[nodiscard]] bool converged(double target, double z) const noexcept
+        {
+            return events > 0 && half_width(z) <= target * mean();
+        }
+    };
+
+    /// One unit of a sharded sweep: seeds [first_seed, first_seed + seed_count) of one (code, SNR) point
+    struct SweepShard
+    {
+        std::string code_name;
+        double snr_db = 0.0;
+        uint64_t first_seed = 0;
+        uint64_t seed_count = 0;
+    };
+
+    /// Little-endian writer of the fixed-size shard file blocks
+    template <size_t size>
+    struct ByteWriter
+    {
+        std::array<char, size> bytes{};
+        size_t offset = 0;
+
+        void put(uint64_t value, size_t width) noexcept
+        {
+            for (size_t b = 0; b < width; ++b)
+            {
+                bytes[offset++] = static_cast<char>((value >> (8 * b)) & 0xFF);
+            }
+        }
+    };
+
+    /// Little-endian reader matching ByteWriter
+    template <size_t size>
+    struct ByteReader
+    {
+        const std::array<char, size> &bytes;
+        size_t offset = 0;
+
+        uint64_t get(size_t width) noexcept
+        {
+            uint64_t value = 0;
+            for (size_t b = 0; b < width; ++b)
+            {
+                value |= static_cast<uint64_t>(static_cast<uint8_t>(bytes[offset++])) << (8 * b);
+            }
+            return value;
+        }
+    };
+
+    /// Configuration a shard file was written under, stored as a fixed 128-byte header before its records
+    ///
+    /// Records only combine with records of the same code, trial count per seed and sampling scheme, so
+    /// resume and merge reject a file whose header differs from the running configuration. The header
+    /// version changes with the record layout.
+    struct ShardHeader
+    {
+        static constexpr uint32_t magic = 0x48434345; // "ECCH"
+        static constexpr uint32_t version = 2;
+        static constexpr size_t size = 128;
+        static constexpr size_t max_name_length = size - 48;
+
+        std::string code_name;
+        uint64_t trials_per_seed = 0;
+        bool importance_sampling = false;
+        double importance_flip_probability = 0.0; // Biased flip rate q actually drawn (0 without IS)
+        double confidence_level = 0.0;
+
+        bool operator==(const ShardHeader &) const = default;
+
+        [[nodiscard]] std::array<char, size> encode() const
+        {
+            if (code_name.size() > max_name_length)
+            {
+                throw std::invalid_argument("Code name too long for a shard header: " + code_name);
+            }
+
+            ByteWriter<size> out;
+            out.put(magic, 4);
+            out.put(version, 4);
+            out.put(trials_per_seed, 8);
+            out.put(importance_sampling, 8);
+            out.put(std::bit_cast<uint64_t>(importance_flip_probability), 8);
+            out.put(std::bit_cast<uint64_t>(confidence_level), 8);
+            out.put(code_name.size(), 8);
+            std::copy(code_name.begin(), code_name.end(), out.bytes.begin() + out.offset);
+            return out.bytes;
+        }
+
+        /// False if the bytes do not hold a header of this version
+        [[nodiscard]] static bool decode(const std::array<char, size> &bytes, ShardHeader &header)
+        {
+            ByteReader<size> in{bytes};
+            if (in.get(4) != magic || in.get(4) != version)
+            {
+                return false;
+            }
+            header.trials_per_seed = in.get(8);
+            header.importance_sampling = in.get(8) != 0;
+            header.importance_flip_probability = std::bit_cast<double>(in.get(8));
+            header.confidence_level = std::bit_cast<double>(in.get(8));
+            const uint64_t name_length = in.get(8);
+            if (name_length > max_name_length)
+            {
+                return false;
+            }
+            header.code_name.assign(bytes.begin() + in.offset, bytes.begin() + in.offset + name_length);
+            return true;
+        }
+    };
+
+    /// Partial counts of one seed of a shard, stored as a fixed 112-byte little-endian record
+    struct ShardRecord
+    {
+        static constexpr uint32_t magic = 0x53434345; // "ECCS"
+        static constexpr uint32_t version = 3;
+        static constexpr size_t size = 112;
+
+        double snr_db = 0.0;
+        uint64_t seed = 0;
+        uint64_t trials = 0;
+        uint64_t bit_errors = 0;
+        double weighted_bit_errors = 0.0;
+        uint64_t block_errors = 0;
+        double ber_sum = 0.0;
+        double ber_sum_squares = 0.0;
+        uint64_t ber_events = 0;
+        double bler_sum = 0.0;
+        double bler_sum_squares = 0.0;
+        uint64_t bler_events = 0;
+        double elapsed_seconds = 0.0; // Wall time of the seed's trials, for the merged throughput
+
+        bool operator==(const ShardRecord &) const = default;
+
+        [[nodiscard]] std::array<char, size> encode() const noexcept
+        {
+            ByteWriter<size> out;
+            out.put(magic, 4);
+            out.put(version, 4);
+            out.put(std::bit_cast<uint64_t>(snr_db), 8);
+            out.put(seed, 8);
+            out.put(trials, 8);
+            out.put(bit_errors, 8);
+            out.put(std::bit_cast<uint64_t>(weighted_bit_errors), 8);
+            out.put(block_errors, 8);
+            out.put(std::bit_cast<uint64_t>(ber_sum), 8);
+            out.put(std::bit_cast<uint64_t>(ber_sum_squares), 8);
+            out.put(ber_events, 8);
+            out.put(std::bit_cast<uint64_t>(bler_sum), 8);
+            out.put(std::bit_cast<uint64_t>(bler_sum_squares), 8);
+            out.put(bler_events, 8);
+            out.put(std::bit_cast<uint64_t>(elapsed_seconds), 8);
+            return out.bytes;
+        }
+
+        /// False if the bytes do not hold a record of this version
+        [[nodiscard]] static bool decode(const std::array<char, size> &bytes, ShardRecord &record) noexcept
+        {
+            ByteReader<size> in{bytes};
+            if (in.get(4) != magic || in.get(4) != version)
+            {
+                return false;
+            }
+            record.snr_db = std::bit_cast<double>(in.get(8));
+            record.seed = in.get(8);
+            record.trials = in.get(8);
+            record.bit_errors = in.get(8);
+            record.weighted_bit_errors = std::bit_cast<double>(in.get(8));
+            record.block_errors = in.get(8);
+            record.ber_sum = std::bit_cast<double>(in.get(8));
+            record.ber_sum_squares = std::bit_cast<double>(in.get(8));
+            record.ber_events = in.get(8);
+            record.bler_sum = std::bit_cast<double>(in.get(8));
+            record.bler_sum_squares = std::bit_cast<double>(in.get(8));
+            record.bler_events = in.get(8);
+            record.elapsed_seconds = std::bit_cast<double>(in.get(8));
+            return true;
+        }
+    };
+
+    /// Time split of one stage of a pipelined SNR point
+    struct StageOccupancy
+    {
+        std::string stage;
+        size_t batches = 0;
+        double busy_ms = 0.0;    // Working on batches
+        double waiting_ms = 0.0; // Starved for input or blocked on a full output ring
+
+        /// Fraction of the stage's time spent working; the highest one marks the bottleneck
+        [[nodiscard]] double occupancy() const noexcept
+        {
+            const double total = busy_ms + waiting_ms;
+            return total > 0.0 ? busy_ms / total : 0.0;
+        }
+    };
+
     /// BER Analysis Results
     struct BERResults
     {
@@ -70,8 +371,11 @@ namespace ecc::benchmark
         std::vector<double> ber_values;
         std::vector<double> bler_values;
         std::vector<double> throughput_values;
-        std::vector<size_t> error_counts;
+        std::vector<size_t> error_counts;  // Bit errors drawn (at the biased rate under importance sampling)
+        std::vector<double> error_mass;    // Likelihood-weighted bit errors behind the BER estimate
         std::vector<size_t> block_counts;
+        std::vector<ConfidenceInterval> ber_intervals;
+        std::vector<ConfidenceInterval> bler_intervals;
         std::string code_name;
     };
 
@@ -109,6 +413,11 @@ namespace ecc::benchmark
             std::cout << "Analyzing Reed-Solomon Codes...\n";
             // all_results.push_back(analyze_reed_solomon());
 
+            // Concatenated codes: RS(255,223) outer, depth-4 interleaver, binary inner code
+            std::cout << "Analyzing Concatenated Codes...\n";
+            all_results.push_back(analyze_rs_bch_concatenated());
+            all_results.push_back(analyze_rs_ldpc_concatenated());
+
             // Generate comparison report
             generate_comparison_report(all_results);
 
@@ -163,22 +472,235 @@ namespace ecc::benchmark
             print_channel_comparison(channel_results);
         }
 
-    private:
-        /// Analyze Hamming(7,4) code
-        BERResults analyze_hamming_7_4()
+        /// BER, BLER (per frame) and end-to-end throughput of a concatenated code on hard-decision AWGN
+        ///
+        /// Each SNR point sends random frames until min_errors message bit errors were seen or
+        /// `max_frames` frames ran. Frames go out in batches: encode_frames, the channel, then
+        /// decode_frames with the inner and outer decoders overlapping. Throughput counts message bits
+        /// over the encode plus decode time, so it measures the whole codec chain.
+        template <typename Concatenated>
+        BERResults analyze_concatenated(const Concatenated &code, const std::string &code_name, size_t max_frames = 256)
         {
-            using Hamming74 = HammingCode<7, 4>;
-            return analyze_code<Hamming74>("Hamming(7,4)");
+            std::cout << "Analyzing " << code_name << " (rate " << std::fixed << std::setprecision(3)
+                      << code.get_code_rate() << ")...\n";
+
+            BERResults results;
+            results.code_name = code_name;
+
+            constexpr size_t batch_frames = 16;
+            const size_t message_bits = 8 * code.message_bytes();
+            std::vector<uint8_t> messages(batch_frames * code.message_bytes());
+            std::vector<uint8_t> channel(batch_frames * code.channel_bits());
+            std::vector<uint8_t> decoded(messages.size());
+
+            for (double snr_db = config_.snr_min_db;
+                 snr_db <= config_.snr_max_db;
+                 snr_db += config_.snr_step_db)
+            {
+                std::cout << "  SNR: " << std::fixed << std::setprecision(1)
+                          << snr_db << " dB... " << std::flush;
+
+                const auto point_seed = static_cast<uint64_t>(std::llround(snr_db * 1000)); // Unique seed per SNR
+                Xoshiro256 data_rng(point_seed, 0);
+                GaussianNoise noise(point_seed, 1);
+                const float sigma = GaussianNoise::sigma_from_snr_db(snr_db);
+
+                TrialCounts counts;
+                ConcatenatedDecodeResult layers;
+                double codec_seconds = 0.0;
+
+                while (counts.trials < max_frames && counts.bit_errors < config_.min_errors)
+                {
+                    const size_t frames = std::min(batch_frames, max_frames - counts.trials);
+                    const std::span<uint8_t> batch_messages(messages.data(), frames * code.message_bytes());
+                    const std::span<uint8_t> batch_channel(channel.data(), frames * code.channel_bits());
+                    const std::span<uint8_t> batch_decoded(decoded.data(), batch_messages.size());
+                    for (auto &byte : batch_messages)
+                    {
+                        byte = static_cast<uint8_t>(data_rng());
+                    }
+
+                    auto encode_start = std::chrono::high_resolution_clock::now();
+                    code.encode_frames(batch_messages, batch_channel);
+                    auto encode_end = std::chrono::high_resolution_clock::now();
+
+                    noise.bpsk_hard_decision(batch_channel, sigma);
+
+                    auto decode_start = std::chrono::high_resolution_clock::now();
+                    layers.merge(code.decode_frames(batch_channel, batch_decoded));
+                    auto decode_end = std::chrono::high_resolution_clock::now();
+
+                    codec_seconds += std::chrono::duration<double>(encode_end - encode_start).count() +
+                                     std::chrono::duration<double>(decode_end - decode_start).count();
+
+                    for (size_t f = 0; f < frames; ++f)
+                    {
+                        size_t bit_errors = 0;
+                        for (size_t i = f * code.message_bytes(); i < (f + 1) * code.message_bytes(); ++i)
+                        {
+                            bit_errors += std::popcount(static_cast<unsigned>(batch_messages[i] ^ batch_decoded[i]));
+                        }
+                        count_trial(counts, message_bits, bit_errors, bit_errors > 0, 1.0);
+                    }
+                }
+
+                const double ber = counts.ber.mean();
+                const auto ber_interval = counts.ber.interval(config_.confidence_level);
+                results.snr_db_values.push_back(snr_db);
+                results.ber_values.push_back(ber);
+                results.bler_values.push_back(counts.bler.mean());
+                results.throughput_values.push_back(counts.trials * message_bits / (codec_seconds * 1e6));
+                results.error_counts.push_back(counts.bit_errors);
+                results.error_mass.push_back(counts.weighted_bit_errors);
+                results.block_counts.push_back(counts.trials);
+                results.ber_intervals.push_back(ber_interval);
+                results.bler_intervals.push_back(counts.bler.interval(config_.confidence_level));
+
+                std::cout << "BER: " << std::scientific << std::setprecision(2) << ber << " ["
+                          << ber_interval.low << ", " << ber_interval.high << "], BLER: " << counts.bler.mean()
+                          << ", inner failures: " << layers.inner_failures << "/" << layers.inner_blocks
+                          << ", erasures: " << layers.erased_symbols << ", " << std::fixed << std::setprecision(1)
+                          << results.throughput_values.back() << " Mbps\n";
+            }
+
+            return results;
         }
 
-        /// Analyze Hamming(15,11) code
-        BERResults analyze_hamming_15_11()
+        /// Split the configured SNR range of `code_name` into shards of `seeds_per_shard` seeds each
+        std::vector<SweepShard> plan_sweep(const std::string &code_name, size_t seeds_per_point,
+                                           size_t seeds_per_shard) const
         {
-            using Hamming1511 = HammingCode<15, 11>;
-            return analyze_code<Hamming1511>("Hamming(15,11)");
+            if (seeds_per_shard == 0)
+            {
+                throw std::invalid_argument("Shards need at least one seed");
+            }
+
+            std::vector<SweepShard> shards;
+            for (double snr_db = config_.snr_min_db; snr_db <= config_.snr_max_db; snr_db += config_.snr_step_db)
+            {
+                for (size_t first = 0; first < seeds_per_point; first += seeds_per_shard)
+                {
+                    shards.push_back({code_name, snr_db, first, std::min(seeds_per_shard, seeds_per_point - first)});
+                }
+            }
+            return shards;
+        }
+
+        /// Run `shards` on the calling thread, appending one record per finished seed to each shard file
+        ///
+        /// Every seed replays a fixed trial sequence, so shards can run on any thread or machine and in any
+        /// order. With `resume`, seeds already recorded in a shard file are skipped.
+        template <typename CodeType>
+            requires CodecType<CodeType>
+        void run_sweep_shards(const std::vector<SweepShard> &shards, bool resume = true)
+        {
+            create_output_directory();
+            for (const auto &shard : shards)
+            {
+                run_shard<CodeType>(shard, resume);
+            }
         }
 
-        /// Generic code analysis template
+        /// Run `shards` as tasks on `pool`, one per shard, each on its own shard file
+        template <typename CodeType>
+            requires CodecType<CodeType>
+        void run_sweep_shards(const std::vector<SweepShard> &shards, WorkStealingPool &pool, bool resume = true)
+        {
+            create_output_directory();
+
+            // A failed shard stops the ones not yet started; wait() rethrows the first failure
+            std::atomic<bool> failed{false};
+            TaskGroup group(pool);
+            for (const auto &shard : shards)
+            {
+                group.run([this, &shard, &failed, resume]
+                          {
+                              if (failed.load(std::memory_order_relaxed))
+                                  return;
+                              try
+                              {
+                                  run_shard<CodeType>(shard, resume);
+                              }
+                              catch (...)
+                              {
+                                  failed.store(true, std::memory_order_relaxed);
+                                  throw;
+                              }
+                          });
+            }
+            group.wait();
+        }
+
+        /// Combine every shard file of `code_name` in the output directory into BER/BLER curves (and CSV)
+        ///
+        /// Records are keyed by (SNR, seed): a seed recorded twice counts once, and summation runs in
+        /// (SNR, seed) order so the curves do not depend on how the sweep was sharded. Throws if a shard
+        /// file was written under a different configuration (see ShardHeader).
+        template <typename CodeType>
+            requires CodecType<CodeType>
+        BERResults merge_sweep_shards(const std::string &code_name)
+        {
+            const ShardHeader header = shard_header<CodeType>(code_name);
+            const std::string prefix = file_stem(code_name) + "_snr";
+            std::map<std::pair<long long, uint64_t>, ShardRecord> records;
+
+            if (std::filesystem::is_directory(config_.output_directory))
+            {
+                for (const auto &entry : std::filesystem::directory_iterator(config_.output_directory))
+                {
+                    const std::string name = entry.path().filename().string();
+                    if (name.rfind(prefix, 0) != 0 || entry.path().extension() != ".part")
+                    {
+                        continue;
+                    }
+                    for (const auto &record : read_shard_records(entry.path(), header))
+                    {
+                        records.emplace(std::make_pair(std::llround(record.snr_db * 1000), record.seed), record);
+                    }
+                }
+            }
+
+            BERResults results;
+            results.code_name = code_name;
+
+            for (auto it = records.begin(); it != records.end();)
+            {
+                const long long snr_key = it->first.first;
+                const double snr_db = it->second.snr_db;
+                TrialCounts counts;
+                double elapsed_seconds = 0.0;
+                for (; it != records.end() && it->first.first == snr_key; ++it)
+                {
+                    const auto &record = it->second;
+                    elapsed_seconds += record.elapsed_seconds;
+                    TrialCounts part;
+                    part.trials = record.trials;
+                    part.bit_errors = record.bit_errors;
+                    part.weighted_bit_errors = record.weighted_bit_errors;
+                    part.block_errors = record.block_errors;
+                    part.ber = RateEstimator(record.ber_sum, record.ber_sum_squares, record.trials, record.ber_events);
+                    part.bler = RateEstimator(record.bler_sum, record.bler_sum_squares, record.trials, record.bler_events);
+                    counts.merge(part);
+                }
+
+                results.snr_db_values.push_back(snr_db);
+                results.ber_values.push_back(counts.ber.mean());
+                results.bler_values.push_back(counts.bler.mean());
+                results.throughput_values.push_back(elapsed_seconds > 0.0
+                                                        ? counts.trials * CodeType::data_length / (elapsed_seconds * 1e6)
+                                                        : 0.0);
+                results.error_counts.push_back(counts.bit_errors);
+                results.error_mass.push_back(counts.weighted_bit_errors);
+                results.block_counts.push_back(counts.trials);
+                results.ber_intervals.push_back(counts.ber.interval(config_.confidence_level));
+                results.bler_intervals.push_back(counts.bler.interval(config_.confidence_level));
+            }
+
+            save_ber_results(results);
+            return results;
+        }
+
+        /// BER/BLER curve of `CodeType` over the configured SNR range
         template <typename CodeType>
             requires CodecType<CodeType>
         BERResults analyze_code(const std::string &code_name)
@@ -197,127 +719,510 @@ namespace ecc::benchmark
                 std::cout << "  SNR: " << std::fixed << std::setprecision(1)
                           << snr_db << " dB... " << std::flush;
 
-                auto metrics = analyze_snr_point<CodeType>(snr_db);
+                auto point = analyze_snr_point<CodeType>(snr_db);
+                const auto &metrics = point.metrics;
 
                 results.snr_db_values.push_back(snr_db);
                 results.ber_values.push_back(metrics.bit_error_rate);
                 results.bler_values.push_back(metrics.block_error_rate);
                 results.throughput_values.push_back(metrics.throughput_mbps);
-                results.error_counts.push_back(metrics.error_bits);
+                results.error_counts.push_back(point.sampled_bit_errors);
+                results.error_mass.push_back(point.error_mass);
                 results.block_counts.push_back(metrics.total_blocks);
+                results.ber_intervals.push_back(point.ber_interval);
+                results.bler_intervals.push_back(point.bler_interval);
 
                 std::cout << "BER: " << std::scientific << std::setprecision(2)
-                          << metrics.bit_error_rate << "\n";
+                          << metrics.bit_error_rate << " [" << point.ber_interval.low << ", "
+                          << point.ber_interval.high << "], BLER: " << metrics.block_error_rate << "\n";
+
+                if (!point.stages.empty())
+                {
+                    print_stage_occupancy(point.stages);
+                }
             }
 
             return results;
         }
 
-        /// Analyze single SNR point
-        template <typename CodeType>
-            requires CodecType<CodeType>
-        PerformanceMetrics analyze_snr_point(double snr_db)
+    private:
+        /// Analyze Hamming(7,4) code
+        BERResults analyze_hamming_7_4()
         {
-            CodeType code;
-            PerformanceMetrics metrics{};
-
-            // Configure AWGN channel
-            ErrorParameters params;
-            params.type = ErrorType::RANDOM;
-            params.probability = snr_db;                      // SNR in dB
-            params.seed = static_cast<size_t>(snr_db * 1000); // Unique seed per SNR
+            using Hamming74 = HammingCode<7, 4>;
+            return analyze_code<Hamming74>("Hamming(7,4)");
+        }
 
-            simulator_.create_channel(ErrorType::RANDOM, params);
+        /// Analyze Hamming(15,11) code
+        BERResults analyze_hamming_15_11()
+        {
+            using Hamming1511 = HammingCode<15, 11>;
+            return analyze_code<Hamming1511>("Hamming(15,11)");
+        }
 
-            size_t iterations = 0;
-            size_t total_errors = 0;
-            size_t block_errors = 0;
+        /// Analyze RS(255,223) outer over BCH(63,51) inner, interleaved 4 deep
+        BERResults analyze_rs_bch_concatenated()
+        {
+            using Inner = BCHInnerCode<BCHCode<6, 2>>;
+            const ConcatenatedCode<ReedSolomonCode<255, 223>, Inner> code(Inner{}, 4);
+            return analyze_concatenated(code, "RS(255,223)+BCH(63,51)");
+        }
 
-            auto start_time = std::chrono::high_resolution_clock::now();
+        /// Analyze RS(255,223) outer over the rate-1/2 802.11n LDPC (648,324) inner, interleaved 4 deep
+        BERResults analyze_rs_ldpc_concatenated()
+        {
+            const LDPCInnerCode<> inner(LDPCCode(QCBaseGraph::ieee80211n_rate_half(), 27));
+            const ConcatenatedCode<ReedSolomonCode<255, 223>, LDPCInnerCode<>> code(inner, 4);
+            return analyze_concatenated(code, "RS(255,223)+LDPC(648,324)");
+        }
 
-            // Run until we have enough statistics or hit max iterations
-            while ((total_errors < config_.min_errors && iterations < config_.max_iterations) ||
-                   iterations < config_.iterations_per_point)
+        /// Result of one SNR point with its confidence intervals
+        struct SNRPointResult
+        {
+            PerformanceMetrics metrics{}; // error_bits is the weighted error mass, rounded
+            size_t sampled_bit_errors = 0;
+            double error_mass = 0.0;
+            ConfidenceInterval ber_interval;
+            ConfidenceInterval bler_interval;
+            std::vector<StageOccupancy> stages; // Pipelined mode only
+        };
+
+        /// Channel of one SNR point plus the random streams of one trial sequence
+        ///
+        /// Hard-decision AWGN is a BSC with p = Q(1/sigma). With importance sampling the flips are drawn
+        /// at a larger q and a trial with e flips is weighted by (p/q)^e ((1-p)/(1-q))^(n-e), which keeps
+        /// the estimates unbiased. Streams 3s..3s+2 of `seed` feed data, noise and biased flips, so a
+        /// (seed, stream) pair always replays the same trials.
+        struct TrialChannel
+        {
+            double sigma;
+            double flip_probability;
+            double biased_probability;
+            bool importance_sampling;
+            Xoshiro256 data_rng;
+            GaussianNoise noise;
+            Xoshiro256 bias_rng;
+            GeometricSkipSampler biased_flips;
+            PackedCodewords buffer; // One codeword
+
+            TrialChannel(double snr_db, size_t code_length, double biased, bool importance,
+                         uint64_t seed, uint64_t stream)
+                : sigma(GaussianNoise::sigma_from_snr_db(snr_db)),
+                  flip_probability(0.5 * std::erfc(1.0 / (sigma * std::sqrt(2.0)))),
+                  biased_probability(importance ? std::max(flip_probability, biased) : flip_probability),
+                  importance_sampling(importance),
+                  data_rng(seed, 3 * stream),
+                  noise(seed, 3 * stream + 1),
+                  bias_rng(seed, 3 * stream + 2),
+                  biased_flips(biased_probability),
+                  buffer(code_length, 1)
             {
-                // Generate random data
-                typename CodeType::DataWord data;
-                generate_random_data(data);
-
-                // Encode
-                auto encode_start = std::chrono::high_resolution_clock::now();
-                auto codeword = code.encode(data);
-                auto encode_end = std::chrono::high_resolution_clock::now();
+            }
 
-                // Convert to vector for error simulation
-                std::vector<uint8_t> codeword_vec(CodeType::code_length);
-                for (size_t i = 0; i < CodeType::code_length; ++i)
+            /// Corrupt `buffer`; returns the trial's likelihood ratio (1 without importance sampling)
+            double corrupt()
+            {
+                if (!importance_sampling)
                 {
-                    codeword_vec[i] = codeword[i] ? 1 : 0;
+                    noise.bpsk_hard_decision(buffer.words(), buffer.codeword_length(), static_cast<float>(sigma));
+                    return 1.0;
                 }
 
-                // Add channel errors
-                auto received_vec = add_awgn_errors(codeword_vec, snr_db);
+                const size_t length = buffer.codeword_length();
+                size_t errors = 0;
+                biased_flips.for_each_event(length, bias_rng, [&](size_t i)
+                                            {
+                                                buffer.flip(0, i);
+                                                ++errors;
+                                            });
 
-                // Convert back to bitset
-                typename CodeType::CodeWord received;
-                for (size_t i = 0; i < CodeType::code_length; ++i)
+                if (flip_probability == biased_probability)
                 {
-                    received[i] = received_vec[i];
+                    return 1.0;
                 }
+                return std::exp(errors * std::log(flip_probability / biased_probability) +
+                                (length - errors) * (std::log1p(-flip_probability) - std::log1p(-biased_probability)));
+            }
+        };
+
+        /// Raw counts of a run of trials
+        struct TrialCounts
+        {
+            size_t trials = 0;
+            size_t bit_errors = 0;            // As drawn, which under importance sampling is the biased channel
+            double weighted_bit_errors = 0.0; // Sum of weight * bit errors (equal to bit_errors without IS)
+            size_t block_errors = 0;
+            RateEstimator ber;
+            RateEstimator bler;
+
+            void merge(const TrialCounts &other) noexcept
+            {
+                trials += other.trials;
+                bit_errors += other.bit_errors;
+                weighted_bit_errors += other.weighted_bit_errors;
+                block_errors += other.block_errors;
+                ber.merge(other.ber);
+                bler.merge(other.bler);
+            }
+        };
+
+        /// Next random data word of the channel's data stream
+        template <typename CodeType>
+        static void random_data_word(TrialChannel &channel, typename CodeType::DataWord &data)
+        {
+            std::uniform_int_distribution<int> bit_dist(0, 1);
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                data[i] = bit_dist(channel.data_rng);
+            }
+        }
+
+        /// Add channel errors to `codeword` on the packed words; returns the trial's likelihood ratio
+        template <typename CodeType>
+        static double transmit(TrialChannel &channel, const typename CodeType::CodeWord &codeword,
+                               typename CodeType::CodeWord &received)
+        {
+            channel.buffer.store(0, codeword);
+            const double weight = channel.corrupt();
+            received = channel.buffer.template load<CodeType::code_length>(0);
+            return weight;
+        }
+
+        /// Count one finished trial
+        static void count_trial(TrialCounts &counts, size_t code_length, size_t bit_errors, bool is_block_error,
+                                double weight) noexcept
+        {
+            counts.trials++;
+            counts.bit_errors += bit_errors;
+            counts.weighted_bit_errors += weight * bit_errors;
+            counts.block_errors += is_block_error;
+            counts.ber.add(weight * bit_errors / code_length);
+            counts.bler.add(is_block_error ? weight : 0.0);
+        }
+
+        /// Encode, corrupt and decode one random data word, accumulating into `counts` (and `timing`)
+        template <typename CodeType>
+        static void run_trial(const CodeType &code, TrialChannel &channel, TrialCounts &counts,
+                              PerformanceMetrics *timing = nullptr)
+        {
+            // Generate random data
+            typename CodeType::DataWord data;
+            random_data_word<CodeType>(channel, data);
+
+            // Encode
+            auto encode_start = std::chrono::high_resolution_clock::now();
+            auto codeword = code.encode(data);
+            auto encode_end = std::chrono::high_resolution_clock::now();
+
+            // Add channel errors, counting bit errors before correction
+            typename CodeType::CodeWord received;
+            const double weight = transmit<CodeType>(channel, codeword, received);
+            const size_t bit_errors = (codeword ^ received).count();
 
-                // Count bit errors before correction
-                size_t bit_errors = 0;
-                for (size_t i = 0; i < CodeType::code_length; ++i)
+            // Decode
+            auto decode_start = std::chrono::high_resolution_clock::now();
+            auto decoded = code.decode(received);
+            auto decode_end = std::chrono::high_resolution_clock::now();
+
+            // Check if block error occurred
+            count_trial(counts, CodeType::code_length, bit_errors, data != decoded, weight);
+
+            if (timing)
+            {
+                timing->encoding_time_ms += std::chrono::duration<double, std::milli>(
+                                                encode_end - encode_start)
+                                                .count();
+                timing->decoding_time_ms += std::chrono::duration<double, std::milli>(
+                                                decode_end - decode_start)
+                                                .count();
+            }
+        }
+
+        /// Trials of one pipeline batch, carried through every stage and then recycled
+        template <typename CodeType>
+        struct PipelineBatch
+        {
+            size_t count = 0; // Trials in use; a batch with none ends the stream
+            std::vector<typename CodeType::DataWord> data;
+            std::vector<typename CodeType::CodeWord> codewords;
+            std::vector<typename CodeType::CodeWord> received;
+            std::vector<typename CodeType::DataWord> decoded;
+            std::vector<double> weights;
+            std::vector<size_t> bit_errors;
+
+            explicit PipelineBatch(size_t trials)
+                : data(trials), codewords(trials), received(trials), decoded(trials), weights(trials),
+                  bit_errors(trials)
+            {
+            }
+        };
+
+        /// Run trials through source, encoder, channel, decoder and sink stages on five threads
+        ///
+        /// Stages hand batches on through SPSC rings, and the sink returns each batch to the source on
+        /// a free ring, so no buffer is allocated after start-up. Data and noise come from the same
+        /// streams in the same order as the serial loop, and the sink stops counting at the trial where
+        /// `done` first holds, so the counts match a serial run exactly; batches already in flight are
+        /// drained uncounted. Returns each stage's busy and waiting time (the encoder and decoder busy
+        /// times also go into `timing`).
+        template <typename CodeType, typename Done>
+        std::vector<StageOccupancy> run_pipeline(const CodeType &code, TrialChannel &channel, TrialCounts &counts,
+                                                 Done &done, PerformanceMetrics &timing) const
+        {
+            using Batch = PipelineBatch<CodeType>;
+            using Clock = std::chrono::steady_clock;
+            constexpr size_t stage_count = 5;
+            constexpr size_t spin_limit = 64;                            // Yielding polls before sleeping
+            constexpr auto max_backoff = std::chrono::microseconds(100); // Longest sleep between polls
+
+            const size_t batch_size = std::max<size_t>(config_.pipeline_batch_size, 1);
+            const size_t depth = std::max<size_t>(config_.pipeline_depth, 1);
+            const size_t trial_cap = std::max(config_.iterations_per_point, config_.max_iterations);
+
+            std::vector<std::unique_ptr<Batch>> batches;
+            // rings[0] carries free batches to the source, rings[s] the output of stage s - 1
+            std::vector<std::unique_ptr<SpscRing<Batch *>>> rings;
+            for (size_t i = 0; i < stage_count; ++i)
+            {
+                rings.push_back(std::make_unique<SpscRing<Batch *>>(depth));
+            }
+            for (size_t i = 0; i < depth; ++i)
+            {
+                batches.push_back(std::make_unique<Batch>(batch_size));
+                (void)rings[0]->try_push(batches.back().get());
+            }
+
+            std::vector<StageOccupancy> stages(stage_count);
+            const char *names[stage_count] = {"source", "encoder", "channel", "decoder", "sink"};
+            for (size_t s = 0; s < stage_count; ++s)
+            {
+                stages[s].stage = names[s];
+            }
+
+            std::atomic<bool> stop{false};    // Set by the sink once the point has enough trials
+            std::atomic<bool> aborted{false}; // Set when a stage throws, so no stage waits forever
+            std::vector<std::exception_ptr> failures(stage_count);
+            size_t produced = 0;
+            bool finished = false;
+
+            auto process = [&](size_t s, Batch &batch)
+            {
+                switch (s)
                 {
-                    if (codeword[i] != received[i])
-                        bit_errors++;
+                case 0:
+                    batch.count = stop.load(std::memory_order_relaxed)
+                                      ? 0
+                                      : std::min(batch_size, trial_cap - produced);
+                    produced += batch.count;
+                    for (size_t i = 0; i < batch.count; ++i)
+                    {
+                        random_data_word<CodeType>(channel, batch.data[i]);
+                    }
+                    break;
+                case 1:
+                    for (size_t i = 0; i < batch.count; ++i)
+                    {
+                        batch.codewords[i] = code.encode(batch.data[i]);
+                    }
+                    break;
+                case 2:
+                    for (size_t i = 0; i < batch.count; ++i)
+                    {
+                        batch.weights[i] = transmit<CodeType>(channel, batch.codewords[i], batch.received[i]);
+                        batch.bit_errors[i] = (batch.codewords[i] ^ batch.received[i]).count();
+                    }
+                    break;
+                case 3:
+                    for (size_t i = 0; i < batch.count; ++i)
+                    {
+                        batch.decoded[i] = code.decode(batch.received[i]);
+                    }
+                    break;
+                default:
+                    for (size_t i = 0; i < batch.count && !finished; ++i)
+                    {
+                        count_trial(counts, CodeType::code_length, batch.bit_errors[i],
+                                    batch.data[i] != batch.decoded[i], batch.weights[i]);
+                        finished = done();
+                    }
+                    if (finished)
+                    {
+                        stop.store(true, std::memory_order_relaxed);
+                    }
+                    break;
                 }
-                total_errors += bit_errors;
+            };
 
-                // Decode
-                auto decode_start = std::chrono::high_resolution_clock::now();
-                auto decoded = code.decode(received);
-                auto decode_end = std::chrono::high_resolution_clock::now();
+            auto stage = [&](size_t s)
+            {
+                SpscRing<Batch *> &input = *rings[s];
+                SpscRing<Batch *> &output = *rings[(s + 1) % stage_count];
+                StageOccupancy &occupancy = stages[s];
+
+                // Poll `attempt`, yielding for the first misses and then sleeping with exponential backoff
+                // so a starved stage stops burning its core; the wait is charged to the stage, and the
+                // result is false once aborted
+                auto wait_for = [&](auto &&attempt)
+                {
+                    const auto start = Clock::now();
+                    auto backoff = std::chrono::microseconds(1);
+                    for (size_t misses = 0; !attempt(); ++misses)
+                    {
+                        if (aborted.load(std::memory_order_relaxed))
+                        {
+                            return false;
+                        }
+                        if (misses < spin_limit)
+                        {
+                            std::this_thread::yield();
+                        }
+                        else
+                        {
+                            std::this_thread::sleep_for(backoff);
+                            backoff = std::min(2 * backoff, max_backoff);
+                        }
+                    }
+                    occupancy.waiting_ms += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                    return true;
+                };
 
-                // Check if block error occurred
-                bool is_block_error = false;
-                for (size_t i = 0; i < CodeType::data_length; ++i)
+                try
                 {
-                    if (data[i] != decoded[i])
+                    for (;;)
                     {
-                        is_block_error = true;
-                        break;
+                        Batch *batch = nullptr;
+                        if (!wait_for([&]
+                                      { return input.try_pop(batch); }))
+                        {
+                            return;
+                        }
+
+                        const auto start = Clock::now();
+                        process(s, *batch);
+                        occupancy.busy_ms += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                        // Read before the push: once handed on, the batch may come back to the source
+                        const bool last = batch->count == 0;
+                        occupancy.batches += !last;
+
+                        if (!wait_for([&]
+                                      { return output.try_push(batch); }) ||
+                            last)
+                        {
+                            return;
+                        }
                     }
                 }
-                if (is_block_error)
-                    block_errors++;
+                catch (...)
+                {
+                    failures[s] = std::current_exception();
+                    aborted.store(true, std::memory_order_relaxed);
+                }
+            };
 
-                // Update timing metrics
-                metrics.encoding_time_ms += std::chrono::duration<double, std::milli>(
-                                                encode_end - encode_start)
-                                                .count();
-                metrics.decoding_time_ms += std::chrono::duration<double, std::milli>(
-                                                decode_end - decode_start)
-                                                .count();
+            std::vector<std::thread> pool;
+            for (size_t s = 0; s + 1 < stage_count; ++s)
+            {
+                pool.emplace_back(stage, s);
+            }
+            stage(stage_count - 1);
+            for (auto &thread : pool)
+            {
+                thread.join();
+            }
 
-                iterations++;
+            for (const auto &failure : failures)
+            {
+                if (failure)
+                {
+                    std::rethrow_exception(failure);
+                }
+            }
+
+            timing.encoding_time_ms += stages[1].busy_ms;
+            timing.decoding_time_ms += stages[3].busy_ms;
+            return stages;
+        }
+
+        /// Analyze single SNR point
+        ///
+        /// Stops after iterations_per_point once min_errors bit errors were seen, or, with a
+        /// target_relative_error, once both BER and BLER intervals are that tight (max_iterations caps
+        /// either rule). With `pipelined`, the trials run through run_pipeline and give the same counts.
+        template <typename CodeType>
+            requires CodecType<CodeType>
+        SNRPointResult analyze_snr_point(double snr_db)
+        {
+            CodeType code;
+            SNRPointResult point;
+            PerformanceMetrics &metrics = point.metrics;
+
+            const auto point_seed = static_cast<uint64_t>(std::llround(snr_db * 1000)); // Unique seed per SNR
+            TrialChannel channel(snr_db, CodeType::code_length, importance_flip_probability(CodeType::code_length),
+                                 config_.importance_sampling, point_seed, 0);
+
+            const double z = normal_quantile(0.5 + 0.5 * config_.confidence_level);
+            const bool adaptive = config_.target_relative_error > 0.0;
+            TrialCounts counts;
+
+            auto start_time = std::chrono::high_resolution_clock::now();
+
+            auto done = [&]
+            {
+                if (counts.trials < config_.iterations_per_point)
+                    return false;
+                if (counts.trials >= config_.max_iterations)
+                    return true;
+                if (adaptive)
+                    return counts.ber.converged(config_.target_relative_error, z) &&
+                           counts.bler.converged(config_.target_relative_error, z);
+                return counts.bit_errors >= config_.min_errors;
+            };
+
+            // Run until we have enough statistics or hit max iterations
+            if (config_.pipelined)
+            {
+                point.stages = run_pipeline(code, channel, counts, done, metrics);
+            }
+            else
+            {
+                while (!done())
+                {
+                    run_trial(code, channel, counts, &metrics);
+                }
             }
 
             auto end_time = std::chrono::high_resolution_clock::now();
             auto total_time = std::chrono::duration<double>(end_time - start_time).count();
 
             // Calculate final metrics
+            const size_t iterations = counts.trials;
             metrics.total_bits = iterations * CodeType::code_length;
-            metrics.error_bits = total_errors;
+            metrics.error_bits = static_cast<size_t>(std::llround(counts.weighted_bit_errors));
             metrics.total_blocks = iterations;
-            metrics.error_blocks = block_errors;
-            metrics.bit_error_rate = static_cast<double>(total_errors) / metrics.total_bits;
-            metrics.block_error_rate = static_cast<double>(block_errors) / iterations;
+            metrics.error_blocks = counts.block_errors;
+            metrics.bit_error_rate = counts.ber.mean();
+            metrics.block_error_rate = counts.bler.mean();
             metrics.throughput_mbps = (iterations * CodeType::data_length) / (total_time * 1e6);
             metrics.encoding_time_ms /= iterations;
             metrics.decoding_time_ms /= iterations;
 
-            return metrics;
+            point.sampled_bit_errors = counts.bit_errors;
+            point.error_mass = counts.weighted_bit_errors;
+            point.ber_interval = counts.ber.interval(config_.confidence_level);
+            point.bler_interval = counts.bler.interval(config_.confidence_level);
+
+            return point;
+        }
+
+        /// Biased flip probability for importance sampling
+        ///
+        /// Auto mode makes the channel flip about two bits per codeword (capped at a quarter of the bits),
+        /// so decoder failures of short codes become common events; it never lowers the true rate.
+        double importance_flip_probability(size_t code_length) const
+        {
+            return config_.importance_flip_probability > 0.0
+                       ? config_.importance_flip_probability
+                       : std::min(0.25, 2.0 / code_length);
         }
 
         /// Generate random data for testing
@@ -333,24 +1238,150 @@ namespace ecc::benchmark
             }
         }
 
-        /// Add AWGN errors to codeword
-        std::vector<uint8_t> add_awgn_errors(const std::vector<uint8_t> &codeword, double snr_db)
+        /// Shard file of `shard` in the output directory
+        std::filesystem::path shard_path(const SweepShard &shard) const
+        {
+            std::ostringstream name;
+            name << file_stem(shard.code_name) << "_snr" << std::llround(shard.snr_db * 1000)
+                 << "_seeds" << shard.first_seed << "-" << shard.first_seed + shard.seed_count << ".part";
+            return std::filesystem::path(config_.output_directory) / name.str();
+        }
+
+        /// Code name with the characters that are awkward in file names replaced
+        static std::string file_stem(std::string name)
+        {
+            std::replace(name.begin(), name.end(), '(', '_');
+            std::replace(name.begin(), name.end(), ')', '_');
+            std::replace(name.begin(), name.end(), ',', '_');
+            return name;
+        }
+
+        /// Run one shard, appending a record per finished seed and skipping seeds already on disk
+        ///
+        /// Resuming a file written under another configuration throws rather than mixing the two.
+        template <typename CodeType>
+        void run_shard(const SweepShard &shard, bool resume) const
+        {
+            const auto path = shard_path(shard);
+            const ShardHeader header = shard_header<CodeType>(shard.code_name);
+
+            std::set<uint64_t> finished;
+            const bool append = resume && std::filesystem::exists(path) &&
+                                std::filesystem::file_size(path) >= ShardHeader::size;
+            if (append)
+            {
+                const auto records = read_shard_records(path, header);
+                for (const auto &record : records)
+                {
+                    finished.insert(record.seed);
+                }
+
+                // Drop a record torn by a crash so appended records stay aligned
+                std::filesystem::resize_file(path, ShardHeader::size + records.size() * ShardRecord::size);
+            }
+            else
+            {
+                std::filesystem::remove(path);
+            }
+
+            std::ofstream file(path, std::ios::binary | std::ios::app);
+            if (!file.is_open())
+            {
+                throw std::runtime_error("Cannot open shard file: " + path.string());
+            }
+            if (!append)
+            {
+                const auto bytes = header.encode();
+                file.write(bytes.data(), bytes.size());
+            }
+
+            CodeType code;
+            const uint64_t point_seed = static_cast<uint64_t>(std::llround(shard.snr_db * 1000));
+            for (uint64_t seed = shard.first_seed; seed < shard.first_seed + shard.seed_count; ++seed)
+            {
+                if (finished.count(seed))
+                {
+                    continue;
+                }
+
+                TrialChannel channel(shard.snr_db, CodeType::code_length, importance_flip_probability(CodeType::code_length),
+                                     config_.importance_sampling, point_seed, seed);
+                TrialCounts counts;
+                const auto start_time = std::chrono::steady_clock::now();
+                for (size_t trial = 0; trial < config_.trials_per_seed; ++trial)
+                {
+                    run_trial(code, channel, counts);
+                }
+
+                ShardRecord record;
+                record.snr_db = shard.snr_db;
+                record.seed = seed;
+                record.trials = counts.trials;
+                record.bit_errors = counts.bit_errors;
+                record.weighted_bit_errors = counts.weighted_bit_errors;
+                record.block_errors = counts.block_errors;
+                record.ber_sum = counts.ber.get_sum();
+                record.ber_sum_squares = counts.ber.get_sum_squares();
+                record.ber_events = counts.ber.get_events();
+                record.bler_sum = counts.bler.get_sum();
+                record.bler_sum_squares = counts.bler.get_sum_squares();
+                record.bler_events = counts.bler.get_events();
+                record.elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+                const auto bytes = record.encode();
+                file.write(bytes.data(), bytes.size());
+                file.flush();
+            }
+        }
+
+        /// Header identifying the configuration behind `code_name`'s shard records
+        template <typename CodeType>
+        ShardHeader shard_header(const std::string &code_name) const
         {
-            static std::mt19937 rng(42);
+            ShardHeader header;
+            header.code_name = code_name;
+            header.trials_per_seed = config_.trials_per_seed;
+            header.importance_sampling = config_.importance_sampling;
+            header.importance_flip_probability =
+                config_.importance_sampling ? importance_flip_probability(CodeType::code_length) : 0.0;
+            header.confidence_level = config_.confidence_level;
+            return header;
+        }
 
-            auto result = codeword;
-            double snr_linear = std::pow(10.0, snr_db / 10.0);
-            double noise_variance = 1.0 / (2.0 * snr_linear);
-            std::normal_distribution<double> noise_dist(0.0, std::sqrt(noise_variance));
+        /// All complete records in a shard file (a torn trailing record is ignored, and a file too short
+        /// for its header holds none); throws if the header differs from `expected`
+        static std::vector<ShardRecord> read_shard_records(const std::filesystem::path &path,
+                                                           const ShardHeader &expected)
+        {
+            std::vector<ShardRecord> records;
+            std::ifstream file(path, std::ios::binary);
 
-            for (auto &bit : result)
+            std::array<char, ShardHeader::size> header_bytes;
+            if (!file.read(header_bytes.data(), header_bytes.size()))
+            {
+                return records;
+            }
+            ShardHeader header;
+            if (!ShardHeader::decode(header_bytes, header))
             {
-                double signal = (bit == 0) ? -1.0 : 1.0;
-                double received_signal = signal + noise_dist(rng);
-                bit = (received_signal > 0.0) ? 1 : 0;
+                throw std::runtime_error("Not a shard file of this version: " + path.string());
+            }
+            if (header != expected)
+            {
+                throw std::runtime_error("Shard file written under a different configuration: " + path.string());
             }
 
-            return result;
+            std::array<char, ShardRecord::size> bytes;
+            while (file.read(bytes.data(), bytes.size()))
+            {
+                ShardRecord record;
+                if (!ShardRecord::decode(bytes, record))
+                {
+                    break;
+                }
+                records.push_back(record);
+            }
+            return records;
         }
 
         /// Analyze specific channel model
@@ -377,6 +1408,7 @@ namespace ecc::benchmark
             CodeType code;
             size_t total_errors = 0;
             size_t block_errors = 0;
+            PackedCodewords channel_buffer(CodeType::code_length, 1);
 
             for (size_t iter = 0; iter < iterations; ++iter)
             {
@@ -385,43 +1417,16 @@ namespace ecc::benchmark
                 generate_random_data(data);
                 auto codeword = code.encode(data);
 
-                // Convert and add errors
-                std::vector<uint8_t> codeword_vec(CodeType::code_length);
-                for (size_t i = 0; i < CodeType::code_length; ++i)
-                {
-                    codeword_vec[i] = codeword[i] ? 1 : 0;
-                }
-
-                auto received_vec = simulator_.apply_errors(codeword_vec);
-
-                // Convert back and decode
-                typename CodeType::CodeWord received;
-                for (size_t i = 0; i < CodeType::code_length; ++i)
-                {
-                    received[i] = received_vec[i];
-                }
+                // Add errors in place on the packed words
+                channel_buffer.store(0, codeword);
+                simulator_.apply_errors(channel_buffer);
+                const auto received = channel_buffer.template load<CodeType::code_length>(0);
 
                 auto decoded = code.decode(received);
 
                 // Count errors
-                size_t bit_errors = 0;
-                for (size_t i = 0; i < CodeType::code_length; ++i)
-                {
-                    if (codeword[i] != received[i])
-                        bit_errors++;
-                }
-                total_errors += bit_errors;
-
-                bool is_block_error = false;
-                for (size_t i = 0; i < CodeType::data_length; ++i)
-                {
-                    if (data[i] != decoded[i])
-                    {
-                        is_block_error = true;
-                        break;
-                    }
-                }
-                if (is_block_error)
+                total_errors += (codeword ^ received).count();
+                if (data != decoded)
                     block_errors++;
             }
 
@@ -431,6 +1436,7 @@ namespace ecc::benchmark
                                          (iterations * CodeType::code_length));
             results.bler_values.push_back(static_cast<double>(block_errors) / iterations);
             results.error_counts.push_back(total_errors);
+            results.error_mass.push_back(static_cast<double>(total_errors));
             results.block_counts.push_back(iterations);
 
             return results;
@@ -606,8 +1612,13 @@ namespace ecc::benchmark
                 return;
             }
 
-            // Write CSV header
-            file << "SNR_dB,BER,BLER,Throughput_Mbps,Error_Count,Block_Count\n";
+            // Write CSV header: Error_Count is the weighted error mass the BER is computed from, and
+            // Sampled_Error_Count the errors actually drawn (they differ under importance sampling)
+            const bool intervals = results.ber_intervals.size() == results.snr_db_values.size();
+            const bool weighted = results.error_mass.size() == results.snr_db_values.size();
+            file << "SNR_dB,BER,BLER,Throughput_Mbps,Error_Count,"
+                 << (weighted ? "Sampled_Error_Count," : "") << "Block_Count"
+                 << (intervals ? ",BER_CI_Low,BER_CI_High,BLER_CI_Low,BLER_CI_High" : "") << "\n";
 
             // Write data
             for (size_t i = 0; i < results.snr_db_values.size(); ++i)
@@ -615,9 +1626,20 @@ namespace ecc::benchmark
                 file << std::fixed << std::setprecision(2) << results.snr_db_values[i] << ","
                      << std::scientific << std::setprecision(6) << results.ber_values[i] << ","
                      << results.bler_values[i] << ","
-                     << std::fixed << std::setprecision(2) << results.throughput_values[i] << ","
-                     << results.error_counts[i] << ","
-                     << results.block_counts[i] << "\n";
+                     << std::fixed << std::setprecision(2) << results.throughput_values[i] << ",";
+                if (weighted)
+                {
+                    file << std::defaultfloat << std::setprecision(10) << results.error_mass[i] << ",";
+                }
+                file << results.error_counts[i] << ","
+                     << results.block_counts[i];
+                if (intervals)
+                {
+                    file << std::scientific << std::setprecision(6)
+                         << "," << results.ber_intervals[i].low << "," << results.ber_intervals[i].high
+                         << "," << results.bler_intervals[i].low << "," << results.bler_intervals[i].high;
+                }
+                file << "\n";
             }
 
             std::cout << "Results saved to: " << filename << "\n";
@@ -672,6 +1694,23 @@ namespace ecc::benchmark
             }
         }
 
+        /// Print the busy share of each pipeline stage and name the bottleneck
+        static void print_stage_occupancy(const std::vector<StageOccupancy> &stages)
+        {
+            std::cout << "    Stages:";
+            const StageOccupancy *bottleneck = &stages.front();
+            for (const auto &stage : stages)
+            {
+                std::cout << " " << stage.stage << " " << std::fixed << std::setprecision(0)
+                          << 100.0 * stage.occupancy() << "%";
+                if (stage.occupancy() > bottleneck->occupancy())
+                {
+                    bottleneck = &stage;
+                }
+            }
+            std::cout << " (bottleneck: " << bottleneck->stage << ")\n";
+        }
+
         /// Print channel comparison
         void print_channel_comparison(const std::vector<std::pair<std::string, BERResults>> &results)
         {
@@ -707,6 +1746,8 @@ namespace ecc::benchmark
         config.snr_step_db = 1.0;
         config.iterations_per_point = 10000;
         config.min_errors = 50;
+        config.target_relative_error = 0.1;
+        config.importance_sampling = true;
         config.save_to_csv = true;
 
         BERAnalyzer analyzer(config);
@@ -0,0 +1,1118 @@
+#include "ecc/cpu_dispatch.hpp"
+#include "ecc/hamming_code.hpp"
+#include "ecc/bch_code.hpp"
+#include "ecc/reed_solomon.hpp"
+#include "ecc/ldpc_code.hpp"
+#include "ecc/turbo_code.hpp"
+#include "ecc/galois_field.hpp"
+#include "ecc/gaussian_noise.hpp"
+#include "ecc/packed_codewords.hpp"
+#include "ecc/rng.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(ECC_X86_DISPATCH)
+#include <x86intrin.h>
+#endif
+
+/// Microbenchmark suite: every codec's encode, clean decode and t-error decode paths, GF(2^m)
+/// operations and channel models, over a grid of batch sizes and thread counts
+///
+/// Each configuration is calibrated to run for at least --min-time per repetition and timed over
+/// --repetitions repetitions; the table shows mean ns/op with its standard deviation, timestamp
+/// counter cycles per payload byte and GB/s. --json writes the same results (with every sample) for
+/// comparing releases.
+namespace ecc::benchmark
+{
+
+    namespace detail
+    {
+        /// Timestamp counter ticks (constant-rate reference cycles); 0 where there is none
+        [[nodiscard]] inline uint64_t read_cycle_counter() noexcept
+        {
+#if defined(ECC_X86_DISPATCH)
+            return __rdtsc();
+#else
+            return 0;
+#endif
+        }
+
+        [[nodiscard]] constexpr bool has_cycle_counter() noexcept
+        {
+#if defined(ECC_X86_DISPATCH)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /// First item of worker `thread` when `count` items are split evenly across `threads`
+        [[nodiscard]] constexpr size_t slice_begin(size_t count, size_t threads, size_t thread) noexcept
+        {
+            return count * thread / threads;
+        }
+
+        [[nodiscard]] constexpr size_t slice_size(size_t count, size_t threads, size_t thread) noexcept
+        {
+            return slice_begin(count, threads, thread + 1) - slice_begin(count, threads, thread);
+        }
+
+        /// Per-thread result accumulator on its own cache line, so workers never share one
+        struct alignas(64) Sink
+        {
+            uint64_t value = 0;
+        };
+
+        /// `count` random codewords of `bits` bits (tail bits clear)
+        [[nodiscard]] inline PackedCodewords random_packed(size_t bits, size_t count, Xoshiro256 &rng)
+        {
+            PackedCodewords packed(bits, count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto words = packed.codeword(i);
+                for (auto &word : words)
+                {
+                    word = rng();
+                }
+                words.back() &= packed.tail_mask();
+            }
+            return packed;
+        }
+
+        /// `count` distinct random positions below `length`
+        [[nodiscard]] inline std::vector<size_t> error_positions(size_t length, size_t count, Xoshiro256 &rng)
+        {
+            std::vector<size_t> positions;
+            while (positions.size() < count)
+            {
+                const size_t pos = static_cast<size_t>(rng() % length);
+                if (std::find(positions.begin(), positions.end(), pos) == positions.end())
+                {
+                    positions.push_back(pos);
+                }
+            }
+            return positions;
+        }
+
+        inline void inject_errors(PackedCodewords &codewords, size_t errors, Xoshiro256 &rng)
+        {
+            for (size_t i = 0; i < codewords.size(); ++i)
+            {
+                for (size_t pos : error_positions(codewords.codeword_length(), errors, rng))
+                {
+                    codewords.flip(i, pos);
+                }
+            }
+        }
+
+        [[nodiscard]] inline std::vector<uint8_t> random_bits(size_t count, Xoshiro256 &rng)
+        {
+            std::vector<uint8_t> bits(count);
+            for (auto &bit : bits)
+            {
+                bit = static_cast<uint8_t>(rng() & 1);
+            }
+            return bits;
+        }
+
+        [[nodiscard]] inline std::string json_escape(std::string_view text)
+        {
+            std::string escaped;
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    escaped += '\\';
+                    escaped += c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    escaped += ' ';
+                }
+                else
+                {
+                    escaped += c;
+                }
+            }
+            return escaped;
+        }
+
+        /// JSON number, or null for NaN and infinities
+        [[nodiscard]] inline std::string json_number(double value)
+        {
+            if (!std::isfinite(value))
+                return "null";
+
+            std::ostringstream out;
+            out << std::setprecision(9) << value;
+            return out.str();
+        }
+
+        [[nodiscard]] inline std::vector<size_t> parse_size_list(const std::string &text)
+        {
+            std::vector<size_t> values;
+            std::stringstream stream(text);
+            std::string item;
+            while (std::getline(stream, item, ','))
+            {
+                const unsigned long long value = std::stoull(item);
+                if (value == 0)
+                    throw std::invalid_argument("List values must be positive: " + text);
+                values.push_back(static_cast<size_t>(value));
+            }
+            if (values.empty())
+                throw std::invalid_argument("Empty list");
+            return values;
+        }
+    } // namespace detail
+
+    /// Mean, sample standard deviation and range of the per-repetition samples
+    struct SampleSummary
+    {
+        double mean = 0.0;
+        double stddev = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+
+        [[nodiscard]] static SampleSummary of(const std::vector<double> &samples)
+        {
+            SampleSummary summary;
+            if (samples.empty())
+                return summary;
+
+            summary.min = *std::min_element(samples.begin(), samples.end());
+            summary.max = *std::max_element(samples.begin(), samples.end());
+            for (double s : samples)
+            {
+                summary.mean += s;
+            }
+            summary.mean /= static_cast<double>(samples.size());
+
+            if (samples.size() > 1)
+            {
+                double squares = 0.0;
+                for (double s : samples)
+                {
+                    squares += (s - summary.mean) * (s - summary.mean);
+                }
+                summary.stddev = std::sqrt(squares / static_cast<double>(samples.size() - 1));
+            }
+            return summary;
+        }
+    };
+
+    /// One benchmarked operation
+    ///
+    /// prepare(batch, threads) builds inputs for `batch` operations split across `threads` workers and
+    /// returns the kernel; kernel(t) performs worker t's share once and must leave its inputs unchanged
+    /// so it can be repeated.
+    struct BenchmarkCase
+    {
+        using Kernel = std::function<void(size_t thread)>;
+
+        std::string codec;
+        std::string operation;
+        size_t errors = 0;       // Channel errors injected per codeword
+        double item_bytes = 0.0; // Payload bytes per operation (data bytes for codecs)
+        size_t max_batch = 0;    // Larger batches are skipped (0: no limit)
+        std::function<Kernel(size_t batch, size_t threads)> prepare;
+
+        [[nodiscard]] std::string name() const { return codec + "/" + operation; }
+    };
+
+    /// Timing of one case at one batch size and thread count
+    struct Measurement
+    {
+        std::string codec;
+        std::string operation;
+        size_t errors = 0;
+        double item_bytes = 0.0;
+        size_t batch = 0;
+        size_t threads = 0;
+        uint64_t iterations = 0;         // Batch passes per repetition
+        std::vector<double> ns_per_op;   // One sample per repetition
+        SampleSummary summary;
+        std::optional<double> cycles_per_byte;
+        double gb_per_s = 0.0;
+
+        [[nodiscard]] std::string name() const
+        {
+            return codec + "/" + operation + "/batch:" + std::to_string(batch) + "/threads:" + std::to_string(threads);
+        }
+    };
+
+    struct MicroBenchmarkOptions
+    {
+        std::vector<size_t> batches{1, 64, 4096};
+        std::vector<size_t> threads{1};
+        size_t repetitions = 5;
+        double min_time_ms = 20.0;
+        std::string filter; // Substring of "codec/operation"
+    };
+
+    class MicroBenchmark
+    {
+    private:
+        MicroBenchmarkOptions options;
+        std::vector<BenchmarkCase> cases;
+
+        /// Wall time in ns of `iterations` passes of every worker; cycles receives the counter delta
+        static double run_repetition(const BenchmarkCase::Kernel &kernel, size_t threads, uint64_t iterations,
+                                     uint64_t &cycles)
+        {
+            std::vector<std::exception_ptr> failures(threads);
+            auto worker = [&](size_t thread)
+            {
+                try
+                {
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        kernel(thread);
+                    }
+                }
+                catch (...)
+                {
+                    failures[thread] = std::current_exception();
+                }
+            };
+
+            const auto start = std::chrono::steady_clock::now();
+            const uint64_t start_cycles = detail::read_cycle_counter();
+
+            std::vector<std::thread> pool;
+            pool.reserve(threads - 1);
+            for (size_t t = 1; t < threads; ++t)
+            {
+                pool.emplace_back(worker, t);
+            }
+            worker(0);
+            for (auto &thread : pool)
+            {
+                thread.join();
+            }
+
+            cycles = detail::read_cycle_counter() - start_cycles;
+            const auto end = std::chrono::steady_clock::now();
+
+            for (const auto &failure : failures)
+            {
+                if (failure)
+                    std::rethrow_exception(failure);
+            }
+            return std::chrono::duration<double, std::nano>(end - start).count();
+        }
+
+        [[nodiscard]] Measurement measure(const BenchmarkCase &bench, size_t batch, size_t threads) const
+        {
+            const BenchmarkCase::Kernel kernel = bench.prepare(batch, threads);
+
+            // Warm-up pass doubles as calibration
+            uint64_t cycles = 0;
+            const double warmup_ns = std::max(run_repetition(kernel, threads, 1, cycles), 1.0);
+            const double target_ns = options.min_time_ms * 1e6;
+            const auto iterations = static_cast<uint64_t>(std::clamp(std::ceil(target_ns / warmup_ns), 1.0, 1e9));
+
+            Measurement result;
+            result.codec = bench.codec;
+            result.operation = bench.operation;
+            result.errors = bench.errors;
+            result.item_bytes = bench.item_bytes;
+            result.batch = batch;
+            result.threads = threads;
+            result.iterations = iterations;
+
+            const double operations = static_cast<double>(iterations) * static_cast<double>(batch);
+            double total_cycles = 0.0;
+            for (size_t r = 0; r < options.repetitions; ++r)
+            {
+                const double elapsed = run_repetition(kernel, threads, iterations, cycles);
+                result.ns_per_op.push_back(elapsed / operations);
+                total_cycles += static_cast<double>(cycles);
+            }
+
+            result.summary = SampleSummary::of(result.ns_per_op);
+            result.gb_per_s = result.summary.mean > 0.0 ? bench.item_bytes / result.summary.mean : 0.0;
+            if (detail::has_cycle_counter() && bench.item_bytes > 0.0)
+            {
+                const double bytes = operations * bench.item_bytes * static_cast<double>(options.repetitions);
+                result.cycles_per_byte = total_cycles / bytes;
+            }
+            return result;
+        }
+
+    public:
+        explicit MicroBenchmark(MicroBenchmarkOptions opts) : options(std::move(opts))
+        {
+            if (options.repetitions == 0)
+                throw std::invalid_argument("Repetitions must be positive");
+            if (options.batches.empty() || options.threads.empty())
+                throw std::invalid_argument("Batch and thread lists must not be empty");
+        }
+
+        void add(BenchmarkCase bench)
+        {
+            cases.push_back(std::move(bench));
+        }
+
+        [[nodiscard]] const std::vector<BenchmarkCase> &get_cases() const noexcept { return cases; }
+
+        [[nodiscard]] const MicroBenchmarkOptions &get_options() const noexcept { return options; }
+
+        /// Measure every case matching the filter over the batch x thread grid
+        ///
+        /// Batches above a case's limit and thread counts above the batch size are skipped. `progress`
+        /// is called after each measurement.
+        std::vector<Measurement> run(const std::function<void(const Measurement &)> &progress = {}) const
+        {
+            std::vector<Measurement> results;
+            for (const auto &bench : cases)
+            {
+                if (!options.filter.empty() && bench.name().find(options.filter) == std::string::npos)
+                    continue;
+
+                for (size_t batch : options.batches)
+                {
+                    if (bench.max_batch != 0 && batch > bench.max_batch)
+                        continue;
+
+                    for (size_t threads : options.threads)
+                    {
+                        if (threads > batch)
+                            continue;
+
+                        results.push_back(measure(bench, batch, threads));
+                        if (progress)
+                            progress(results.back());
+                    }
+                }
+            }
+            return results;
+        }
+
+        static void print_header(std::ostream &out)
+        {
+            out << std::left << std::setw(36) << "benchmark" << std::right
+                << std::setw(8) << "batch" << std::setw(8) << "threads"
+                << std::setw(14) << "ns/op" << std::setw(10) << "stddev"
+                << std::setw(12) << "cycles/B" << std::setw(10) << "GB/s" << "\n";
+            out << std::string(98, '-') << "\n";
+        }
+
+        static void print_row(const Measurement &m, std::ostream &out)
+        {
+            const double cv = m.summary.mean > 0.0 ? 100.0 * m.summary.stddev / m.summary.mean : 0.0;
+
+            std::ostringstream spread;
+            spread << std::fixed << std::setprecision(1) << cv << "%";
+
+            out << std::left << std::setw(36) << (m.codec + "/" + m.operation) << std::right
+                << std::setw(8) << m.batch << std::setw(8) << m.threads
+                << std::fixed << std::setprecision(2) << std::setw(14) << m.summary.mean
+                << std::setw(10) << spread.str() << std::setw(12);
+            if (m.cycles_per_byte)
+                out << *m.cycles_per_byte;
+            else
+                out << "-";
+            out << std::setprecision(3) << std::setw(10) << m.gb_per_s << "\n";
+        }
+
+        /// Results as one JSON document: run context and one object per measurement
+        void write_json(const std::vector<Measurement> &results, std::ostream &out) const
+        {
+            out << "{\n  \"context\": {\n";
+            out << "    \"suite\": \"ecc_microbench\",\n";
+#if defined(__VERSION__)
+            out << "    \"compiler\": \"" << detail::json_escape(__VERSION__) << "\",\n";
+#elif defined(_MSC_FULL_VER)
+            out << "    \"compiler\": \"msvc " << _MSC_FULL_VER << "\",\n";
+#endif
+#if defined(NDEBUG)
+            out << "    \"build\": \"release\",\n";
+#else
+            out << "    \"build\": \"debug\",\n";
+#endif
+            out << "    \"simd_level\": \"" << simd_level_name(active_simd_level()) << "\",\n";
+            out << "    \"detected_simd_level\": \"" << simd_level_name(detected_simd_level()) << "\",\n";
+            out << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+            out << "    \"cycle_counter\": " << (detail::has_cycle_counter() ? "\"tsc\"" : "null") << ",\n";
+            out << "    \"repetitions\": " << options.repetitions << ",\n";
+            out << "    \"min_time_ms\": " << detail::json_number(options.min_time_ms) << "\n";
+            out << "  },\n  \"benchmarks\": [";
+
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const Measurement &m = results[i];
+                out << (i == 0 ? "\n" : ",\n") << "    {\n";
+                out << "      \"name\": \"" << detail::json_escape(m.name()) << "\",\n";
+                out << "      \"codec\": \"" << detail::json_escape(m.codec) << "\",\n";
+                out << "      \"operation\": \"" << detail::json_escape(m.operation) << "\",\n";
+                out << "      \"errors\": " << m.errors << ",\n";
+                out << "      \"item_bytes\": " << detail::json_number(m.item_bytes) << ",\n";
+                out << "      \"batch\": " << m.batch << ",\n";
+                out << "      \"threads\": " << m.threads << ",\n";
+                out << "      \"iterations\": " << m.iterations << ",\n";
+                out << "      \"repetitions\": " << m.ns_per_op.size() << ",\n";
+                out << "      \"ns_per_op\": {\"mean\": " << detail::json_number(m.summary.mean)
+                    << ", \"stddev\": " << detail::json_number(m.summary.stddev)
+                    << ", \"min\": " << detail::json_number(m.summary.min)
+                    << ", \"max\": " << detail::json_number(m.summary.max) << "},\n";
+                out << "      \"samples_ns_per_op\": [";
+                for (size_t s = 0; s < m.ns_per_op.size(); ++s)
+                {
+                    out << (s == 0 ? "" : ", ") << detail::json_number(m.ns_per_op[s]);
+                }
+                out << "],\n";
+                out << "      \"cycles_per_byte\": "
+                    << (m.cycles_per_byte ? detail::json_number(*m.cycles_per_byte) : std::string("null")) << ",\n";
+                out << "      \"gb_per_s\": " << detail::json_number(m.gb_per_s) << "\n";
+                out << "    }";
+            }
+            out << (results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+        }
+    };
+
+    /// encode, decode_clean and decode_errors through the packed batch API (Hamming and BCH)
+    template <typename Code>
+    void add_packed_code_cases(MicroBenchmark &bench, const std::string &codec, size_t errors)
+    {
+        constexpr double data_bytes = Code::data_length / 8.0;
+
+        bench.add({codec, "encode", 0, data_bytes, 0, [](size_t batch, size_t threads)
+                   {
+                       struct State
+                       {
+                           Code code;
+                           std::vector<PackedCodewords> data;
+                           std::vector<PackedCodewords> out;
+                       };
+                       auto state = std::make_shared<State>();
+                       Xoshiro256 rng(1);
+                       for (size_t t = 0; t < threads; ++t)
+                       {
+                           const size_t count = detail::slice_size(batch, threads, t);
+                           state->data.push_back(detail::random_packed(Code::data_length, count, rng));
+                           state->out.emplace_back(Code::code_length, count);
+                       }
+                       return [state](size_t t)
+                       { state->code.encode(state->data[t], state->out[t]); };
+                   }});
+
+        for (size_t injected : {size_t{0}, errors})
+        {
+            bench.add({codec, injected == 0 ? "decode_clean" : "decode_errors", injected, data_bytes, 0,
+                       [injected](size_t batch, size_t threads)
+                       {
+                           struct State
+                           {
+                               Code code;
+                               std::vector<PackedCodewords> received;
+                               std::vector<PackedCodewords> out;
+                               std::vector<detail::Sink> sinks;
+                           };
+                           auto state = std::make_shared<State>();
+                           state->sinks.resize(threads);
+                           Xoshiro256 rng(2);
+                           for (size_t t = 0; t < threads; ++t)
+                           {
+                               const size_t count = detail::slice_size(batch, threads, t);
+                               PackedCodewords codewords;
+                               state->code.encode(detail::random_packed(Code::data_length, count, rng), codewords);
+                               detail::inject_errors(codewords, injected, rng);
+                               state->received.push_back(std::move(codewords));
+                               state->out.emplace_back(Code::data_length, count);
+                           }
+                           return [state](size_t t)
+                           { state->sinks[t].value += state->code.decode(state->received[t], state->out[t]); };
+                       }});
+        }
+    }
+
+    inline void add_secded72_cases(MicroBenchmark &bench)
+    {
+        struct State
+        {
+            std::vector<uint64_t> data;
+            std::vector<uint8_t> check;
+            std::vector<detail::Sink> sinks;
+            size_t batch = 0;
+            size_t threads = 0;
+
+            [[nodiscard]] size_t begin(size_t t) const noexcept { return detail::slice_begin(batch, threads, t); }
+            [[nodiscard]] size_t size(size_t t) const noexcept { return detail::slice_size(batch, threads, t); }
+        };
+        auto make_state = [](size_t batch, size_t threads, size_t errors)
+        {
+            auto state = std::make_shared<State>();
+            Xoshiro256 rng(3);
+            state->data.resize(batch);
+            state->check.resize(batch);
+            state->sinks.resize(threads);
+            state->batch = batch;
+            state->threads = threads;
+            for (auto &word : state->data)
+            {
+                word = rng();
+            }
+            SECDED72::encode(state->data, state->check);
+            for (size_t i = 0; errors > 0 && i < batch; ++i)
+            {
+                const size_t pos = static_cast<size_t>(rng() % SECDED72::code_length);
+                if (pos < 64)
+                    state->data[i] ^= uint64_t{1} << pos;
+                else
+                    state->check[i] ^= static_cast<uint8_t>(1u << (pos - 64));
+            }
+            return state;
+        };
+
+        bench.add({"secded_72_64", "encode", 0, 8.0, 0, [make_state](size_t batch, size_t threads)
+                   {
+                       auto state = make_state(batch, threads, 0);
+                       return [state](size_t t)
+                       {
+                           SECDED72::encode(std::span<const uint64_t>(state->data).subspan(state->begin(t), state->size(t)),
+                                            std::span<uint8_t>(state->check).subspan(state->begin(t), state->size(t)));
+                       };
+                   }});
+
+        // Clean words pass through the bulk decoder unchanged, so it can run in place
+        bench.add({"secded_72_64", "decode_clean", 0, 8.0, 0, [make_state](size_t batch, size_t threads)
+                   {
+                       auto state = make_state(batch, threads, 0);
+                       return [state](size_t t)
+                       {
+                           const auto counts = SECDED72::decode(std::span<uint64_t>(state->data).subspan(state->begin(t), state->size(t)),
+                                                                std::span<uint8_t>(state->check).subspan(state->begin(t), state->size(t)));
+                           state->sinks[t].value += counts.corrected + counts.double_errors;
+                       };
+                   }});
+
+        // The bulk decoder repairs in place; the per-word form leaves the damaged words for the next pass
+        bench.add({"secded_72_64", "decode_errors", 1, 8.0, 0, [make_state](size_t batch, size_t threads)
+                   {
+                       auto state = make_state(batch, threads, 1);
+                       return [state](size_t t)
+                       {
+                           uint64_t sum = 0;
+                           for (size_t i = state->begin(t); i < state->begin(t) + state->size(t); ++i)
+                           {
+                               sum += SECDED72::decode(state->data[i], state->check[i]).data;
+                           }
+                           state->sinks[t].value += sum;
+                       };
+                   }});
+    }
+
+    /// Batched byte encoder and syndromes, and the allocation-free single-codeword decoder
+    template <typename Code>
+    void add_reed_solomon_cases(MicroBenchmark &bench, const std::string &codec)
+    {
+        constexpr size_t n = Code::code_length;
+        constexpr size_t k = Code::data_length;
+        constexpr size_t t_max = Code::error_correction_capability;
+
+        struct State
+        {
+            Code code;
+            std::vector<uint8_t> data;
+            std::vector<uint8_t> codewords;
+            std::vector<uint8_t> syndromes;
+            std::vector<typename Code::CodeWord> received;
+            std::vector<detail::Sink> sinks;
+            size_t batch = 0;
+            size_t threads = 0;
+
+            [[nodiscard]] size_t begin(size_t t) const noexcept { return detail::slice_begin(batch, threads, t); }
+            [[nodiscard]] size_t size(size_t t) const noexcept { return detail::slice_size(batch, threads, t); }
+        };
+        auto make_state = [](size_t batch, size_t threads, size_t errors)
+        {
+            auto state = std::make_shared<State>();
+            Xoshiro256 rng(4);
+            state->batch = batch;
+            state->threads = threads;
+            state->sinks.resize(threads);
+            state->data.resize(batch * k);
+            state->codewords.resize(batch * n);
+            state->syndromes.resize(batch * (n - k));
+            for (auto &byte : state->data)
+            {
+                byte = static_cast<uint8_t>(rng());
+            }
+            state->code.encode_bytes(state->data, state->codewords);
+
+            state->received.resize(batch);
+            for (size_t i = 0; i < batch; ++i)
+            {
+                for (size_t pos : detail::error_positions(n, errors, rng))
+                {
+                    state->codewords[i * n + pos] ^= static_cast<uint8_t>(1 + rng() % 255);
+                }
+                std::copy_n(state->codewords.begin() + i * n, n, state->received[i].begin());
+            }
+            return state;
+        };
+
+        bench.add({codec, "encode", 0, static_cast<double>(k), 0, [make_state](size_t batch, size_t threads)
+                   {
+                       auto state = make_state(batch, threads, 0);
+                       return [state](size_t t)
+                       {
+                           state->code.encode_bytes(std::span<const uint8_t>(state->data).subspan(state->begin(t) * k, state->size(t) * k),
+                                                    std::span<uint8_t>(state->codewords).subspan(state->begin(t) * n, state->size(t) * n));
+                       };
+                   }});
+
+        for (size_t errors : {size_t{0}, t_max})
+        {
+            bench.add({codec, errors == 0 ? "syndromes_clean" : "syndromes_errors", errors, static_cast<double>(k), 0,
+                       [make_state, errors](size_t batch, size_t threads)
+                       {
+                           auto state = make_state(batch, threads, errors);
+                           return [state](size_t t)
+                           {
+                               state->code.calculate_syndromes_bytes(
+                                   std::span<const uint8_t>(state->codewords).subspan(state->begin(t) * n, state->size(t) * n),
+                                   std::span<uint8_t>(state->syndromes).subspan(state->begin(t) * (n - k), state->size(t) * (n - k)));
+                           };
+                       }});
+
+            bench.add({codec, errors == 0 ? "decode_clean" : "decode_errors", errors, static_cast<double>(k), 0,
+                       [make_state, errors](size_t batch, size_t threads)
+                       {
+                           auto state = make_state(batch, threads, errors);
+                           return [state](size_t t)
+                           {
+                               uint64_t corrected = 0;
+                               for (size_t i = state->begin(t); i < state->begin(t) + state->size(t); ++i)
+                               {
+                                   corrected += state->code.decode_fixed(state->received[i]).errors_corrected;
+                               }
+                               state->sinks[t].value += corrected;
+                           };
+                       }});
+        }
+    }
+
+    /// Single-codeword encode and decode with one reusable workspace per thread (LDPC and Turbo)
+    template <typename Code, typename Factory>
+    void add_iterative_code_cases(MicroBenchmark &bench, const std::string &codec, Factory factory,
+                                  size_t errors, size_t max_batch)
+    {
+        struct State
+        {
+            Code code;
+            std::vector<typename Code::DataWord> data;
+            std::vector<typename Code::CodeWord> codewords;
+            std::vector<typename Code::Workspace> workspaces;
+            std::vector<detail::Sink> sinks;
+            size_t batch = 0;
+            size_t threads = 0;
+
+            explicit State(Code c) : code(std::move(c)) {}
+
+            [[nodiscard]] size_t begin(size_t t) const noexcept { return detail::slice_begin(batch, threads, t); }
+            [[nodiscard]] size_t end(size_t t) const noexcept { return detail::slice_begin(batch, threads, t + 1); }
+        };
+        auto make_state = [factory](size_t batch, size_t threads, size_t injected)
+        {
+            auto state = std::make_shared<State>(factory());
+            Xoshiro256 rng(5);
+            state->batch = batch;
+            state->threads = threads;
+            state->sinks.resize(threads);
+            state->workspaces.resize(threads);
+            for (size_t i = 0; i < batch; ++i)
+            {
+                state->data.push_back(detail::random_bits(state->code.get_info_length(), rng));
+                auto codeword = state->code.encode(state->data.back());
+                for (size_t pos : detail::error_positions(codeword.size(), injected, rng))
+                {
+                    codeword[pos] ^= 1;
+                }
+                state->codewords.push_back(std::move(codeword));
+            }
+            return state;
+        };
+        const double data_bytes = static_cast<double>(factory().get_info_length()) / 8.0;
+
+        bench.add({codec, "encode", 0, data_bytes, max_batch, [make_state](size_t batch, size_t threads)
+                   {
+                       auto state = make_state(batch, threads, 0);
+                       return [state](size_t t)
+                       {
+                           uint64_t sum = 0;
+                           for (size_t i = state->begin(t); i < state->end(t); ++i)
+                           {
+                               sum += state->code.encode(state->data[i]).back();
+                           }
+                           state->sinks[t].value += sum;
+                       };
+                   }});
+
+        for (size_t injected : {size_t{0}, errors})
+        {
+            bench.add({codec, injected == 0 ? "decode_clean" : "decode_errors", injected, data_bytes, max_batch,
+                       [make_state, injected](size_t batch, size_t threads)
+                       {
+                           auto state = make_state(batch, threads, injected);
+                           return [state](size_t t)
+                           {
+                               uint64_t iterations = 0;
+                               for (size_t i = state->begin(t); i < state->end(t); ++i)
+                               {
+                                   iterations += state->code.decode(state->codewords[i], state->workspaces[t]).iterations_used;
+                               }
+                               state->sinks[t].value += iterations;
+                           };
+                       }});
+        }
+    }
+
+    /// LDPCCode names its data length differently from TurboCode
+    class LDPCBenchCode : public LDPCCode
+    {
+    public:
+        using LDPCCode::LDPCCode;
+
+        [[nodiscard]] size_t get_info_length() const noexcept { return get_data_length(); }
+    };
+
+    /// Element-wise field arithmetic, one element per operation
+    template <size_t m>
+    void add_galois_scalar_cases(MicroBenchmark &bench, const std::string &codec)
+    {
+        using Field = GaloisField<m>;
+        using Element = typename Field::Element;
+
+        struct State
+        {
+            const Field *field = &Field::shared();
+            std::vector<Element> a;
+            std::vector<Element> b; // Nonzero
+            std::vector<detail::Sink> sinks;
+            size_t batch = 0;
+            size_t threads = 0;
+
+            [[nodiscard]] size_t begin(size_t t) const noexcept { return detail::slice_begin(batch, threads, t); }
+            [[nodiscard]] size_t end(size_t t) const noexcept { return detail::slice_begin(batch, threads, t + 1); }
+        };
+        auto make_state = [](size_t batch, size_t threads)
+        {
+            auto state = std::make_shared<State>();
+            Xoshiro256 rng(6);
+            state->batch = batch;
+            state->threads = threads;
+            state->sinks.resize(threads);
+            for (size_t i = 0; i < batch; ++i)
+            {
+                state->a.push_back(static_cast<Element>(rng() % Field::field_size));
+                state->b.push_back(static_cast<Element>(1 + rng() % (Field::field_size - 1)));
+            }
+            return state;
+        };
+        constexpr double element_bytes = (m + 7) / 8;
+
+        auto add_op = [&](const char *name, auto op)
+        {
+            bench.add({codec, name, 0, element_bytes, 0, [make_state, op](size_t batch, size_t threads)
+                       {
+                           auto state = make_state(batch, threads);
+                           return [state, op](size_t t)
+                           {
+                               uint64_t acc = 0;
+                               for (size_t i = state->begin(t); i < state->end(t); ++i)
+                               {
+                                   acc ^= op(*state->field, state->a[i], state->b[i]);
+                               }
+                               state->sinks[t].value += acc;
+                           };
+                       }});
+        };
+        add_op("multiply", [](const Field &f, Element a, Element b)
+               { return f.multiply(a, b); });
+        add_op("divide", [](const Field &f, Element a, Element b)
+               { return f.divide(a, b); });
+        add_op("inverse", [](const Field &f, Element, Element b)
+               { return f.inverse(b); });
+    }
+
+    /// GF(2^8) or GF(2^16) region kernels over 4 KiB pages, one page per operation
+    template <size_t m>
+    inline void add_galois_region_cases(MicroBenchmark &bench, const char *codec, uint16_t constant)
+    {
+        using Field = GaloisField<m>;
+        using Word = std::conditional_t<(m == 16), uint16_t, uint8_t>;
+        constexpr size_t page = 4096 / sizeof(Word);
+
+        struct State
+        {
+            const Field *field = &Field::shared();
+            std::vector<Word> src;
+            std::vector<Word> dst;
+            size_t batch = 0;
+            size_t threads = 0;
+
+            [[nodiscard]] std::span<const Word> source(size_t t) const noexcept
+            {
+                return std::span<const Word>(src).subspan(detail::slice_begin(batch, threads, t) * page,
+                                                          detail::slice_size(batch, threads, t) * page);
+            }
+            [[nodiscard]] std::span<Word> destination(size_t t) noexcept
+            {
+                return std::span<Word>(dst).subspan(detail::slice_begin(batch, threads, t) * page,
+                                                    detail::slice_size(batch, threads, t) * page);
+            }
+        };
+        auto make_state = [](size_t batch, size_t threads)
+        {
+            auto state = std::make_shared<State>();
+            Xoshiro256 rng(7);
+            state->batch = batch;
+            state->threads = threads;
+            state->src.resize(batch * page);
+            state->dst.resize(batch * page);
+            for (auto &word : state->src)
+            {
+                word = static_cast<Word>(rng());
+            }
+            return state;
+        };
+
+        auto add_op = [&](const char *name, auto op)
+        {
+            bench.add({codec, name, 0, 4096.0, 1024, [make_state, op](size_t batch, size_t threads)
+                       {
+                           auto state = make_state(batch, threads);
+                           return [state, op](size_t t)
+                           { op(*state->field, state->source(t), state->destination(t)); };
+                       }});
+        };
+        const Word c = static_cast<Word>(constant);
+        add_op("multiply", [c](const Field &f, std::span<const Word> src, std::span<Word> dst)
+               { galois_region::multiply_region(f, c, src, dst); });
+        add_op("mul_add", [c](const Field &f, std::span<const Word> src, std::span<Word> dst)
+               { galois_region::mul_add_region(f, c, src, dst); });
+        add_op("xor", [](const Field &, std::span<const Word> src, std::span<Word> dst)
+               { galois_region::xor_region(src, dst); });
+    }
+
+    /// Channel models over 4096-symbol frames, one frame per operation
+    inline void add_channel_cases(MicroBenchmark &bench)
+    {
+        constexpr size_t frame = 4096;
+        constexpr size_t frame_words = frame / 64;
+        const float sigma = GaussianNoise::sigma_from_snr_db(3.0);
+
+        struct alignas(64) Worker
+        {
+            GaussianNoise noise;
+            Xoshiro256 rng;
+            GeometricSkipSampler sampler;
+            std::vector<float> samples;
+            std::vector<uint64_t> words;
+        };
+        auto make_workers = [](size_t batch, size_t threads, double p)
+        {
+            auto workers = std::make_shared<std::vector<Worker>>();
+            for (size_t t = 0; t < threads; ++t)
+            {
+                const size_t count = detail::slice_size(batch, threads, t);
+                workers->push_back({GaussianNoise(8, t), Xoshiro256(8, t), GeometricSkipSampler(p),
+                                    std::vector<float>(count * frame), std::vector<uint64_t>(count * frame_words)});
+            }
+            return workers;
+        };
+
+        // Payload is the float samples written
+        bench.add({"awgn", "gaussian_fill", 0, frame * sizeof(float), 1024, [make_workers, sigma](size_t batch, size_t threads)
+                   {
+                       auto workers = make_workers(batch, threads, 0.0);
+                       return [workers, sigma](size_t t)
+                       {
+                           Worker &w = (*workers)[t];
+                           w.noise.fill(w.samples, sigma);
+                       };
+                   }});
+
+        bench.add({"awgn", "bpsk_hard_decision", 0, frame / 8.0, 0, [make_workers, sigma](size_t batch, size_t threads)
+                   {
+                       auto workers = make_workers(batch, threads, 0.0);
+                       return [workers, sigma](size_t t)
+                       {
+                           Worker &w = (*workers)[t];
+                           w.noise.bpsk_hard_decision(w.words, w.words.size() * 64, sigma);
+                       };
+                   }});
+
+        for (double p : {1e-3, 1e-1})
+        {
+            std::ostringstream name;
+            name << "flip_p" << p;
+            bench.add({"bsc", name.str(), 0, frame / 8.0, 0, [make_workers, p](size_t batch, size_t threads)
+                       {
+                           auto workers = make_workers(batch, threads, p);
+                           return [workers](size_t t)
+                           {
+                               Worker &w = (*workers)[t];
+                               w.sampler.for_each_event(w.words.size() * 64, w.rng, [&](size_t i)
+                                                        { w.words[i / 64] ^= uint64_t{1} << (i % 64); });
+                           };
+                       }});
+        }
+    }
+
+    inline void add_all_cases(MicroBenchmark &bench)
+    {
+        add_packed_code_cases<Hamming_7_4>(bench, "hamming_7_4", 1);
+        add_packed_code_cases<Hamming_63_57>(bench, "hamming_63_57", 1);
+        add_secded72_cases(bench);
+        add_packed_code_cases<BCHCode<6, 2>>(bench, "bch_63_51", 2);
+        add_packed_code_cases<BCHCode<8, 4>>(bench, "bch_255_223", 4);
+        add_reed_solomon_cases<RS_255_223>(bench, "rs_255_223");
+        add_reed_solomon_cases<RS_255_239>(bench, "rs_255_239");
+        add_iterative_code_cases<LDPCBenchCode>(
+            bench, "ldpc_648_324", []
+            { return LDPCBenchCode(QCBaseGraph::ieee80211n_rate_half(), 27); },
+            4, 1024);
+        add_iterative_code_cases<TurboCode>(
+            bench, "turbo_1024", []
+            { return TurboCode(1024); },
+            16, 64);
+        add_galois_scalar_cases<8>(bench, "gf256");
+        add_galois_scalar_cases<16>(bench, "gf65536");
+        add_galois_region_cases<8>(bench, "gf256_region", 0x53);
+        add_galois_region_cases<16>(bench, "gf65536_region", 0xBEEF);
+        add_channel_cases(bench);
+    }
+
+} // namespace ecc::benchmark
+
+namespace
+{
+    void print_usage(const char *program)
+    {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --filter TEXT         Only cases whose codec/operation contains TEXT\n"
+                  << "  --batch LIST          Comma-separated batch sizes (default 1,64,4096)\n"
+                  << "  --threads LIST        Comma-separated thread counts (default 1 and all cores)\n"
+                  << "  --repetitions N       Timed repetitions per configuration (default 5)\n"
+                  << "  --min-time MS         Minimum duration of one repetition (default 20)\n"
+                  << "  --simd LEVEL          Force scalar, sse4.2, avx2, avx512 or neon kernels\n"
+                  << "  --json FILE           Write results as JSON (- for stdout)\n"
+                  << "  --list                List the cases and exit\n";
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    using namespace ecc::benchmark;
+
+    try
+    {
+        MicroBenchmarkOptions options;
+        const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+        if (cores > 1)
+            options.threads.push_back(cores);
+
+        std::string json_path;
+        bool list = false;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            auto value = [&]() -> std::string
+            {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "--filter")
+                options.filter = value();
+            else if (arg == "--batch")
+                options.batches = detail::parse_size_list(value());
+            else if (arg == "--threads")
+                options.threads = detail::parse_size_list(value());
+            else if (arg == "--repetitions")
+                options.repetitions = static_cast<size_t>(std::stoull(value()));
+            else if (arg == "--min-time")
+                options.min_time_ms = std::stod(value());
+            else if (arg == "--simd")
+            {
+                const std::string name = value();
+                const auto level = ecc::parse_simd_level(name);
+                if (!level)
+                    throw std::invalid_argument("Unknown SIMD level: " + name);
+                ecc::force_simd_level(*level);
+            }
+            else if (arg == "--json")
+                json_path = value();
+            else if (arg == "--list")
+                list = true;
+            else if (arg == "--help" || arg == "-h")
+            {
+                print_usage(argv[0]);
+                return 0;
+            }
+            else
+                throw std::invalid_argument("Unknown option: " + arg);
+        }
+
+        MicroBenchmark bench(options);
+        add_all_cases(bench);
+
+        if (list)
+        {
+            for (const auto &c : bench.get_cases())
+            {
+                std::cout << c.name() << "\n";
+            }
+            return 0;
+        }
+
+        // Keep stdout clean for JSON when it goes there
+        std::ostream &log = json_path == "-" ? std::cerr : std::cout;
+        log << "=== ECC Microbenchmarks (" << ecc::simd_level_name(ecc::active_simd_level()) << ") ===\n\n";
+        MicroBenchmark::print_header(log);
+        const auto results = bench.run([&](const Measurement &m)
+                                       { MicroBenchmark::print_row(m, log); });
+
+        if (json_path == "-")
+        {
+            bench.write_json(results, std::cout);
+        }
+        else if (!json_path.empty())
+        {
+            std::ofstream out(json_path);
+            if (!out)
+                throw std::runtime_error("Cannot open " + json_path);
+            bench.write_json(results, out);
+            log << "\nWrote " << results.size() << " results to " << json_path << "\n";
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
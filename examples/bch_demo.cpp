@@ -1,5 +1,7 @@
 #include "ecc/bch_code.hpp"
 #include "ecc/galois_field.hpp"
+#include "ecc/ldpc_code.hpp"
+#include "ecc/turbo_code.hpp"
 #include <iostream>
 #include <iomanip>
 #include <random>
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "stream_codec.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ecc
+{
+
+    /// Outcome of one batch job
+    struct BatchResult
+    {
+        size_t blocks = 0;            // Blocks encoded or decoded
+        size_t tiles = 0;             // Pool tasks the job was split into
+        size_t corrected_blocks = 0;  // Decode only
+        size_t corrected_symbols = 0; // Decode only
+        size_t failed_blocks = 0;     // Decode only
+    };
+
+    /// Batch encode/decode on a shared work-stealing pool
+    ///
+    /// A job covers any number of blocks of one StreamBlockCodec over caller-owned buffers, which
+    /// must stay alive (and unmodified by the caller) until the job completes. Each job is split
+    /// into tiles of about get_tile_bytes() of input plus output, so one tile's buffers stay in
+    /// cache while it is coded, and completion is reported through a future or a callback. The
+    /// codec must outlive the job and be safe to call concurrently, as StreamBlockCodec requires.
+    class BatchCodecService
+    {
+    public:
+        static constexpr size_t default_tile_bytes = 128 * 1024;
+
+        /// Completion callback: the job's result, or the first exception a tile threw
+        using Callback = std::function<void(const BatchResult &, std::exception_ptr)>;
+
+    private:
+        std::unique_ptr<WorkStealingPool> owned_pool;
+        WorkStealingPool *pool;
+        size_t tile_bytes = default_tile_bytes;
+
+        /// Shared state of the tiles of one job; the last tile to finish reports it
+        struct Job
+        {
+            std::atomic<size_t> remaining{0};
+            std::atomic<bool> failed{false};
+            std::mutex failure_mutex;
+            std::exception_ptr failure;
+            std::vector<StreamCounters> tile_counters;
+            size_t blocks = 0;
+            Callback done;
+        };
+
+        template <typename TileFn>
+        void run_job(size_t blocks, size_t blocks_per_tile, TileFn tile_fn, Callback done)
+        {
+            const size_t tiles = (blocks + blocks_per_tile - 1) / blocks_per_tile;
+
+            auto job = std::make_shared<Job>();
+            job->remaining.store(tiles, std::memory_order_relaxed);
+            job->tile_counters.resize(tiles);
+            job->blocks = blocks;
+            job->done = std::move(done);
+
+            if (tiles == 0)
+            {
+                // Still reported from a pool thread, never from inside the submitting call
+                pool->post([job]
+                           { finish(*job); });
+                return;
+            }
+
+            for (size_t tile = 0; tile < tiles; ++tile)
+            {
+                const size_t begin = tile * blocks_per_tile;
+                const size_t count = std::min(blocks_per_tile, blocks - begin);
+                pool->post([job, tile_fn, tile, begin, count]
+                           {
+                               if (!job->failed.load(std::memory_order_relaxed))
+                               {
+                                   try
+                                   {
+                                       tile_fn(begin, count, job->tile_counters[tile]);
+                                   }
+                                   catch (...)
+                                   {
+                                       std::lock_guard<std::mutex> lock(job->failure_mutex);
+                                       if (!job->failure)
+                                           job->failure = std::current_exception();
+                                       job->failed.store(true, std::memory_order_relaxed);
+                                   }
+                               }
+
+                               if (job->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                                   finish(*job);
+                           });
+            }
+        }
+
+        static void finish(Job &job) noexcept
+        {
+            // Merge in tile order so the result does not depend on scheduling
+            BatchResult result{};
+            result.blocks = job.blocks;
+            result.tiles = job.tile_counters.size();
+            for (const auto &counters : job.tile_counters)
+            {
+                result.corrected_blocks += counters.corrected_blocks;
+                result.corrected_symbols += counters.corrected_symbols;
+                result.failed_blocks += counters.failed_blocks;
+            }
+
+            try
+            {
+                job.done(result, job.failure);
+            }
+            catch (...)
+            {
+                // A throwing callback must not take down the worker
+            }
+        }
+
+        [[nodiscard]] static Callback promise_callback(const std::shared_ptr<std::promise<BatchResult>> &promise)
+        {
+            return [promise](const BatchResult &result, std::exception_ptr failure)
+            {
+                if (failure)
+                    promise->set_exception(failure);
+                else
+                    promise->set_value(result);
+            };
+        }
+
+        template <typename Codec>
+        [[nodiscard]] size_t blocks_per_tile() const noexcept
+        {
+            return std::max<size_t>(1, tile_bytes / (Codec::message_bytes + Codec::block_bytes));
+        }
+
+    public:
+        /// Service with its own pool of `threads` workers (0 = hardware concurrency)
+        explicit BatchCodecService(size_t threads = 0)
+            : owned_pool(std::make_unique<WorkStealingPool>(threads)), pool(owned_pool.get()) {}
+
+        /// Service scheduling on a pool shared with other components (the pool must outlive it)
+        explicit BatchCodecService(WorkStealingPool &shared_pool) : pool(&shared_pool) {}
+
+        /// Input plus output bytes per tile (at least one block per tile)
+        void set_tile_bytes(size_t bytes)
+        {
+            if (bytes == 0)
+                throw std::invalid_argument("Tile size must be positive");
+            tile_bytes = bytes;
+        }
+
+        [[nodiscard]] size_t get_tile_bytes() const noexcept { return tile_bytes; }
+
+        [[nodiscard]] WorkStealingPool &get_pool() noexcept { return *pool; }
+
+        /// Encode whole messages into blocks; calls on_done from a pool thread when the job ends
+        template <StreamBlockCodec Codec>
+        void encode(const Codec &codec, std::span<const uint8_t> messages, std::span<uint8_t> blocks, Callback on_done)
+        {
+            const size_t count = messages.size() / Codec::message_bytes;
+            if (messages.size() % Codec::message_bytes != 0 || blocks.size() != count * Codec::block_bytes)
+                throw std::invalid_argument("Message and block buffer sizes do not match");
+
+            run_job(count, blocks_per_tile<Codec>(), [&codec, messages, blocks](size_t begin, size_t n, StreamCounters &)
+                    { codec.encode(messages.subspan(begin * Codec::message_bytes, n * Codec::message_bytes),
+                                   blocks.subspan(begin * Codec::block_bytes, n * Codec::block_bytes)); },
+                    std::move(on_done));
+        }
+
+        /// Decode blocks into messages; calls on_done from a pool thread when the job ends
+        template <StreamBlockCodec Codec>
+        void decode(const Codec &codec, std::span<const uint8_t> blocks, std::span<uint8_t> messages, Callback on_done)
+        {
+            const size_t count = blocks.size() / Codec::block_bytes;
+            if (blocks.size() % Codec::block_bytes != 0 || messages.size() != count * Codec::message_bytes)
+                throw std::invalid_argument("Block and message buffer sizes do not match");
+
+            run_job(count, blocks_per_tile<Codec>(), [&codec, blocks, messages](size_t begin, size_t n, StreamCounters &counters)
+                    { codec.decode(blocks.subspan(begin * Codec::block_bytes, n * Codec::block_bytes),
+                                   messages.subspan(begin * Codec::message_bytes, n * Codec::message_bytes), counters); },
+                    std::move(on_done));
+        }
+
+        /// Encode with a future for the result
+        template <StreamBlockCodec Codec>
+        [[nodiscard]] std::future<BatchResult> encode(const Codec &codec, std::span<const uint8_t> messages,
+                                                      std::span<uint8_t> blocks)
+        {
+            auto promise = std::make_shared<std::promise<BatchResult>>();
+            auto future = promise->get_future();
+            encode(codec, messages, blocks, promise_callback(promise));
+            return future;
+        }
+
+        /// Decode with a future for the result
+        template <StreamBlockCodec Codec>
+        [[nodiscard]] std::future<BatchResult> decode(const Codec &codec, std::span<const uint8_t> blocks,
+                                                      std::span<uint8_t> messages)
+        {
+            auto promise = std::make_shared<std::promise<BatchResult>>();
+            auto future = promise->get_future();
+            decode(codec, blocks, messages, promise_callback(promise));
+            return future;
+        }
+    };
+
+} // namespace ecc
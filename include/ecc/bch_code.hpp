@@ -1,6 +1,10 @@
 #pragma once
 
 #include "galois_field.hpp"
+#include "decoder_stats.hpp"
+#include "bit_packing.hpp"
+#include "packed_codewords.hpp"
+#include "thread_pool.hpp"
 #include <vector>
 #include <array>
 #include <bitset>
@@ -10,12 +14,142 @@
 #include <concepts>
 #include <span>
 #include <memory>
+#include <optional>
+#include <bit>
+#include <cstdint>
+#include <atomic>
 
 namespace ecc
 {
 
+    namespace detail
+    {
+        /// CRC-style remainder of binary polynomials modulo a fixed divisor g(x)
+        ///
+        /// Polynomials are little-endian bit arrays (bit i is the coefficient of x^i). remainder(a)
+        /// returns x^deg(g) * a(x) mod g(x), consuming a byte per table lookup from the highest degree
+        /// down; the x^deg(g) factor is exactly the shift a systematic encoder needs.
+        template <size_t max_degree>
+        class BinaryDivider
+        {
+        public:
+            static constexpr size_t words = word_count<max_degree>;
+            using Register = std::array<uint64_t, words>;
+
+            BinaryDivider() = default;
+
+            /// Divisor g(x) = x^degree + low(x), deg(low) < degree <= max_degree
+            BinaryDivider(const Register &low, size_t degree) : degree(degree), low(low)
+            {
+                for (size_t bit = 0; bit < degree; ++bit)
+                {
+                    mask[bit / 64] |= 1ull << (bit % 64);
+                }
+
+                for (size_t value = 0; value < 256; ++value)
+                {
+                    Register r{};
+                    for (size_t bit = 8; bit-- > 0;)
+                    {
+                        feed_bit(r, (value >> bit) & 1);
+                    }
+                    table[value] = r;
+                }
+            }
+
+            [[nodiscard]] size_t get_degree() const noexcept
+            {
+                return degree;
+            }
+
+            /// x^degree * a(x) mod g(x) for the `bit_count` low bits of `poly`
+            template <size_t poly_words>
+            [[nodiscard]] Register remainder(const std::array<uint64_t, poly_words> &poly, size_t bit_count) const noexcept
+            {
+                Register r{};
+
+                // Leading bits that do not fill a byte
+                size_t bit = bit_count;
+                for (; bit % 8 != 0; --bit)
+                {
+                    feed_bit(r, (poly[(bit - 1) / 64] >> ((bit - 1) % 64)) & 1);
+                }
+
+                // Whole bytes, highest degree first
+                while (bit > 0)
+                {
+                    bit -= 8;
+                    const uint8_t byte = static_cast<uint8_t>(poly[bit / 64] >> (bit % 64));
+
+                    if (degree >= 8)
+                    {
+                        const uint8_t top = extract_byte(r, degree - 8) ^ byte;
+                        shift_left(r, 8);
+                        for (size_t w = 0; w < words; ++w)
+                        {
+                            r[w] = (r[w] & mask[w]) ^ table[top][w];
+                        }
+                    }
+                    else
+                    {
+                        for (size_t b = 8; b-- > 0;)
+                        {
+                            feed_bit(r, (byte >> b) & 1);
+                        }
+                    }
+                }
+
+                return r;
+            }
+
+        private:
+            size_t degree = 0;
+            Register low{};
+            Register mask{};
+            std::array<Register, 256> table{};
+
+            /// r <- (x * r + bit * x^degree) mod g
+            void feed_bit(Register &r, bool bit) const noexcept
+            {
+                const bool top = ((r[(degree - 1) / 64] >> ((degree - 1) % 64)) & 1) ^ bit;
+                shift_left(r, 1);
+                for (size_t w = 0; w < words; ++w)
+                {
+                    r[w] = (r[w] & mask[w]) ^ (top ? low[w] : 0);
+                }
+            }
+
+            static void shift_left(Register &r, size_t shift) noexcept
+            {
+                for (size_t w = words; w-- > 0;)
+                {
+                    r[w] = (r[w] << shift) | ((w > 0) ? (r[w - 1] >> (64 - shift)) : 0);
+                }
+            }
+
+            [[nodiscard]] static uint8_t extract_byte(const Register &r, size_t position) noexcept
+            {
+                const size_t w = position / 64;
+                const size_t b = position % 64;
+                uint64_t value = r[w] >> b;
+                if (b > 56 && w + 1 < words)
+                {
+                    value |= r[w + 1] << (64 - b);
+                }
+                return static_cast<uint8_t>(value);
+            }
+        };
+    } // namespace detail
+
     /// BCH Code implementation
-    template <size_t m, size_t t>
+    ///
+    /// Bit i of a codeword is the coefficient of x^i: parity occupies bits [0, n-k) and data bit i is
+    /// stored at bit n-k+i. The generator is the product of the distinct minimal polynomials of
+    /// alpha..alpha^(2t); when their degrees sum to less than m*t it is padded with (x + 1) factors so
+    /// that the parity length stays m*t (a subcode with the same designed distance). `Stats` is the
+    /// decoder stats policy (see decoder_stats.hpp); the default records nothing.
+    template <size_t m, size_t t, typename Stats = NoDecoderStats>
+        requires(t >= 1) && (m * t < (1u << m) - 1)
     class BCHCode
     {
     public:
@@ -25,22 +159,50 @@ namespace ecc
         static constexpr size_t parity_length = m * t;
         static constexpr size_t data_length = code_length - parity_length;
         static constexpr size_t min_distance = 2 * t + 1;
+        static constexpr size_t syndrome_count = 2 * t;
 
         using Element = typename GaloisField<m>::Element;
         using Field = GaloisField<m>;
         using Polynomial = GFPolynomial<m>;
         using CodeWord = std::bitset<code_length>;
         using DataWord = std::bitset<data_length>;
+        using Syndromes = std::array<Element, syndrome_count>;
+        using SyndromeValue = Syndromes; // Linear in the error pattern (elementwise XOR)
+
+        /// Packed word representation (layout of detail::to_words and PackedCodewords)
+        using CodeMask = std::array<uint64_t, detail::word_count<code_length>>;
+        using DataMask = std::array<uint64_t, detail::word_count<data_length>>;
 
     private:
-        std::unique_ptr<Field> field;
+        using GeneratorDivider = detail::BinaryDivider<parity_length>;
+        using MinimalDivider = detail::BinaryDivider<m>;
+
+        const Field *field; // Shared per primitive polynomial, see GaloisField::shared()
         Polynomial generator_poly;
-        std::vector<Element> roots;
+        GeneratorDivider generator_divider;
+
+        // One divider per distinct minimal polynomial among alpha..alpha^(2t)
+        std::vector<MinimalDivider> minimal_dividers;
+        std::array<size_t, syndrome_count> syndrome_divider{};
+
+        // Closed-form root tables for the direct small-t decoder (empty until enabled)
+        static constexpr uint16_t no_root = 0xFFFF;
+
+        // Chien search: positions evaluated per step, and range split for long codes
+        static constexpr size_t chien_lanes = 16;
+        static constexpr size_t parallel_chien_min_length = 4095;
+        size_t chien_threads = 1;
+        WorkStealingPool *chien_pool = nullptr;
+
+        std::vector<uint16_t> quadratic_roots; // y with y^2 + y = c
+        std::vector<uint16_t> cubic_roots;     // v with v^3 + v = c
+
+        ECC_NO_UNIQUE_ADDRESS Stats stats;
 
     public:
         /// Constructor with primitive polynomial
         explicit BCHCode(Element primitive_poly)
-            : field(std::make_unique<Field>(primitive_poly))
+            : field(&Field::shared(primitive_poly)), generator_poly(*field)
         {
             generate_bch_polynomial();
         }
@@ -49,44 +211,34 @@ namespace ecc
         BCHCode() : BCHCode(get_default_primitive_poly()) {}
 
         /// Encode data into BCH codeword
-        [[nodiscard]] CodeWord encode(const DataWord &data) const
+        ///
+        /// Parity is x^(n-k) d(x) mod g(x), computed a byte at a time from the generator remainder table.
+        [[nodiscard]] CodeWord encode(const DataWord &data) const noexcept
         {
-            // Convert data to polynomial
-            std::vector<Element> data_coeffs;
-            for (size_t i = 0; i < data_length; ++i)
-            {
-                data_coeffs.push_back(data[i] ? 1 : 0);
-            }
-
-            Polynomial data_poly(field.get(), std::move(data_coeffs));
-
-            // Multiply by x^(parity_length) for systematic encoding
-            std::vector<Element> shifted_coeffs(data_length + parity_length, 0);
-            for (size_t i = 0; i < data_length; ++i)
-            {
-                shifted_coeffs[i + parity_length] = data_poly.coefficient(i);
-            }
-            Polynomial shifted_data(field.get(), std::move(shifted_coeffs));
+            return detail::from_words<code_length>(encode_words(detail::to_words<data_length>(data)));
+        }
 
-            // Calculate remainder
-            auto [quotient, remainder] = shifted_data.divmod(generator_poly);
+        /// Encode a packed data word
+        [[nodiscard]] CodeMask encode_words(const DataMask &data_words) const noexcept
+        {
+            const auto parity = generator_divider.remainder(data_words, data_length);
 
             // Systematic codeword: [parity | data]
-            CodeWord codeword;
+            CodeMask code{};
+            std::copy(parity.begin(), parity.end(), code.begin());
 
-            // Set data bits
-            for (size_t i = 0; i < data_length; ++i)
+            constexpr size_t word_shift = parity_length / 64;
+            constexpr size_t bit_shift = parity_length % 64;
+            for (size_t w = 0; w < data_words.size(); ++w)
             {
-                codeword[i + parity_length] = data[i];
-            }
-
-            // Set parity bits
-            for (size_t i = 0; i < parity_length; ++i)
-            {
-                codeword[i] = remainder.coefficient(i) != 0;
+                code[w + word_shift] |= data_words[w] << bit_shift;
+                if (bit_shift != 0 && w + word_shift + 1 < code.size())
+                {
+                    code[w + word_shift + 1] |= data_words[w] >> (64 - bit_shift);
+                }
             }
 
-            return codeword;
+            return code;
         }
 
         /// Encode vector of data words
@@ -103,6 +255,19 @@ namespace ecc
             return result;
         }
 
+        /// Batch encode of a packed buffer of data words into `out` (packed codewords)
+        void encode(const PackedCodewords &data, PackedCodewords &out) const
+        {
+            if (data.codeword_length() != data_length)
+                throw std::invalid_argument("Packed data words do not match the code dimension");
+
+            out.reshape(code_length, data.size());
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                out.store_words<code_length>(i, encode_words(data.load_words<data_length>(i)));
+            }
+        }
+
         /// Decode with error correction using Berlekamp-Massey algorithm
         struct DecodeResult
         {
@@ -114,56 +279,187 @@ namespace ecc
 
         [[nodiscard]] DecodeResult decode(const CodeWord &received) const
         {
-            // Calculate syndrome
-            std::vector<Element> syndromes = calculate_syndromes(received);
+            CodeMask word = detail::to_words(received);
+            std::array<size_t, t> positions{};
+            const auto corrected = correct_words(word, positions);
+            const size_t degree = corrected.value_or(0);
 
-            // Check if no errors
-            bool no_errors = std::all_of(syndromes.begin(), syndromes.end(),
-                                         [](Element s)
-                                         { return s == 0; });
+            return {detail::from_words<data_length>(extract_data(word)), corrected.has_value(), degree,
+                    std::vector<size_t>(positions.begin(), positions.begin() + degree)};
+        }
 
-            if (no_errors)
+        /// Batch decode of a packed buffer of codewords into `out` (packed data words); returns the
+        /// number of uncorrectable words, whose data is passed through uncorrected
+        ///
+        /// Syndromes, correction and data extraction all run on the packed words.
+        size_t decode(const PackedCodewords &received, PackedCodewords &out) const
+        {
+            if (received.codeword_length() != code_length)
+                throw std::invalid_argument("Packed codewords do not match the code length");
+
+            out.reshape(data_length, received.size());
+            std::array<size_t, t> positions;
+            size_t failures = 0;
+            for (size_t i = 0; i < received.size(); ++i)
             {
-                DataWord data;
-                for (size_t i = 0; i < data_length; ++i)
+                CodeMask word = received.load_words<code_length>(i);
+                failures += !correct_words(word, positions);
+                out.store_words<data_length>(i, extract_data(word));
+            }
+
+            return failures;
+        }
+
+        /// Calculate syndromes S_i = r(alpha^i), i = 1..2t
+        ///
+        /// The received word is reduced modulo g(x) with the byte table in one pass; the short remainder
+        /// is then reduced modulo each minimal polynomial (all divide g) and evaluated at alpha^i.
+        /// Multi-versioned per SIMD level.
+        [[nodiscard]] Syndromes calculate_syndromes(const CodeWord &received) const noexcept
+        {
+            return calculate_syndromes(detail::to_words(received));
+        }
+
+        /// Syndromes of a packed codeword
+        [[nodiscard]] Syndromes calculate_syndromes(const CodeMask &received) const noexcept
+        {
+            constexpr size_t order = code_length;
+
+            return detail::simd_dispatch([&]
+                                         {
+                // x^(n-k) r(x) mod g(x)
+                const auto reduced = generator_divider.remainder(received, code_length);
+
+                std::array<typename MinimalDivider::Register, syndrome_count> remainders{};
+                for (size_t j = 0; j < minimal_dividers.size(); ++j)
+                {
+                    remainders[j] = minimal_dividers[j].remainder(reduced, parity_length);
+                }
+
+                Syndromes syndromes{};
+                for (size_t i = 1; i <= syndrome_count; ++i)
                 {
-                    data[i] = received[i + parity_length];
+                    const size_t j = syndrome_divider[i - 1];
+                    uint64_t bits = remainders[j][0];
+
+                    Element value = 0;
+                    while (bits != 0)
+                    {
+                        const size_t b = static_cast<size_t>(std::countr_zero(bits));
+                        value ^= field->exp(detail::mersenne_reduce<m>(i * b));
+                        bits &= bits - 1;
+                    }
+
+                    // Remove the x^(n-k) * x^deg(M) factor applied by the two divisions
+                    const size_t shift = detail::mersenne_reduce<m>(i * (parity_length + minimal_dividers[j].get_degree()));
+                    syndromes[i - 1] = (value == 0) ? 0 : field->exp(field->log(value) + order - shift);
                 }
-                return {data, true, 0, {}};
+
+                return syndromes; });
+        }
+
+        /// Syndromes of a single error at position pos: S_i = alpha^(i * pos)
+        [[nodiscard]] Syndromes column_syndrome(size_t pos) const noexcept
+        {
+            Syndromes syndromes{};
+            for (size_t i = 1; i <= syndrome_count; ++i)
+            {
+                syndromes[i - 1] = field->exp(detail::mersenne_reduce<m>(i * pos));
             }
+            return syndromes;
+        }
 
-            // Find error locator polynomial using Berlekamp-Massey
-            auto error_locator = berlekamp_massey(syndromes);
+        /// Error positions for a set of syndromes; returns their count (0 for all-zero syndromes), or
+        /// nullopt if the word is uncorrectable. `positions` needs room for t entries.
+        [[nodiscard]] std::optional<size_t> locate_errors(const Syndromes &syndromes, std::span<size_t> positions) const
+        {
+            if (syndromes_zero(syndromes))
+                return 0;
 
-            // Find error positions using Chien search
-            auto error_positions = chien_search(error_locator);
+            std::array<size_t, t> found{};
+            size_t degree = 0;
 
-            // Verify we can correct the errors
-            if (error_positions.size() > t)
+            if (direct_decoding_enabled())
             {
-                DataWord data;
-                for (size_t i = 0; i < data_length; ++i)
-                {
-                    data[i] = received[i + parity_length];
-                }
-                return {data, false, 0, {}};
+                // Closed-form locator and roots, no Chien search
+                degree = direct_decode(syndromes, found);
+                if (degree == 0)
+                    return std::nullopt;
+            }
+            else
+            {
+                // Find error locator polynomial using Berlekamp-Massey
+                Locator locator(*field);
+                degree = berlekamp_massey(syndromes, locator);
+
+                // Find error positions using Chien search
+                if (degree > t || chien_search(locator, degree, found) != degree)
+                    return std::nullopt;
             }
 
-            // Correct errors
-            CodeWord corrected = received;
-            for (size_t pos : error_positions)
+            std::copy_n(found.begin(), degree, positions.begin());
+            return degree;
+        }
+
+        /// True when every syndrome is zero (received word is a codeword)
+        [[nodiscard]] static bool syndromes_zero(const Syndromes &syndromes) noexcept
+        {
+            Element any = 0;
+            for (Element s : syndromes)
             {
-                corrected.flip(pos);
+                any |= s;
             }
+            return any == 0;
+        }
 
-            // Extract data
-            DataWord data;
-            for (size_t i = 0; i < data_length; ++i)
+        /// Build the closed-form decode tables for small t
+        ///
+        /// With the tables in place decode() solves the error locator directly (Peterson's formulas)
+        /// and finds its roots through quadratic/cubic root tables of 2^m entries each, instead of
+        /// running Berlekamp-Massey and a Chien search. Until this is called decode() uses BM.
+        void enable_direct_decoding()
+            requires(t <= 3 && m <= 12)
+        {
+            quadratic_roots.assign(Field::field_size, no_root);
+            cubic_roots.assign(Field::field_size, no_root);
+
+            for (Element x = 0; x < Field::field_size; ++x)
             {
-                data[i] = corrected[i + parity_length];
+                const Element square = field->multiply(x, x);
+                quadratic_roots[square ^ x] = static_cast<uint16_t>(x);
+                cubic_roots[field->multiply(square, x) ^ x] = static_cast<uint16_t>(x);
             }
+        }
+
+        /// Release the direct decode tables (decode() falls back to Berlekamp-Massey)
+        void disable_direct_decoding() noexcept
+        {
+            quadratic_roots = {};
+            cubic_roots = {};
+        }
+
+        [[nodiscard]] bool direct_decoding_enabled() const noexcept
+        {
+            return !quadratic_roots.empty();
+        }
+
+        /// Memory held by the direct decode tables, in bytes
+        [[nodiscard]] size_t direct_decoding_table_bytes() const noexcept
+        {
+            return (quadratic_roots.size() + cubic_roots.size()) * sizeof(uint16_t);
+        }
 
-            return {data, true, error_positions.size(), error_positions};
+        /// Split the Chien search into `threads` position ranges run on `pool` (codes of length >= 4095
+        /// only, 1 = serial); the pool must outlive every decode that uses it
+        void set_chien_threads(size_t threads, WorkStealingPool &pool) noexcept
+        {
+            chien_threads = std::max<size_t>(threads, 1);
+            chien_pool = &pool;
+        }
+
+        [[nodiscard]] size_t get_chien_threads() const noexcept
+        {
+            return chien_threads;
         }
 
         /// Get generator polynomial
@@ -184,148 +480,511 @@ namespace ecc
             return error_capacity;
         }
 
+        /// Decoder counters (a NoDecoderStats policy holds none)
+        [[nodiscard]] const Stats &get_stats() const noexcept
+        {
+            return stats;
+        }
+
     private:
-        /// Generate BCH generator polynomial
+        /// Error locator coefficients Lambda_0..Lambda_2t
+        using Locator = InlineGFPolynomial<m, syndrome_count>;
+        using GeneratorBits = std::array<uint64_t, detail::word_count<parity_length + 1>>;
+
+        /// Correct a packed codeword in place; returns the number of bits flipped (their positions in
+        /// `positions`), or nullopt if uncorrectable, in which case `word` is unchanged
+        std::optional<size_t> correct_words(CodeMask &word, std::array<size_t, t> &positions) const
+        {
+            const Syndromes syndromes = calculate_syndromes(word);
+
+            if (syndromes_zero(syndromes))
+            {
+                stats.record_decode(false, true, 0);
+                return 0;
+            }
+
+            const auto located = locate_errors(syndromes, positions);
+            if (!located)
+            {
+                stats.record_decode(true, false, 0);
+                return std::nullopt;
+            }
+            stats.record_decode(true, true, *located);
+
+            for (size_t i = 0; i < *located; ++i)
+            {
+                word[positions[i] / 64] ^= 1ull << (positions[i] % 64);
+            }
+            return located;
+        }
+
+        /// Data bits n-k..n-1 of a packed codeword, shifted down to bit 0
+        [[nodiscard]] static DataMask extract_data(const CodeMask &code) noexcept
+        {
+            DataMask data{};
+
+            constexpr size_t word_shift = parity_length / 64;
+            constexpr size_t bit_shift = parity_length % 64;
+            for (size_t w = 0; w < data.size(); ++w)
+            {
+                data[w] = code[w + word_shift] >> bit_shift;
+                if (bit_shift != 0 && w + word_shift + 1 < code.size())
+                {
+                    data[w] |= code[w + word_shift + 1] << (64 - bit_shift);
+                }
+            }
+            if constexpr (data_length % 64 != 0)
+            {
+                data.back() &= (1ull << (data_length % 64)) - 1;
+            }
+
+            return data;
+        }
+
+        /// Smallest exponent in the cyclotomic coset of e (mod 2^m - 1)
+        [[nodiscard]] static size_t coset_leader(size_t e) noexcept
+        {
+            size_t leader = e % code_length;
+            size_t current = leader;
+            for (size_t j = 1; j < m; ++j)
+            {
+                current = (current * 2) % code_length;
+                leader = std::min(leader, current);
+            }
+            return leader;
+        }
+
+        /// Minimal polynomial of alpha^e as a bit mask (bit i = coefficient of x^i), and its degree
+        [[nodiscard]] std::pair<uint64_t, size_t> minimal_polynomial(size_t e) const
+        {
+            // prod (x + alpha^c) over the distinct conjugates c of e
+            std::vector<Element> coeffs = {1};
+            size_t c = e % code_length;
+            do
+            {
+                std::vector<Element> next(coeffs.size() + 1, 0);
+                const Element root = field->exp(c);
+                for (size_t i = 0; i < coeffs.size(); ++i)
+                {
+                    next[i + 1] ^= coeffs[i];
+                    next[i] ^= field->multiply(coeffs[i], root);
+                }
+                coeffs = std::move(next);
+                c = (c * 2) % code_length;
+            } while (c != e % code_length);
+
+            uint64_t bits = 0;
+            for (size_t i = 0; i < coeffs.size(); ++i)
+            {
+                if (coeffs[i] > 1)
+                    throw std::runtime_error("Minimal polynomial has non-binary coefficients");
+                bits |= static_cast<uint64_t>(coeffs[i]) << i;
+            }
+            return {bits, coeffs.size() - 1};
+        }
+
+        /// Carry-less product of a generator-sized polynomial with a small one
+        [[nodiscard]] static GeneratorBits multiply_binary(const GeneratorBits &a, uint64_t b, size_t b_degree) noexcept
+        {
+            GeneratorBits result{};
+            for (size_t shift = 0; shift <= b_degree; ++shift)
+            {
+                if (!((b >> shift) & 1))
+                    continue;
+
+                for (size_t w = result.size(); w-- > 0;)
+                {
+                    uint64_t shifted = a[w] << shift;
+                    if (shift != 0 && w > 0)
+                    {
+                        shifted |= a[w - 1] >> (64 - shift);
+                    }
+                    result[w] ^= shifted;
+                }
+            }
+            return result;
+        }
+
+        /// Generate BCH generator polynomial and remainder tables
         void generate_bch_polynomial()
         {
-            // Find consecutive roots: α, α², ..., α^(2t)
-            Element alpha = field->get_primitive();
-            roots.clear();
+            GeneratorBits generator{};
+            generator[0] = 1;
+            size_t degree = 0;
 
-            for (size_t i = 1; i <= 2 * t; ++i)
+            std::vector<size_t> leaders;
+            for (size_t i = 1; i <= syndrome_count; ++i)
             {
-                roots.push_back(field->power(alpha, i));
+                const size_t leader = coset_leader(i);
+                auto it = std::find(leaders.begin(), leaders.end(), leader);
+                if (it != leaders.end())
+                {
+                    syndrome_divider[i - 1] = static_cast<size_t>(it - leaders.begin());
+                    continue;
+                }
+
+                const auto [bits, poly_degree] = minimal_polynomial(leader);
+                generator = multiply_binary(generator, bits, poly_degree);
+                degree += poly_degree;
+
+                syndrome_divider[i - 1] = leaders.size();
+                leaders.push_back(leader);
+                minimal_dividers.emplace_back(typename MinimalDivider::Register{bits & ~(1ull << poly_degree)}, poly_degree);
             }
 
-            // Remove duplicate roots (since we're in GF(2^m))
-            std::sort(roots.begin(), roots.end());
-            roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+            // Pad with (x + 1) so the generator has degree exactly m*t
+            for (; degree < parity_length; ++degree)
+            {
+                generator = multiply_binary(generator, 0b11, 1);
+            }
 
-            // Build generator polynomial as product of minimal polynomials
-            generator_poly = Polynomial(field.get(), {1}); // Start with 1
+            typename GeneratorDivider::Register low{};
+            std::copy_n(generator.begin(), low.size(), low.begin());
+            if constexpr (parity_length % 64 != 0)
+            {
+                low[parity_length / 64] &= ~(1ull << (parity_length % 64)); // Drop the leading x^(m*t)
+            }
+            generator_divider = GeneratorDivider(low, parity_length);
 
-            for (Element root : roots)
+            std::vector<Element> coeffs(parity_length + 1);
+            for (size_t i = 0; i <= parity_length; ++i)
             {
-                // Minimal polynomial (x - root)
-                std::vector<Element> min_poly_coeffs = {root, 1};
-                Polynomial min_poly(field.get(), std::move(min_poly_coeffs));
-                generator_poly = generator_poly * min_poly;
+                coeffs[i] = (generator[i / 64] >> (i % 64)) & 1;
             }
+            generator_poly = Polynomial(*field, std::move(coeffs));
         }
 
-        /// Calculate syndromes
-        [[nodiscard]] std::vector<Element> calculate_syndromes(const CodeWord &received) const
+        /// Multiply by alpha^exponent, exponent < 2^m - 1
+        [[nodiscard]] Element scale(Element a, size_t exponent) const noexcept
         {
-            std::vector<Element> syndromes(2 * t);
+            return (a == 0) ? 0 : field->exp(field->log(a) + exponent);
+        }
 
-            // Convert received word to polynomial
-            std::vector<Element> coeffs;
-            for (size_t i = 0; i < code_length; ++i)
+        /// Square root in GF(2^m) (squaring is a bijection)
+        [[nodiscard]] Element square_root(Element a) const noexcept
+        {
+            return (a == 0) ? 0 : field->exp((field->log(a) * ((code_length + 1) / 2)) % code_length);
+        }
+
+        /// Direct decode for t <= 3: returns the number of errors (0 = uncorrectable) and their positions
+        size_t direct_decode(const Syndromes &S, std::array<size_t, t> &positions) const noexcept
+        {
+            // Locator Lambda(x) = 1 + l1 x + l2 x^2 + l3 x^3 from Peterson's closed forms
+            const Element s1 = S[0];
+            const Element s1_cubed = field->multiply(field->multiply(s1, s1), s1);
+            Element l1 = s1, l2 = 0, l3 = 0;
+            size_t degree = 1;
+
+            if constexpr (t >= 2)
             {
-                coeffs.push_back(received[i] ? 1 : 0);
+                const Element s3 = S[2];
+                const Element d = s1_cubed ^ s3;
+
+                if constexpr (t == 2)
+                {
+                    if (s1 == 0)
+                        return 0;
+                    l2 = field->divide(d, s1);
+                }
+                else
+                {
+                    const Element s5 = S[4];
+                    if (d == 0)
+                    {
+                        // Degenerate system: defer to Berlekamp-Massey for the locator
+                        Locator locator(*field);
+                        degree = berlekamp_massey(S, locator);
+                        if (degree == 0 || degree > t)
+                            return 0;
+                        l1 = locator[1];
+                        l2 = locator[2];
+                        l3 = locator[3];
+                    }
+                    else
+                    {
+                        l2 = field->divide(field->multiply(field->multiply(s1, s1), s3) ^ s5, d);
+                        l3 = d ^ field->multiply(s1, l2);
+                    }
+                }
+
+                degree = (l3 != 0) ? 3 : (l2 != 0) ? 2 : 1;
             }
-            Polynomial received_poly(field.get(), std::move(coeffs));
 
-            // Evaluate at roots
-            Element alpha = field->get_primitive();
-            for (size_t i = 0; i < 2 * t; ++i)
+            // Error locators X are the roots of the reciprocal z^d + l1 z^(d-1) + ... + ld
+            std::array<Element, 3> X{};
+            if (degree == 1)
             {
-                Element root = field->power(alpha, i + 1);
-                syndromes[i] = received_poly.evaluate(root);
+                if (l1 == 0)
+                    return 0;
+                X[0] = l1;
+            }
+            else if (degree == 2)
+            {
+                if (!solve_quadratic(l1, l2, X[0], X[1]))
+                    return 0;
+            }
+            else
+            {
+                if (!solve_cubic(l1, l2, l3, X))
+                    return 0;
             }
 
-            return syndromes;
+            // Accept only if the positions reproduce every odd syndrome (even ones follow in GF(2))
+            for (size_t i = 1; i <= syndrome_count; i += 2)
+            {
+                Element check = 0;
+                for (size_t r = 0; r < degree; ++r)
+                {
+                    check ^= field->exp(detail::mersenne_reduce<m>(field->log(X[r]) * i));
+                }
+                if (check != S[i - 1])
+                    return 0;
+            }
+
+            for (size_t r = 0; r < degree; ++r)
+            {
+                positions[r] = field->log(X[r]);
+            }
+            // Insertion sort bounded by t, so the range provably stays inside `positions`
+            for (size_t i = 1; i < std::min(degree, t); ++i)
+            {
+                for (size_t j = i; j > 0 && positions[j - 1] > positions[j]; --j)
+                {
+                    std::swap(positions[j - 1], positions[j]);
+                }
+            }
+            return degree;
+        }
+
+        /// Distinct non-zero roots of z^2 + a z + b
+        bool solve_quadratic(Element a, Element b, Element &z0, Element &z1) const noexcept
+        {
+            if (a == 0 || b == 0)
+                return false; // Repeated or zero root
+
+            // z = a y  =>  y^2 + y = b / a^2
+            const uint16_t y = quadratic_roots[field->divide(b, field->multiply(a, a))];
+            if (y == no_root)
+                return false;
+
+            z0 = field->multiply(a, y);
+            z1 = z0 ^ a;
+            return true;
+        }
+
+        /// Three distinct non-zero roots of z^3 + a z^2 + b z + c
+        bool solve_cubic(Element a, Element b, Element c, std::array<Element, 3> &z) const noexcept
+        {
+            // z = w + a  =>  w^3 + p w + q = 0
+            const Element p = field->multiply(a, a) ^ b;
+            const Element q = field->multiply(a, b) ^ c;
+            std::array<Element, 3> w{};
+
+            if (p == 0)
+            {
+                // w^3 = q needs three distinct cube roots: only when 3 | 2^m - 1 and q is a cube
+                if (q == 0 || code_length % 3 != 0 || field->log(q) % 3 != 0)
+                    return false;
+
+                const size_t third = code_length / 3;
+                w[0] = field->exp(field->log(q) / 3);
+                w[1] = scale(w[0], third);
+                w[2] = scale(w[0], 2 * third);
+            }
+            else
+            {
+                // w = sqrt(p) v  =>  v^3 + v = q / p^(3/2)
+                const Element root_p = square_root(p);
+                const Element scale_factor = field->multiply(p, root_p);
+                const uint16_t v0 = cubic_roots[field->divide(q, scale_factor)];
+                if (v0 == no_root)
+                    return false;
+
+                // Remaining roots: v^2 + v0 v + (v0^2 + 1) = 0
+                Element v1 = 0, v2 = 0;
+                if (!solve_quadratic(v0, field->multiply(v0, v0) ^ 1, v1, v2))
+                    return false;
+
+                w[0] = field->multiply(root_p, v0);
+                w[1] = field->multiply(root_p, v1);
+                w[2] = field->multiply(root_p, v2);
+            }
+
+            for (size_t r = 0; r < 3; ++r)
+            {
+                z[r] = w[r] ^ a;
+                if (z[r] == 0)
+                    return false;
+            }
+            return z[0] != z[1] && z[0] != z[2] && z[1] != z[2];
         }
 
-        /// Berlekamp-Massey algorithm for finding error locator polynomial
-        [[nodiscard]] Polynomial berlekamp_massey(const std::vector<Element> &syndromes) const
+        /// Berlekamp-Massey: fills the connection polynomial and returns its length L
+        size_t berlekamp_massey(const Syndromes &syndromes, Locator &C) const noexcept
         {
-            Polynomial C(field.get(), {1}); // Error locator polynomial
-            Polynomial B(field.get(), {1}); // Previous error locator polynomial
-            int L = 0;                      // Current length
-            int pos = 1;                    // Current position
-            Element b = 1;                  // Previous discrepancy
+            size_t L = 0;   // Current length
+            size_t pos = 1; // Shift since last length change
+            Element b = 1;  // Discrepancy at last length change
+
+            Locator B(*field); // Previous connection polynomial
+            Locator T(*field); // Temporary
+
+            C.clear();
+            C[0] = 1;
+            B[0] = 1;
 
-            for (size_t n = 0; n < syndromes.size(); ++n)
+            for (size_t i = 0; i < syndrome_count; ++i)
             {
                 // Calculate discrepancy
-                Element d = syndromes[n];
-                for (int i = 1; i <= L; ++i)
+                Element d = syndromes[i];
+                for (size_t j = 1; j <= L; ++j)
                 {
-                    d = field->add(d, field->multiply(C.coefficient(i), syndromes[n - i]));
+                    d ^= field->multiply(C[j], syndromes[i - j]);
                 }
 
                 if (d == 0)
                 {
                     pos++;
+                    continue;
+                }
+
+                // C(x) -= (d / b) x^pos B(x)
+                T = C;
+                C.add_scaled(B, field->divide(d, b), pos);
+
+                if (2 * L <= i)
+                {
+                    L = i + 1 - L;
+                    B = T;
+                    b = d;
+                    pos = 1;
                 }
                 else
                 {
-                    // Update C
-                    Polynomial T = C;
+                    pos++;
+                }
+            }
 
-                    // C(x) = C(x) - (d/b) * x^pos * B(x)
-                    Element coeff = field->divide(d, b);
-                    std::vector<Element> term_coeffs(pos + B.degree() + 1, 0);
-                    for (int i = 0; i <= B.degree(); ++i)
-                    {
-                        term_coeffs[i + pos] = field->multiply(coeff, B.coefficient(i));
-                    }
-                    Polynomial correction(field.get(), std::move(term_coeffs));
-                    C = C + correction;
+            stats.record(DecoderEvent::Iterations, syndrome_count);
+            return L;
+        }
 
-                    if (2 * L <= static_cast<int>(n))
-                    {
-                        L = static_cast<int>(n) + 1 - L;
-                        B = T;
-                        b = d;
-                        pos = 1;
-                    }
-                    else
-                    {
-                        pos++;
-                    }
-                }
+        /// Chien search: bit positions i with Lambda(alpha^-i) = 0, returns how many were found
+        ///
+        /// Positions are scanned chien_lanes at a time; with set_chien_threads() > 1 long codes split
+        /// the position range into tasks on the Chien pool. The scan stops once `degree` roots are found.
+        size_t chien_search(const Locator &locator, size_t degree, std::array<size_t, t> &positions) const
+        {
+            if (chien_threads <= 1 || code_length < parallel_chien_min_length || degree == 0)
+            {
+                return chien_range(locator, degree, 0, code_length, positions, nullptr);
             }
 
-            return C;
+            const size_t threads = std::min(chien_threads, code_length / chien_lanes);
+            const size_t chunk = ((code_length + threads - 1) / threads + chien_lanes - 1) / chien_lanes * chien_lanes;
+
+            std::atomic<size_t> total_found{0};
+            std::vector<std::array<size_t, t>> partial(threads);
+            std::vector<size_t> counts(threads, 0);
+
+            // Range 0 runs on the calling thread
+            TaskGroup group(*chien_pool);
+            for (size_t th = 1; th < threads; ++th)
+            {
+                const size_t begin = std::min(code_length, th * chunk);
+                const size_t end = std::min(code_length, begin + chunk);
+                group.run([&, th, begin, end]
+                          { counts[th] = chien_range(locator, degree, begin, end, partial[th], &total_found); });
+            }
+            counts[0] = chien_range(locator, degree, 0, std::min(code_length, chunk), partial[0], &total_found);
+            group.wait();
+
+            // Ranges are in ascending order, so concatenation keeps positions sorted
+            size_t found = 0;
+            for (size_t th = 0; th < threads; ++th)
+            {
+                for (size_t r = 0; r < counts[th] && found < t; ++r)
+                {
+                    positions[found++] = partial[th][r];
+                }
+            }
+            return found;
         }
 
-        /// Chien search for finding roots of error locator polynomial
-        [[nodiscard]] std::vector<size_t> chien_search(const Polynomial &error_locator) const
+        /// Chien search over [begin, end), chien_lanes positions per step
+        ///
+        /// Lane l of term j holds log(Lambda_j alpha^(-j(i + l))); a step adds the per-term constant
+        /// -j * chien_lanes to every lane, which the compiler turns into vector adds, and the lane sums
+        /// are exp-table lookups. `shared_found` lets parallel ranges stop once all roots are known.
+        size_t chien_range(const Locator &locator, size_t degree, size_t begin, size_t end,
+                           std::array<size_t, t> &positions, std::atomic<size_t> *shared_found) const noexcept
         {
-            std::vector<size_t> error_positions;
+            constexpr size_t order = code_length;
+            constexpr size_t lanes = chien_lanes;
+            const auto &exp_table = field->get_tables().exp_table;
+
+            // Only non-zero coefficients contribute; collect them with their lane offsets
+            std::array<std::array<uint32_t, lanes>, t> logs{};
+            std::array<uint32_t, t> steps{};
+            size_t active = 0;
 
-            Element alpha = field->get_primitive();
-            for (size_t i = 0; i < code_length; ++i)
+            for (size_t j = 1; j <= degree; ++j)
             {
-                Element alpha_inv = field->power(alpha, code_length - 1 - i);
-                if (error_locator.evaluate(alpha_inv) == 0)
+                if (locator[j] == 0)
+                    continue;
+
+                const uint64_t coefficient_log = field->log(locator[j]);
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    const uint64_t position = (begin + lane) % order;
+                    logs[active][lane] = static_cast<uint32_t>((coefficient_log + (order - j) * position) % order);
+                }
+                steps[active] = static_cast<uint32_t>((order - (j * lanes) % order) % order);
+                ++active;
+            }
+
+            size_t found = 0;
+            for (size_t base = begin; base < end; base += lanes)
+            {
+                std::array<Element, lanes> sums;
+                sums.fill(locator[0]);
+
+                for (size_t a = 0; a < active; ++a)
                 {
-                    error_positions.push_back(i);
+                    auto &row = logs[a];
+                    const uint32_t step = steps[a];
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        sums[lane] ^= exp_table[row[lane]];
+                        const uint32_t next = row[lane] + step;
+                        row[lane] = (next >= order) ? next - static_cast<uint32_t>(order) : next;
+                    }
                 }
+
+                const size_t valid = std::min(lanes, end - base);
+                for (size_t lane = 0; lane < valid; ++lane)
+                {
+                    if (sums[lane] == 0 && found < t)
+                    {
+                        positions[found++] = base + lane;
+                        if (shared_found)
+                        {
+                            shared_found->fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                if (found >= degree || (shared_found && shared_found->load(std::memory_order_relaxed) >= degree))
+                    break;
             }
 
-            return error_positions;
+            return found;
         }
 
         /// Get default primitive polynomial for common field orders
         [[nodiscard]] static constexpr Element get_default_primitive_poly() noexcept
         {
-            if constexpr (m == 3)
-                return 0x0B; // x³ + x + 1
-            else if constexpr (m == 4)
-                return 0x13; // x⁴ + x + 1
-            else if constexpr (m == 5)
-                return 0x25; // x⁵ + x² + 1
-            else if constexpr (m == 6)
-                return 0x43; // x⁶ + x + 1
-            else if constexpr (m == 7)
-                return 0x89; // x⁷ + x³ + 1
-            else if constexpr (m == 8)
-                return 0x11D; // x⁸ + x⁴ + x³ + x² + 1
-            else
-                static_assert(m <= 8, "Default primitive polynomial not available for this field order");
+            return detail::default_primitive_poly<m>();
         }
     };
 
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstring>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecc
+{
+
+    namespace detail
+    {
+        /// Number of 64-bit words needed to hold `bits` bits
+        template <size_t bits>
+        inline constexpr size_t word_count = (bits + 63) / 64;
+
+        /// True when std::bitset<bits> stores its bits as plain little-endian words (libstdc++ and
+        /// libc++ on little-endian targets), so it can be packed and unpacked with memcpy
+        template <size_t bits>
+        inline constexpr bool bitset_is_word_array =
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+            std::endian::native == std::endian::little &&
+            std::is_trivially_copyable_v<std::bitset<bits>> &&
+            sizeof(std::bitset<bits>) <= word_count<bits> * sizeof(uint64_t) &&
+            sizeof(std::bitset<bits>) * 8 >= bits;
+#else
+            false;
+#endif
+
+        /// Pack a bitset into little-endian 64-bit words (bit i -> word i/64, bit i%64)
+        template <size_t bits>
+        [[nodiscard]] inline std::array<uint64_t, word_count<bits>> to_words(const std::bitset<bits> &value) noexcept
+        {
+            std::array<uint64_t, word_count<bits>> words{};
+
+            if constexpr (bits <= 64)
+            {
+                words[0] = value.to_ullong();
+            }
+            else if constexpr (bitset_is_word_array<bits>)
+            {
+                std::memcpy(words.data(), &value, sizeof(value));
+            }
+            else
+            {
+                const std::bitset<bits> low_mask(~0ull);
+                for (size_t w = 0; w < words.size(); ++w)
+                {
+                    words[w] = ((value >> (64 * w)) & low_mask).to_ullong();
+                }
+            }
+
+            return words;
+        }
+
+        /// Unpack little-endian 64-bit words back into a bitset
+        template <size_t bits>
+        [[nodiscard]] inline std::bitset<bits> from_words(const std::array<uint64_t, word_count<bits>> &words) noexcept
+        {
+            if constexpr (bits <= 64)
+            {
+                return std::bitset<bits>(words[0]);
+            }
+            else if constexpr (bitset_is_word_array<bits>)
+            {
+                // Bits above `bits` must stay clear inside the bitset
+                std::array<uint64_t, word_count<bits>> masked = words;
+                if constexpr (bits % 64 != 0)
+                {
+                    masked.back() &= (1ull << (bits % 64)) - 1;
+                }
+
+                std::bitset<bits> value;
+                std::memcpy(static_cast<void *>(&value), masked.data(), sizeof(value));
+                return value;
+            }
+            else
+            {
+                std::bitset<bits> value;
+                for (size_t w = words.size(); w-- > 0;)
+                {
+                    value <<= 64;
+                    value |= std::bitset<bits>(words[w]);
+                }
+                return value;
+            }
+        }
+    } // namespace detail
+
+} // namespace ecc
@@ -0,0 +1,465 @@
+#pragma once
+
+#include "reed_solomon.hpp"
+#include "bch_code.hpp"
+#include "ldpc_code.hpp"
+#include "spsc_ring.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <exception>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecc
+{
+
+    /// Inner binary code of a ConcatenatedCode, on 0/1 byte symbols
+    ///
+    /// encode() maps data_bits() bits to code_bits() bits; decode() does the reverse, returns false
+    /// when the block is detected as uncorrectable, and keeps its scratch state in a Workspace (one
+    /// per thread), as LDPCCode and TurboCode do.
+    template <typename T>
+    concept InnerBinaryCode = requires(const T code, std::span<const uint8_t> in, std::span<uint8_t> out,
+                                       typename T::Workspace &workspace) {
+        { code.data_bits() } -> std::convertible_to<size_t>;
+        { code.code_bits() } -> std::convertible_to<size_t>;
+        { code.make_workspace() } -> std::same_as<typename T::Workspace>;
+        code.encode(in, out);
+        { code.decode(in, out, workspace) } -> std::same_as<bool>;
+    };
+
+    /// Binary BCH code as an inner code
+    template <typename Code>
+    class BCHInnerCode
+    {
+    private:
+        Code code;
+
+    public:
+        struct Workspace
+        {
+        };
+
+        [[nodiscard]] static constexpr size_t data_bits() noexcept { return Code::data_length; }
+        [[nodiscard]] static constexpr size_t code_bits() noexcept { return Code::code_length; }
+        [[nodiscard]] Workspace make_workspace() const noexcept { return {}; }
+
+        void encode(std::span<const uint8_t> data, std::span<uint8_t> codeword) const
+        {
+            typename Code::DataWord word;
+            for (size_t i = 0; i < Code::data_length; ++i)
+            {
+                word[i] = data[i] != 0;
+            }
+            const auto encoded = code.encode(word);
+            for (size_t i = 0; i < Code::code_length; ++i)
+            {
+                codeword[i] = encoded[i] ? 1 : 0;
+            }
+        }
+
+        [[nodiscard]] bool decode(std::span<const uint8_t> received, std::span<uint8_t> data, Workspace &) const
+        {
+            typename Code::CodeWord word;
+            for (size_t i = 0; i < Code::code_length; ++i)
+            {
+                word[i] = received[i] != 0;
+            }
+            const auto result = code.decode(word);
+            for (size_t i = 0; i < Code::data_length; ++i)
+            {
+                data[i] = result.data[i] ? 1 : 0;
+            }
+            return result.success;
+        }
+
+        [[nodiscard]] const Code &get_code() const noexcept { return code; }
+    };
+
+    /// LDPC code (hard-decision input) as an inner code; decode fails when checks stay unsatisfied
+    template <typename Stats = NoDecoderStats>
+    class LDPCInnerCode
+    {
+    private:
+        using Code = BasicLDPCCode<Stats>;
+        Code code;
+
+    public:
+        /// Decoder state; its hard decisions double as the decoded block
+        using Workspace = typename Code::Workspace;
+
+        explicit LDPCInnerCode(Code ldpc) : code(std::move(ldpc)) {}
+
+        [[nodiscard]] size_t data_bits() const noexcept { return code.get_data_length(); }
+        [[nodiscard]] size_t code_bits() const noexcept { return code.get_code_length(); }
+
+        [[nodiscard]] Workspace make_workspace() const { return code.make_workspace(); }
+
+        void encode(std::span<const uint8_t> data, std::span<uint8_t> codeword) const
+        {
+            std::copy(data.begin(), data.end(), codeword.begin());
+            code.encode_parity(codeword);
+        }
+
+        [[nodiscard]] bool decode(std::span<const uint8_t> received, std::span<uint8_t> data, Workspace &workspace) const
+        {
+            const bool success = code.decode_into(received, workspace);
+            std::copy_n(workspace.hard_decision.begin(), data.size(), data.begin());
+            return success;
+        }
+
+        [[nodiscard]] const Code &get_code() const noexcept { return code; }
+    };
+
+    /// Row-column symbol interleaver: channel symbol p is symbol p / depth of outer codeword p % depth
+    ///
+    /// Consecutive channel symbols come from different outer codewords, so a burst of b symbols (for
+    /// example one failed inner block) costs each outer codeword at most ceil(b / depth) symbols.
+    struct BlockInterleaver
+    {
+        [[nodiscard]] static constexpr size_t source(size_t position, size_t depth, size_t length) noexcept
+        {
+            return (position % depth) * length + position / depth;
+        }
+    };
+
+    /// Counters of decoded concatenated frames
+    struct ConcatenatedDecodeResult
+    {
+        size_t frames = 0;
+        size_t inner_blocks = 0;
+        size_t inner_failures = 0;    // Inner blocks detected as uncorrectable
+        size_t erased_symbols = 0;    // Outer symbols erased because their inner block failed
+        size_t outer_codewords = 0;
+        size_t corrected_symbols = 0; // Outer symbols changed by the RS decoder
+        size_t outer_failures = 0;    // Outer codewords left uncorrectable (data passed through)
+
+        void merge(const ConcatenatedDecodeResult &other) noexcept
+        {
+            frames += other.frames;
+            inner_blocks += other.inner_blocks;
+            inner_failures += other.inner_failures;
+            erased_symbols += other.erased_symbols;
+            outer_codewords += other.outer_codewords;
+            corrected_symbols += other.corrected_symbols;
+            outer_failures += other.outer_failures;
+        }
+    };
+
+    /// Serially concatenated code: outer Reed-Solomon over GF(2^8), symbol interleaver, inner binary code
+    ///
+    /// A frame is `depth` outer codewords. Their n * depth bytes are interleaved, sent LSB first as
+    /// bits, and cut into inner blocks of data_bits() (the last one zero-padded), so one frame is
+    /// inner_blocks() * code_bits() channel bits carrying depth * k message bytes. The decoder marks
+    /// every outer symbol touched by a failed inner block as an erasure, and an outer codeword with
+    /// at most n-k erasures is decoded for errors and erasures (otherwise for errors only).
+    ///
+    /// All layers of a frame work in place on the buffers of one Workspace, which is sized once.
+    /// decode_frames() runs the inner and the outer decoder as two overlapping pipeline stages.
+    template <typename Outer, typename Inner, typename Interleaver = BlockInterleaver>
+        requires(Outer::symbol_size == 8) && InnerBinaryCode<Inner>
+    class ConcatenatedCode
+    {
+    public:
+        static constexpr size_t outer_length = Outer::code_length;
+        static constexpr size_t outer_data_length = Outer::data_length;
+        static constexpr size_t outer_parity = Outer::parity_length;
+
+        /// Buffers of one frame in flight
+        struct Workspace
+        {
+            std::vector<uint8_t> codewords; // depth outer codewords, codeword-major
+            std::vector<uint8_t> bits;      // Interleaved symbol bits, inner_blocks() * data_bits()
+            std::vector<uint8_t> erased;    // Erasure flag per outer symbol (codeword-major)
+            std::vector<uint8_t> failed;    // Failure flag per inner block
+            typename Inner::Workspace inner;
+        };
+
+    private:
+        Outer outer;
+        Inner inner;
+        size_t depth;
+        size_t blocks;
+
+        static constexpr size_t pipeline_slots = 2; // Frames buffered between the decoder stages
+
+    public:
+        /// `depth` outer codewords per frame, interleaved together
+        explicit ConcatenatedCode(Inner inner_code, size_t interleaver_depth = 1)
+            : inner(std::move(inner_code)), depth(interleaver_depth)
+        {
+            if (depth == 0)
+                throw std::invalid_argument("Interleaver depth must be positive");
+            if (inner.data_bits() == 0)
+                throw std::invalid_argument("Inner code must carry data bits");
+            blocks = (depth * outer_length * 8 + inner.data_bits() - 1) / inner.data_bits();
+        }
+
+        [[nodiscard]] size_t get_depth() const noexcept { return depth; }
+        [[nodiscard]] size_t inner_blocks() const noexcept { return blocks; }
+        [[nodiscard]] size_t message_bytes() const noexcept { return depth * outer_data_length; }
+        [[nodiscard]] size_t channel_bits() const noexcept { return blocks * inner.code_bits(); }
+
+        /// Message bits over channel bits
+        [[nodiscard]] double get_code_rate() const noexcept
+        {
+            return static_cast<double>(8 * message_bytes()) / channel_bits();
+        }
+
+        [[nodiscard]] const Outer &get_outer() const noexcept { return outer; }
+        [[nodiscard]] const Inner &get_inner() const noexcept { return inner; }
+
+        /// Workspace sized for this code (no reallocation once made)
+        [[nodiscard]] Workspace make_workspace() const
+        {
+            Workspace workspace;
+            workspace.codewords.resize(depth * outer_length);
+            workspace.bits.resize(blocks * inner.data_bits());
+            workspace.erased.resize(depth * outer_length);
+            workspace.failed.resize(blocks);
+            workspace.inner = inner.make_workspace();
+            return workspace;
+        }
+
+        /// Encode one frame: message_bytes() bytes into channel_bits() 0/1 bytes
+        void encode(std::span<const uint8_t> message, std::span<uint8_t> channel, Workspace &workspace) const
+        {
+            if (message.size() != message_bytes() || channel.size() != channel_bits())
+                throw std::invalid_argument("Message or channel buffer does not match the frame size");
+
+            outer.encode_bytes(message, workspace.codewords);
+
+            // Interleave the symbols straight into the bit buffer, then encode every inner block
+            const size_t symbols = depth * outer_length;
+            for (size_t p = 0; p < symbols; ++p)
+            {
+                const uint8_t symbol = workspace.codewords[Interleaver::source(p, depth, outer_length)];
+                for (size_t b = 0; b < 8; ++b)
+                {
+                    workspace.bits[8 * p + b] = (symbol >> b) & 1;
+                }
+            }
+            std::fill(workspace.bits.begin() + 8 * symbols, workspace.bits.end(), uint8_t{0});
+
+            const size_t data_bits = inner.data_bits();
+            const size_t code_bits = inner.code_bits();
+            for (size_t block = 0; block < blocks; ++block)
+            {
+                inner.encode(std::span<const uint8_t>(workspace.bits).subspan(block * data_bits, data_bits),
+                             channel.subspan(block * code_bits, code_bits));
+            }
+        }
+
+        /// Encode whole frames back to back (messages.size() a multiple of message_bytes())
+        void encode_frames(std::span<const uint8_t> messages, std::span<uint8_t> channel) const
+        {
+            const size_t frames = frame_count(messages.size(), channel.size());
+            Workspace workspace = make_workspace();
+            for (size_t f = 0; f < frames; ++f)
+            {
+                encode(messages.subspan(f * message_bytes(), message_bytes()),
+                       channel.subspan(f * channel_bits(), channel_bits()), workspace);
+            }
+        }
+
+        /// Decode one frame of channel_bits() 0/1 bytes into message_bytes() bytes
+        ConcatenatedDecodeResult decode(std::span<const uint8_t> channel, std::span<uint8_t> message,
+                                        Workspace &workspace) const
+        {
+            if (message.size() != message_bytes() || channel.size() != channel_bits())
+                throw std::invalid_argument("Message or channel buffer does not match the frame size");
+
+            ConcatenatedDecodeResult result;
+            decode_inner(channel, workspace, result);
+            decode_outer(workspace, message, result);
+            return result;
+        }
+
+        /// Decode whole frames with the inner and outer decoders overlapping
+        ///
+        /// A worker thread runs the inner decoder and deinterleaver of frame f + 1 while the calling
+        /// thread runs the RS decoder of frame f; the frames travel through SPSC rings in two
+        /// recycled workspaces. Counters are summed over all frames.
+        ConcatenatedDecodeResult decode_frames(std::span<const uint8_t> channel, std::span<uint8_t> messages) const
+        {
+            const size_t frames = frame_count(messages.size(), channel.size());
+            ConcatenatedDecodeResult total;
+            if (frames <= 1)
+            {
+                if (frames == 1)
+                {
+                    Workspace workspace = make_workspace();
+                    total = decode(channel, messages, workspace);
+                }
+                return total;
+            }
+
+            std::array<Workspace, pipeline_slots> slots;
+            SpscRing<Workspace *> free_slots(pipeline_slots);
+            SpscRing<Workspace *> inner_done(pipeline_slots);
+            for (auto &slot : slots)
+            {
+                slot = make_workspace();
+                (void)free_slots.try_push(&slot);
+            }
+
+            std::array<ConcatenatedDecodeResult, 2> counters; // Inner stage, outer stage
+            std::atomic<bool> aborted{false};
+            std::exception_ptr inner_failure;
+            std::exception_ptr outer_failure;
+
+            // Spin (yielding) on `attempt`; false once the other stage has failed
+            auto wait_for = [&](auto &&attempt)
+            {
+                while (!attempt())
+                {
+                    if (aborted.load(std::memory_order_relaxed))
+                        return false;
+                    std::this_thread::yield();
+                }
+                return true;
+            };
+
+            std::thread inner_stage([&]
+                                    {
+                try
+                {
+                    for (size_t f = 0; f < frames; ++f)
+                    {
+                        Workspace *slot = nullptr;
+                        if (!wait_for([&]
+                                      { return free_slots.try_pop(slot); }))
+                            return;
+                        decode_inner(channel.subspan(f * channel_bits(), channel_bits()), *slot, counters[0]);
+                        if (!wait_for([&]
+                                      { return inner_done.try_push(slot); }))
+                            return;
+                    }
+                }
+                catch (...)
+                {
+                    inner_failure = std::current_exception();
+                    aborted.store(true, std::memory_order_relaxed);
+                } });
+
+            try
+            {
+                for (size_t f = 0; f < frames; ++f)
+                {
+                    Workspace *slot = nullptr;
+                    if (!wait_for([&]
+                                  { return inner_done.try_pop(slot); }))
+                        break;
+                    decode_outer(*slot, messages.subspan(f * message_bytes(), message_bytes()), counters[1]);
+                    (void)free_slots.try_push(slot); // Never full: only pipeline_slots slots exist
+                }
+            }
+            catch (...)
+            {
+                outer_failure = std::current_exception();
+                aborted.store(true, std::memory_order_relaxed);
+            }
+            inner_stage.join();
+
+            if (inner_failure)
+                std::rethrow_exception(inner_failure);
+            if (outer_failure)
+                std::rethrow_exception(outer_failure);
+
+            total.merge(counters[0]);
+            total.merge(counters[1]);
+            return total;
+        }
+
+    private:
+        /// Frames in a message/channel buffer pair (checks that both hold the same whole number)
+        [[nodiscard]] size_t frame_count(size_t message_size, size_t channel_size) const
+        {
+            const size_t frames = message_size / message_bytes();
+            if (message_size % message_bytes() != 0 || channel_size != frames * channel_bits())
+                throw std::invalid_argument("Message and channel buffer sizes do not match");
+            return frames;
+        }
+
+        /// Inner decode of every block, then deinterleave the symbols and their erasure flags
+        void decode_inner(std::span<const uint8_t> channel, Workspace &workspace, ConcatenatedDecodeResult &result) const
+        {
+            const size_t data_bits = inner.data_bits();
+            const size_t code_bits = inner.code_bits();
+            for (size_t block = 0; block < blocks; ++block)
+            {
+                const bool success = inner.decode(channel.subspan(block * code_bits, code_bits),
+                                                  std::span<uint8_t>(workspace.bits).subspan(block * data_bits, data_bits),
+                                                  workspace.inner);
+                workspace.failed[block] = success ? 0 : 1;
+                result.inner_failures += !success;
+            }
+            result.inner_blocks += blocks;
+            ++result.frames;
+
+            const size_t symbols = depth * outer_length;
+            for (size_t p = 0; p < symbols; ++p)
+            {
+                uint8_t symbol = 0;
+                for (size_t b = 0; b < 8; ++b)
+                {
+                    symbol |= static_cast<uint8_t>((workspace.bits[8 * p + b] & 1) << b);
+                }
+
+                // The symbol's bits span one inner block or straddle two
+                const size_t first = (8 * p) / data_bits;
+                const size_t last = (8 * p + 7) / data_bits;
+                const uint8_t erased = workspace.failed[first] | workspace.failed[last];
+
+                const size_t index = Interleaver::source(p, depth, outer_length);
+                workspace.codewords[index] = symbol;
+                workspace.erased[index] = erased;
+            }
+        }
+
+        /// Errors-and-erasures RS decode of every outer codeword of a deinterleaved frame
+        void decode_outer(const Workspace &workspace, std::span<uint8_t> message, ConcatenatedDecodeResult &result) const
+        {
+            std::array<size_t, outer_length> erasures;
+            typename Outer::CodeWord received;
+
+            for (size_t r = 0; r < depth; ++r)
+            {
+                const uint8_t *codeword = workspace.codewords.data() + r * outer_length;
+                const uint8_t *erased = workspace.erased.data() + r * outer_length;
+
+                size_t erasure_count = 0;
+                for (size_t i = 0; i < outer_length; ++i)
+                {
+                    received[i] = codeword[i];
+                    if (erased[i])
+                    {
+                        erasures[erasure_count++] = i;
+                    }
+                }
+                result.erased_symbols += erasure_count;
+
+                // Past n-k erasures the flags cannot help, but the symbols may still be mostly right
+                const std::span<const size_t> known(erasures.data(), erasure_count <= outer_parity ? erasure_count : 0);
+                const auto decoded = outer.decode_fixed(received, known);
+
+                uint8_t *out = message.data() + r * outer_data_length;
+                for (size_t i = 0; i < outer_data_length; ++i)
+                {
+                    out[i] = static_cast<uint8_t>(decoded.data[i]);
+                }
+                ++result.outer_codewords;
+                result.corrected_symbols += decoded.success ? decoded.errors_corrected : 0;
+                result.outer_failures += !decoded.success;
+            }
+        }
+    };
+
+} // namespace ecc
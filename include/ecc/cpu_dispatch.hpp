@@ -0,0 +1,270 @@
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+/// Per-function instruction set targets for the multi-versioned kernels
+///
+/// GCC and Clang compile a function marked ECC_TARGET_AVX2 with AVX2 enabled whatever the command line
+/// says, so one portable build carries every variant; ECC_FLATTEN inlines the kernel body into that
+/// variant. AVX-512 implies FMA, so its variant turns off a*b+c contraction (GCC through the target,
+/// Clang through ECC_NO_FP_CONTRACT in float kernels) to keep results identical across levels. MSVC
+/// has no per-function targets: intrinsic kernels still dispatch, auto-vectorized ones run at the
+/// /arch level of the build.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ECC_X86_DISPATCH 1
+#define ECC_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#define ECC_TARGET_AVX2 __attribute__((target("avx2,bmi,bmi2,popcnt")))
+#if defined(__clang__)
+#define ECC_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,bmi,bmi2,popcnt")))
+#else
+#define ECC_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,bmi,bmi2,popcnt"), optimize("fp-contract=off")))
+#endif
+#define ECC_FLATTEN __attribute__((flatten))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define ECC_X86_DISPATCH 1
+#define ECC_TARGET_SSE42
+#define ECC_TARGET_AVX2
+#define ECC_TARGET_AVX512
+#define ECC_FLATTEN
+#endif
+
+#if defined(__clang__)
+#define ECC_NO_FP_CONTRACT _Pragma("clang fp contract(off)")
+#else
+#define ECC_NO_FP_CONTRACT
+#endif
+
+namespace ecc
+{
+
+    /// Instruction set levels with dedicated kernel variants, in increasing order on x86
+    enum class SimdLevel : uint8_t
+    {
+        Scalar,
+        SSE42,
+        AVX2,
+        AVX512, // F + BW + DQ + VL
+        NEON
+    };
+
+    [[nodiscard]] constexpr const char *simd_level_name(SimdLevel level) noexcept
+    {
+        switch (level)
+        {
+        case SimdLevel::SSE42:
+            return "sse4.2";
+        case SimdLevel::AVX2:
+            return "avx2";
+        case SimdLevel::AVX512:
+            return "avx512";
+        case SimdLevel::NEON:
+            return "neon";
+        default:
+            return "scalar";
+        }
+    }
+
+    /// Level named "scalar", "sse4.2", "avx2", "avx512" or "neon"
+    [[nodiscard]] constexpr std::optional<SimdLevel> parse_simd_level(std::string_view name) noexcept
+    {
+        for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE42, SimdLevel::AVX2, SimdLevel::AVX512, SimdLevel::NEON})
+        {
+            if (name == simd_level_name(level))
+                return level;
+        }
+        return std::nullopt;
+    }
+
+    namespace detail
+    {
+#if defined(ECC_X86_DISPATCH)
+        inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) noexcept
+        {
+#if defined(_MSC_VER)
+            int out[4];
+            __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (int i = 0; i < 4; ++i)
+            {
+                regs[i] = static_cast<uint32_t>(out[i]);
+            }
+#else
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        }
+
+        /// XCR0: register state the OS saves on context switches
+        inline uint64_t xgetbv0() noexcept
+        {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            uint32_t low, high;
+            __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+        }
+#endif
+
+        /// Highest level this CPU and OS support, from CPUID and XCR0
+        [[nodiscard]] inline SimdLevel detect_simd_level() noexcept
+        {
+#if defined(ECC_X86_DISPATCH)
+            uint32_t regs[4];
+            cpuid(0, 0, regs);
+            const uint32_t max_leaf = regs[0];
+
+            cpuid(1, 0, regs);
+            const uint32_t ecx1 = regs[2];
+            const bool ssse3 = ecx1 & (1u << 9);
+            const bool sse42 = ecx1 & (1u << 20);
+            const bool popcnt = ecx1 & (1u << 23);
+            const bool osxsave = ecx1 & (1u << 27);
+            const bool avx = ecx1 & (1u << 28);
+
+            if (!(ssse3 && sse42 && popcnt))
+                return SimdLevel::Scalar;
+            if (!(osxsave && avx) || max_leaf < 7)
+                return SimdLevel::SSE42;
+
+            const uint64_t xcr0 = xgetbv0();
+            if ((xcr0 & 0x6) != 0x6) // XMM and YMM state
+                return SimdLevel::SSE42;
+
+            cpuid(7, 0, regs);
+            const uint32_t ebx7 = regs[1];
+            const bool avx2 = ebx7 & (1u << 5);
+            const bool bmi = ebx7 & (1u << 3);
+            const bool bmi2 = ebx7 & (1u << 8);
+            if (!(avx2 && bmi && bmi2))
+                return SimdLevel::SSE42;
+
+            const bool avx512 = (ebx7 & (1u << 16)) && (ebx7 & (1u << 17)) && (ebx7 & (1u << 30)) && (ebx7 & (1u << 31));
+            if (avx512 && (xcr0 & 0xE0) == 0xE0) // Opmask and ZMM state
+                return SimdLevel::AVX512;
+            return SimdLevel::AVX2;
+#elif defined(__ARM_NEON)
+            return SimdLevel::NEON;
+#else
+            return SimdLevel::Scalar;
+#endif
+        }
+
+        [[nodiscard]] inline SimdLevel detected_simd_level_cached() noexcept
+        {
+            static const SimdLevel detected = detect_simd_level();
+            return detected;
+        }
+
+        [[nodiscard]] inline bool simd_level_supported(SimdLevel level, SimdLevel detected) noexcept
+        {
+            if (level == SimdLevel::Scalar)
+                return true;
+            if (level == SimdLevel::NEON || detected == SimdLevel::NEON)
+                return level == detected;
+            return level <= detected;
+        }
+
+        /// Active level: the detected one unless ECC_SIMD_LEVEL names a supported lower level
+        [[nodiscard]] inline std::atomic<SimdLevel> &active_simd_level_state() noexcept
+        {
+            static std::atomic<SimdLevel> active = []
+            {
+                const SimdLevel detected = detected_simd_level_cached();
+                if (const char *env = std::getenv("ECC_SIMD_LEVEL"))
+                {
+                    const auto requested = parse_simd_level(env);
+                    if (requested && simd_level_supported(*requested, detected))
+                        return *requested;
+                }
+                return detected;
+            }();
+            return active;
+        }
+    } // namespace detail
+
+    /// Highest instruction set level the running CPU supports
+    [[nodiscard]] inline SimdLevel detected_simd_level() noexcept
+    {
+        return detail::detected_simd_level_cached();
+    }
+
+    /// Level the dispatched kernels currently use
+    [[nodiscard]] inline SimdLevel active_simd_level() noexcept
+    {
+        return detail::active_simd_level_state().load(std::memory_order_relaxed);
+    }
+
+    /// Run every dispatched kernel at `level` (for benchmarking); throws if the CPU lacks it
+    inline void force_simd_level(SimdLevel level)
+    {
+        if (!detail::simd_level_supported(level, detected_simd_level()))
+            throw std::invalid_argument(std::string("CPU does not support SIMD level ") + simd_level_name(level));
+
+        detail::active_simd_level_state().store(level, std::memory_order_relaxed);
+    }
+
+    /// Return to the detected level
+    inline void reset_simd_level() noexcept
+    {
+        detail::active_simd_level_state().store(detected_simd_level(), std::memory_order_relaxed);
+    }
+
+    namespace detail
+    {
+#if defined(ECC_X86_DISPATCH)
+        template <typename Kernel>
+        ECC_TARGET_AVX512 ECC_FLATTEN decltype(auto) run_avx512(Kernel &kernel)
+        {
+            return kernel();
+        }
+
+        template <typename Kernel>
+        ECC_TARGET_AVX2 ECC_FLATTEN decltype(auto) run_avx2(Kernel &kernel)
+        {
+            return kernel();
+        }
+
+        template <typename Kernel>
+        ECC_TARGET_SSE42 ECC_FLATTEN decltype(auto) run_sse42(Kernel &kernel)
+        {
+            return kernel();
+        }
+#endif
+
+        /// Run an auto-vectorizable kernel compiled for the active level
+        ///
+        /// The kernel (and everything it calls) is inlined into a clone per target, so plain loops get
+        /// the vector width of the CPU. Kernels must give identical results at every level.
+        template <typename Kernel>
+        decltype(auto) simd_dispatch(Kernel &&kernel)
+        {
+#if defined(ECC_X86_DISPATCH)
+            switch (active_simd_level())
+            {
+            case SimdLevel::AVX512:
+                return run_avx512(kernel);
+            case SimdLevel::AVX2:
+                return run_avx2(kernel);
+            case SimdLevel::SSE42:
+                return run_sse42(kernel);
+            default:
+                break;
+            }
+#endif
+            return kernel();
+        }
+    } // namespace detail
+
+} // namespace ecc
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+/// Empty members (the disabled stats policy) take no space in the codes that hold them
+#if defined(_MSC_VER) && !defined(__clang__)
+#define ECC_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define ECC_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+namespace ecc
+{
+
+    /// Decoder counters
+    enum class DecoderEvent : uint8_t
+    {
+        Decodes,          // Codewords decoded
+        NonzeroSyndromes, // Codewords that were not valid codewords as received
+        CorrectedWords,   // Codewords changed by the decoder
+        CorrectedSymbols, // Bits (binary codes) or symbols (Reed-Solomon) corrected
+        Failures,         // Codewords detected as uncorrectable
+        Iterations        // Berlekamp-Massey steps or LDPC iterations
+    };
+
+    inline constexpr size_t decoder_event_count = 6;
+
+    /// Aggregated decoder counters
+    struct DecoderStatsSnapshot
+    {
+        uint64_t decodes = 0;
+        uint64_t nonzero_syndromes = 0;
+        uint64_t corrected_words = 0;
+        uint64_t corrected_symbols = 0;
+        uint64_t failures = 0;
+        uint64_t iterations = 0;
+
+        [[nodiscard]] uint64_t get(DecoderEvent event) const noexcept
+        {
+            switch (event)
+            {
+            case DecoderEvent::Decodes:
+                return decodes;
+            case DecoderEvent::NonzeroSyndromes:
+                return nonzero_syndromes;
+            case DecoderEvent::CorrectedWords:
+                return corrected_words;
+            case DecoderEvent::CorrectedSymbols:
+                return corrected_symbols;
+            case DecoderEvent::Failures:
+                return failures;
+            default:
+                return iterations;
+            }
+        }
+
+        void merge(const DecoderStatsSnapshot &other) noexcept
+        {
+            decodes += other.decodes;
+            nonzero_syndromes += other.nonzero_syndromes;
+            corrected_words += other.corrected_words;
+            corrected_symbols += other.corrected_symbols;
+            failures += other.failures;
+            iterations += other.iterations;
+        }
+    };
+
+    /// Default stats policy: records nothing
+    ///
+    /// Every hook is an empty inline function and the policy is an empty member, so a code built with
+    /// it has the same size and the same machine code as one without stats.
+    struct NoDecoderStats
+    {
+        static constexpr bool enabled = false;
+
+        constexpr void record(DecoderEvent, uint64_t = 1) const noexcept {}
+        constexpr void record_decode(bool, bool, uint64_t) const noexcept {}
+    };
+
+    namespace detail
+    {
+        /// One thread's counters, alone on a cache line
+        struct alignas(64) DecoderStatsShard
+        {
+            std::array<std::atomic<uint64_t>, decoder_event_count> counts{};
+        };
+        static_assert(sizeof(DecoderStatsShard) == 64, "Each shard must fill exactly one cache line");
+
+        /// Dense index of the calling thread, assigned on its first use
+        [[nodiscard]] inline size_t stats_thread_index() noexcept
+        {
+            static std::atomic<size_t> next{0};
+            thread_local const size_t index = next.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+    } // namespace detail
+
+    /// Stats policy with per-thread counters
+    ///
+    /// Each thread adds to its own cache-line shard, so decoders running on many threads never write
+    /// to a shared line; snapshot() sums the shards. Threads beyond shard_count wrap around and share
+    /// shards, which stays exact because the adds are atomic. Copies share one set of counters, so a
+    /// code copied into each worker still reports one total.
+    class DecoderStats
+    {
+    public:
+        static constexpr bool enabled = true;
+        static constexpr size_t shard_count = 64;
+
+    private:
+        using Shards = std::array<detail::DecoderStatsShard, shard_count>;
+        std::shared_ptr<Shards> shards = std::make_shared<Shards>();
+
+        [[nodiscard]] detail::DecoderStatsShard &local_shard() const noexcept
+        {
+            return (*shards)[detail::stats_thread_index() % shard_count];
+        }
+
+    public:
+        /// Add `amount` to one counter
+        void record(DecoderEvent event, uint64_t amount = 1) const noexcept
+        {
+            local_shard().counts[static_cast<size_t>(event)].fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        /// Count one decode and its outcome
+        void record_decode(bool nonzero_syndrome, bool success, uint64_t corrected_symbols) const noexcept
+        {
+            auto &counts = local_shard().counts;
+            auto add = [&](DecoderEvent event, uint64_t amount)
+            {
+                counts[static_cast<size_t>(event)].fetch_add(amount, std::memory_order_relaxed);
+            };
+
+            add(DecoderEvent::Decodes, 1);
+            if (!nonzero_syndrome)
+                return;
+
+            add(DecoderEvent::NonzeroSyndromes, 1);
+            if (!success)
+            {
+                add(DecoderEvent::Failures, 1);
+            }
+            else if (corrected_symbols > 0)
+            {
+                add(DecoderEvent::CorrectedWords, 1);
+                add(DecoderEvent::CorrectedSymbols, corrected_symbols);
+            }
+        }
+
+        /// Sum of every thread's counters (concurrent decodes may or may not be included)
+        [[nodiscard]] DecoderStatsSnapshot snapshot() const noexcept
+        {
+            std::array<uint64_t, decoder_event_count> totals{};
+            for (const auto &shard : *shards)
+            {
+                for (size_t e = 0; e < decoder_event_count; ++e)
+                {
+                    totals[e] += shard.counts[e].load(std::memory_order_relaxed);
+                }
+            }
+            return {totals[0], totals[1], totals[2], totals[3], totals[4], totals[5]};
+        }
+
+        /// Zero every counter
+        void reset() noexcept
+        {
+            for (auto &shard : *shards)
+            {
+                for (auto &count : shard.counts)
+                {
+                    count.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    /// Counters of one code with the Prometheus labels that identify it
+    struct DecoderStatsSeries
+    {
+        std::vector<std::pair<std::string, std::string>> labels; // e.g. {{"code", "rs_255_223"}}
+        DecoderStatsSnapshot stats;
+    };
+
+    namespace detail
+    {
+        [[nodiscard]] inline std::string prometheus_label_value(std::string_view value)
+        {
+            std::string escaped;
+            for (char c : value)
+            {
+                if (c == '\\' || c == '"')
+                {
+                    escaped += '\\';
+                    escaped += c;
+                }
+                else if (c == '\n')
+                {
+                    escaped += "\\n";
+                }
+                else
+                {
+                    escaped += c;
+                }
+            }
+            return escaped;
+        }
+    } // namespace detail
+
+    /// Write counters in the Prometheus text exposition format
+    ///
+    /// Each counter becomes one metric family `<prefix>_<counter>_total`, with one sample per series.
+    inline void write_prometheus(std::ostream &out, std::span<const DecoderStatsSeries> series,
+                                 std::string_view prefix = "ecc_decoder")
+    {
+        struct Family
+        {
+            DecoderEvent event;
+            const char *name;
+            const char *help;
+        };
+        static constexpr std::array<Family, decoder_event_count> families{{
+            {DecoderEvent::Decodes, "decodes", "Codewords decoded"},
+            {DecoderEvent::NonzeroSyndromes, "nonzero_syndromes", "Codewords received with a nonzero syndrome"},
+            {DecoderEvent::CorrectedWords, "corrected_words", "Codewords changed by error correction"},
+            {DecoderEvent::CorrectedSymbols, "corrected_symbols", "Bits or symbols corrected"},
+            {DecoderEvent::Failures, "failures", "Codewords detected as uncorrectable"},
+            {DecoderEvent::Iterations, "iterations", "Berlekamp-Massey steps or LDPC decoding iterations"},
+        }};
+
+        for (const auto &family : families)
+        {
+            const std::string metric = std::string(prefix) + "_" + family.name + "_total";
+            out << "# HELP " << metric << " " << family.help << "\n";
+            out << "# TYPE " << metric << " counter\n";
+
+            for (const auto &entry : series)
+            {
+                out << metric;
+                if (!entry.labels.empty())
+                {
+                    out << "{";
+                    for (size_t i = 0; i < entry.labels.size(); ++i)
+                    {
+                        out << (i == 0 ? "" : ",") << entry.labels[i].first << "=\""
+                            << detail::prometheus_label_value(entry.labels[i].second) << "\"";
+                    }
+                    out << "}";
+                }
+                out << " " << entry.stats.get(family.event) << "\n";
+            }
+        }
+    }
+
+} // namespace ecc
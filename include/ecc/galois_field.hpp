@@ -1,5 +1,6 @@
 #pragma once
 
+#include "cpu_dispatch.hpp"
 #include <vector>
 #include <array>
 #include <memory>
@@ -9,11 +10,167 @@
 #include <numeric>
 #include <cmath>
 #include <stdexcept>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <type_traits>
+#include <span>
+#include <bit>
+
+#if defined(ECC_X86_DISPATCH)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace ecc
 {
 
+    /// Primitive polynomials for common field sizes
+    constexpr uint32_t primitive_poly_8 = 0x11D;   // x^8 + x^4 + x^3 + x^2 + 1
+    constexpr uint32_t primitive_poly_10 = 0x409;  // x^10 + x^3 + 1
+    constexpr uint32_t primitive_poly_12 = 0x1053; // x^12 + x^6 + x^4 + x + 1
+    constexpr uint32_t primitive_poly_16 = 0x1100B; // x^16 + x^12 + x^3 + x + 1
+
+    namespace detail
+    {
+        /// Default primitive polynomial for GF(2^m)
+        template <size_t m>
+        constexpr uint32_t default_primitive_poly() noexcept
+        {
+            if constexpr (m == 3)
+                return 0x0B; // x^3 + x + 1
+            else if constexpr (m == 4)
+                return 0x13; // x^4 + x + 1
+            else if constexpr (m == 5)
+                return 0x25; // x^5 + x^2 + 1
+            else if constexpr (m == 6)
+                return 0x43; // x^6 + x + 1
+            else if constexpr (m == 7)
+                return 0x89; // x^7 + x^3 + 1
+            else if constexpr (m == 8)
+                return primitive_poly_8;
+            else if constexpr (m == 9)
+                return 0x211; // x^9 + x^4 + 1
+            else if constexpr (m == 10)
+                return primitive_poly_10;
+            else if constexpr (m == 11)
+                return 0x805; // x^11 + x^2 + 1
+            else if constexpr (m == 12)
+                return primitive_poly_12;
+            else if constexpr (m == 13)
+                return 0x201B; // x^13 + x^4 + x^3 + x + 1
+            else if constexpr (m == 14)
+                return 0x4443; // x^14 + x^10 + x^6 + x + 1
+            else if constexpr (m == 16)
+                return primitive_poly_16;
+            else
+                return (1u << m) | 3; // Default: x^m + x + 1 (primitive for m = 1, 2, 15)
+        }
+
+        /// Exp/log tables for GF(2^m)
+        ///
+        /// The exp table is double length (exp[i] = alpha^(i mod (2^m - 1)) for i < 2(2^m - 1)), so a
+        /// product is exp[log a + log b] and a quotient exp[log a + (2^m - 1) - log b], with no modulo.
+        template <size_t m>
+        struct GFTables
+        {
+            static_assert(m >= 1 && m <= 16, "GF(2^m) tables support 1 <= m <= 16");
+
+            static constexpr size_t field_size = 1u << m;
+            static constexpr size_t order = field_size - 1;
+
+            using Entry = std::conditional_t<(m <= 8), uint8_t, uint16_t>;
+
+            std::array<Entry, 2 * order> exp_table{};
+            std::array<Entry, field_size> log_table{};
+
+            [[nodiscard]] static constexpr GFTables build(uint32_t primitive_poly) noexcept
+            {
+                GFTables tables;
+                tables.fill(primitive_poly);
+                return tables;
+            }
+
+            constexpr void fill(uint32_t primitive_poly) noexcept
+            {
+                uint32_t value = 1;
+                for (size_t i = 0; i < order; ++i)
+                {
+                    exp_table[i] = static_cast<Entry>(value);
+                    exp_table[i + order] = static_cast<Entry>(value);
+
+                    value <<= 1;
+                    if (value & field_size)
+                    {
+                        value ^= primitive_poly;
+                    }
+                }
+
+                // log(0) is undefined, but we'll use 0
+                for (size_t i = 0; i < order; ++i)
+                {
+                    log_table[exp_table[i]] = static_cast<Entry>(i);
+                }
+                log_table[0] = 0;
+            }
+        };
+
+        /// Largest field whose default tables are compile-time constants
+        inline constexpr size_t max_constexpr_gf_bits = 12;
+
+        /// Compile-time tables for the default primitive polynomial of each field size
+        template <size_t m>
+            requires(m <= max_constexpr_gf_bits)
+        inline constexpr GFTables<m> default_gf_tables = GFTables<m>::build(default_primitive_poly<m>());
+
+        /// Heap-allocated tables (GF(2^16) tables are 384 KB, too large to build on the stack)
+        template <size_t m>
+        [[nodiscard]] std::shared_ptr<const GFTables<m>> make_gf_tables(uint32_t primitive_poly)
+        {
+            auto tables = std::make_shared<GFTables<m>>();
+            tables->fill(primitive_poly);
+            return tables;
+        }
+
+        /// Tables for the default primitive polynomial
+        ///
+        /// Up to GF(2^12) these are the compile-time constants. Larger fields build theirs once on
+        /// first use, which keeps 384 KB of GF(2^16) tables out of every binary and every compile.
+        template <size_t m>
+        [[nodiscard]] inline const GFTables<m> &default_tables()
+        {
+            if constexpr (m <= max_constexpr_gf_bits)
+            {
+                return default_gf_tables<m>;
+            }
+            else
+            {
+                static const std::shared_ptr<const GFTables<m>> tables = make_gf_tables<m>(default_primitive_poly<m>());
+                return *tables;
+            }
+        }
+
+        /// Reduce x modulo 2^m - 1 by folding (no division)
+        template <size_t m>
+        [[nodiscard]] constexpr uint64_t mersenne_reduce(uint64_t x) noexcept
+        {
+            constexpr uint64_t order = (1ull << m) - 1;
+            while (x > order)
+            {
+                x = (x & order) + (x >> m);
+            }
+            return (x == order) ? 0 : x;
+        }
+    } // namespace detail
+
     /// Galois Field GF(2^m) implementation with optimized arithmetic
+    ///
+    /// A field is a light handle onto exp/log tables. Fields over the default primitive polynomial
+    /// share one table (a compile-time constant up to GF(2^12)); custom polynomials build theirs once
+    /// per field object, or once per process through shared(). Bulk GF(2^16) work should go through
+    /// the split-table region ops below, whose per-constant tables fit in L1.
     template <size_t m>
     class GaloisField
     {
@@ -22,16 +179,49 @@ namespace ecc
         static constexpr size_t primitive_element = 2;
 
         using Element = uint32_t;
+        using Tables = detail::GFTables<m>;
 
     private:
-        std::array<Element, field_size> exp_table;
-        std::array<Element, field_size> log_table;
+        std::shared_ptr<const Tables> owned_tables; // Only set for non-default polynomials
+        const Tables *tables;
         Element primitive_poly;
 
     public:
         explicit GaloisField(Element prim_poly) : primitive_poly(prim_poly)
         {
-            build_tables();
+            if (prim_poly == detail::default_primitive_poly<m>())
+            {
+                tables = &detail::default_tables<m>();
+            }
+            else
+            {
+                owned_tables = detail::make_gf_tables<m>(prim_poly);
+                tables = owned_tables.get();
+            }
+        }
+
+        /// Process-wide field instance for a primitive polynomial, built on first use
+        ///
+        /// The returned reference stays valid for the lifetime of the program, so codes and
+        /// polynomials can keep pointers to it instead of owning their own field.
+        [[nodiscard]] static const GaloisField &shared(Element prim_poly = detail::default_primitive_poly<m>())
+        {
+            if (prim_poly == detail::default_primitive_poly<m>())
+            {
+                static const GaloisField default_field(prim_poly);
+                return default_field;
+            }
+
+            static std::mutex cache_mutex;
+            static std::map<Element, std::unique_ptr<const GaloisField>> cache;
+
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            auto &entry = cache[prim_poly];
+            if (!entry)
+            {
+                entry = std::make_unique<const GaloisField>(prim_poly);
+            }
+            return *entry;
         }
 
         /// Addition in GF(2^m) (XOR)
@@ -46,8 +236,7 @@ namespace ecc
             if (a == 0 || b == 0)
                 return 0;
 
-            size_t log_sum = (log_table[a] + log_table[b]) % (field_size - 1);
-            return exp_table[log_sum];
+            return tables->exp_table[tables->log_table[a] + tables->log_table[b]];
         }
 
         /// Division in GF(2^m)
@@ -58,8 +247,7 @@ namespace ecc
             if (a == 0)
                 return 0;
 
-            size_t log_diff = (log_table[a] - log_table[b] + field_size - 1) % (field_size - 1);
-            return exp_table[log_diff];
+            return tables->exp_table[tables->log_table[a] + Tables::order - tables->log_table[b]];
         }
 
         /// Power operation
@@ -68,8 +256,8 @@ namespace ecc
             if (base == 0)
                 return (exponent == 0) ? 1 : 0;
 
-            size_t log_result = (log_table[base] * exponent) % (field_size - 1);
-            return exp_table[log_result];
+            uint64_t reduced_exponent = detail::mersenne_reduce<m>(exponent);
+            return tables->exp_table[detail::mersenne_reduce<m>(tables->log_table[base] * reduced_exponent)];
         }
 
         /// Multiplicative inverse
@@ -78,8 +266,31 @@ namespace ecc
             if (a == 0)
                 throw std::invalid_argument("Zero has no multiplicative inverse");
 
-            size_t inv_log = (field_size - 1 - log_table[a]) % (field_size - 1);
-            return exp_table[inv_log];
+            return tables->exp_table[Tables::order - tables->log_table[a]];
+        }
+
+        /// alpha^i for 0 <= i < 2(2^m - 1)
+        [[nodiscard]] Element exp(size_t i) const noexcept
+        {
+            return tables->exp_table[i];
+        }
+
+        /// Discrete logarithm base alpha (log(0) is returned as 0)
+        [[nodiscard]] size_t log(Element a) const noexcept
+        {
+            return tables->log_table[a];
+        }
+
+        /// Underlying exp/log tables (for table-driven kernels)
+        [[nodiscard]] const Tables &get_tables() const noexcept
+        {
+            return *tables;
+        }
+
+        /// Get the primitive polynomial the field was built from
+        [[nodiscard]] Element get_primitive_polynomial() const noexcept
+        {
+            return primitive_poly;
         }
 
         /// Get primitive element
@@ -103,31 +314,6 @@ namespace ecc
             }
             return current == 1;
         }
-
-    private:
-        void build_tables()
-        {
-            // Build exponential table
-            exp_table[0] = 1;
-            Element value = 1;
-
-            for (size_t i = 1; i < field_size; ++i)
-            {
-                value <<= 1;
-                if (value & field_size)
-                {
-                    value ^= primitive_poly;
-                }
-                exp_table[i % (field_size - 1)] = value;
-            }
-
-            // Build logarithm table
-            log_table[0] = 0; // Undefined, but we'll use 0
-            for (size_t i = 0; i < field_size - 1; ++i)
-            {
-                log_table[exp_table[i]] = i;
-            }
-        }
     };
 
     /// Polynomial operations in GF(2^m)
@@ -264,15 +450,181 @@ namespace ecc
         }
     };
 
+    /// Polynomial over GF(2^m) of degree at most max_degree, stored inline
+    ///
+    /// Coefficients live in a fixed array (terms above the degree are kept zero), so decoder
+    /// temporaries such as error locators and evaluators never touch the heap.
+    template <size_t m, size_t max_degree>
+    class InlineGFPolynomial
+    {
+    public:
+        using Field = GaloisField<m>;
+        using Element = typename Field::Element;
+        static constexpr size_t capacity = max_degree + 1; // Coefficients stored
+
+    private:
+        std::array<Element, capacity> coefficients{};
+        const Field *field;
+
+    public:
+        /// Zero polynomial
+        explicit InlineGFPolynomial(const Field &gf) noexcept : field(&gf) {}
+
+        /// Polynomial c_0 + c_1 x + ... (throws std::length_error past max_degree)
+        InlineGFPolynomial(const Field &gf, std::initializer_list<Element> coeffs) : field(&gf)
+        {
+            if (coeffs.size() > capacity)
+                throw std::length_error("Polynomial exceeds its inline capacity");
+            std::copy(coeffs.begin(), coeffs.end(), coefficients.begin());
+        }
+
+        /// Degree of polynomial (0 for the zero polynomial)
+        [[nodiscard]] size_t degree() const noexcept
+        {
+            for (size_t i = max_degree; i > 0; --i)
+            {
+                if (coefficients[i] != 0)
+                    return i;
+            }
+            return 0;
+        }
+
+        /// Access coefficient (0 past the capacity)
+        [[nodiscard]] Element operator[](size_t index) const noexcept
+        {
+            return (index < capacity) ? coefficients[index] : 0;
+        }
+
+        /// Mutable coefficient, index < capacity
+        [[nodiscard]] Element &operator[](size_t index) noexcept
+        {
+            return coefficients[index];
+        }
+
+        /// Set coefficient (throws std::length_error past max_degree)
+        void set_coefficient(size_t index, Element value)
+        {
+            if (index >= capacity)
+                throw std::length_error("Polynomial exceeds its inline capacity");
+            coefficients[index] = value;
+        }
+
+        /// Reset to the zero polynomial
+        void clear() noexcept
+        {
+            coefficients.fill(0);
+        }
+
+        /// Check if polynomial is zero
+        [[nodiscard]] bool is_zero() const noexcept
+        {
+            return std::all_of(coefficients.begin(), coefficients.end(),
+                               [](Element e)
+                               { return e == 0; });
+        }
+
+        /// Polynomial addition
+        InlineGFPolynomial &operator+=(const InlineGFPolynomial &other) noexcept
+        {
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                coefficients[i] = field->add(coefficients[i], other.coefficients[i]);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] InlineGFPolynomial operator+(const InlineGFPolynomial &other) const noexcept
+        {
+            InlineGFPolynomial result = *this;
+            result += other;
+            return result;
+        }
+
+        /// this += factor * x^shift * other, dropping terms past max_degree (the Berlekamp-Massey update)
+        template <size_t other_degree>
+        void add_scaled(const InlineGFPolynomial<m, other_degree> &other, Element factor, size_t shift = 0) noexcept
+        {
+            if (factor == 0 || shift >= capacity)
+                return;
+
+            const size_t count = std::min(other_degree + 1, capacity - shift);
+            for (size_t i = 0; i < count; ++i)
+            {
+                coefficients[i + shift] = field->add(coefficients[i + shift], field->multiply(factor, other[i]));
+            }
+        }
+
+        /// Product truncated mod x^terms, e.g. the error evaluator S(x) Lambda(x) mod x^(2t)
+        template <size_t other_degree>
+        [[nodiscard]] InlineGFPolynomial multiply_mod(const InlineGFPolynomial<m, other_degree> &other,
+                                                      size_t terms) const noexcept
+        {
+            InlineGFPolynomial result(*field);
+            terms = std::min(terms, capacity);
+            const size_t other_top = other.degree();
+
+            for (size_t i = 0; i <= degree() && i < terms; ++i)
+            {
+                if (coefficients[i] == 0)
+                    continue;
+                for (size_t j = 0; j <= other_top && i + j < terms; ++j)
+                {
+                    Element product = field->multiply(coefficients[i], other[j]);
+                    result.coefficients[i + j] = field->add(result.coefficients[i + j], product);
+                }
+            }
+
+            return result;
+        }
+
+        /// Polynomial multiplication (throws std::length_error if the product exceeds max_degree)
+        template <size_t other_degree>
+        [[nodiscard]] InlineGFPolynomial operator*(const InlineGFPolynomial<m, other_degree> &other) const
+        {
+            if (!is_zero() && !other.is_zero() && degree() + other.degree() > max_degree)
+                throw std::length_error("Polynomial product exceeds its inline capacity");
+            return multiply_mod(other, capacity);
+        }
+
+        /// Formal derivative (over GF(2^m) only the odd terms survive)
+        [[nodiscard]] InlineGFPolynomial derivative() const noexcept
+        {
+            InlineGFPolynomial result(*field);
+            for (size_t i = 1; i < capacity; i += 2)
+            {
+                result.coefficients[i - 1] = coefficients[i];
+            }
+            return result;
+        }
+
+        /// Polynomial evaluation at point x
+        [[nodiscard]] Element evaluate(Element x) const noexcept
+        {
+            size_t i = degree();
+            Element result = coefficients[i];
+            while (i-- > 0)
+            {
+                result = field->add(field->multiply(result, x), coefficients[i]);
+            }
+            return result;
+        }
+
+        /// Heap-backed copy for callers that need an unbounded polynomial
+        [[nodiscard]] GFPolynomial<m> to_polynomial() const
+        {
+            std::vector<Element> coeffs(degree() + 1);
+            std::copy_n(coefficients.begin(), coeffs.size(), coeffs.begin());
+            return GFPolynomial<m>(*field, std::move(coeffs));
+        }
+
+        [[nodiscard]] const Field &get_field() const noexcept { return *field; }
+    };
+
     /// Specialized Galois fields for common applications
     using GF256 = GaloisField<8>;   // For Reed-Solomon codes
     using GF1024 = GaloisField<10>; // For extended Reed-Solomon
     using GF4096 = GaloisField<12>; // For high-rate applications
-
-    /// Primitive polynomials for common field sizes
-    constexpr uint32_t primitive_poly_8 = 0x11D;   // x^8 + x^4 + x^3 + x^2 + 1
-    constexpr uint32_t primitive_poly_10 = 0x409;  // x^10 + x^3 + 1
-    constexpr uint32_t primitive_poly_12 = 0x1053; // x^12 + x^6 + x^4 + x + 1
+    using GF65536 = GaloisField<16>; // For long blocks (more than 255 symbols per codeword)
 
     /// Factory functions for creating common Galois fields
     namespace galois
@@ -285,6 +637,624 @@ namespace ecc
 
         /// Create GF(2^12) field for high-rate applications
         std::unique_ptr<GF4096> create_gf4096();
+
+        /// Create GF(2^16) field for long-block codes
+        std::unique_ptr<GF65536> create_gf65536();
+    }
+
+    namespace detail
+    {
+        /// Split-nibble product tables for a constant c in GF(2^8): c*x = low[x & 15] ^ high[x >> 4]
+        struct NibbleTables
+        {
+            alignas(16) std::array<uint8_t, 16> low{};
+            alignas(16) std::array<uint8_t, 16> high{};
+        };
+
+        [[nodiscard]] inline NibbleTables make_nibble_tables(const GF256 &field, uint8_t c) noexcept
+        {
+            NibbleTables tables;
+            for (uint32_t x = 0; x < 16; ++x)
+            {
+                tables.low[x] = static_cast<uint8_t>(field.multiply(c, x));
+                tables.high[x] = static_cast<uint8_t>(field.multiply(c, x << 4));
+            }
+            return tables;
+        }
+
+#if defined(ECC_X86_DISPATCH)
+        /// 64-byte steps of the nibble product from offset i; returns the first unprocessed offset
+        template <bool accumulate>
+        ECC_TARGET_AVX512 inline size_t nibble_multiply_avx512(const NibbleTables &tables, const uint8_t *src,
+                                                               uint8_t *dst, size_t size, size_t i) noexcept
+        {
+            // Full-mask maskz forms: the unmasked broadcast/shift trip a GCC 12 -Wuninitialized false positive
+            constexpr __mmask16 all = 0xFFFF;
+            const __m512i low = _mm512_maskz_broadcast_i32x4(all, _mm_load_si128(reinterpret_cast<const __m128i *>(tables.low.data())));
+            const __m512i high = _mm512_maskz_broadcast_i32x4(all, _mm_load_si128(reinterpret_cast<const __m128i *>(tables.high.data())));
+            const __m512i mask = _mm512_set1_epi8(0x0F);
+            for (; i + 64 <= size; i += 64)
+            {
+                const __m512i x = _mm512_loadu_si512(src + i);
+                const __m512i lo = _mm512_shuffle_epi8(low, _mm512_and_si512(x, mask));
+                const __m512i hi = _mm512_shuffle_epi8(high, _mm512_and_si512(_mm512_maskz_srli_epi32(all, x, 4), mask));
+                __m512i product = _mm512_xor_si512(lo, hi);
+                if constexpr (accumulate)
+                {
+                    product = _mm512_xor_si512(product, _mm512_loadu_si512(dst + i));
+                }
+                _mm512_storeu_si512(dst + i, product);
+            }
+            return i;
+        }
+
+        template <bool accumulate>
+        ECC_TARGET_AVX2 inline size_t nibble_multiply_avx2(const NibbleTables &tables, const uint8_t *src,
+                                                           uint8_t *dst, size_t size, size_t i) noexcept
+        {
+            const __m256i low = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(tables.low.data())));
+            const __m256i high = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(tables.high.data())));
+            const __m256i mask = _mm256_set1_epi8(0x0F);
+            for (; i + 32 <= size; i += 32)
+            {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                const __m256i lo = _mm256_shuffle_epi8(low, _mm256_and_si256(x, mask));
+                const __m256i hi = _mm256_shuffle_epi8(high, _mm256_and_si256(_mm256_srli_epi64(x, 4), mask));
+                __m256i product = _mm256_xor_si256(lo, hi);
+                if constexpr (accumulate)
+                {
+                    product = _mm256_xor_si256(product, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i)));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), product);
+            }
+            return i;
+        }
+
+        template <bool accumulate>
+        ECC_TARGET_SSE42 inline size_t nibble_multiply_sse42(const NibbleTables &tables, const uint8_t *src,
+                                                             uint8_t *dst, size_t size, size_t i) noexcept
+        {
+            const __m128i low = _mm_load_si128(reinterpret_cast<const __m128i *>(tables.low.data()));
+            const __m128i high = _mm_load_si128(reinterpret_cast<const __m128i *>(tables.high.data()));
+            const __m128i mask = _mm_set1_epi8(0x0F);
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                const __m128i lo = _mm_shuffle_epi8(low, _mm_and_si128(x, mask));
+                const __m128i hi = _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+                __m128i product = _mm_xor_si128(lo, hi);
+                if constexpr (accumulate)
+                {
+                    product = _mm_xor_si128(product, _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i)));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), product);
+            }
+            return i;
+        }
+
+        ECC_TARGET_AVX512 inline size_t xor_region_avx512(const uint8_t *src, uint8_t *dst, size_t size, size_t i) noexcept
+        {
+            for (; i + 64 <= size; i += 64)
+            {
+                _mm512_storeu_si512(dst + i, _mm512_xor_si512(_mm512_loadu_si512(src + i), _mm512_loadu_si512(dst + i)));
+            }
+            return i;
+        }
+
+        ECC_TARGET_AVX2 inline size_t xor_region_avx2(const uint8_t *src, uint8_t *dst, size_t size, size_t i) noexcept
+        {
+            for (; i + 32 <= size; i += 32)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_xor_si256(a, b));
+            }
+            return i;
+        }
+
+        ECC_TARGET_SSE42 inline size_t xor_region_sse42(const uint8_t *src, uint8_t *dst, size_t size, size_t i) noexcept
+        {
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(a, b));
+            }
+            return i;
+        }
+#endif
+
+        /// dst = c*src (accumulate = false) or dst ^= c*src (accumulate = true)
+        ///
+        /// Wide steps run at the active SIMD level, then narrower ones, then the scalar tail.
+        template <bool accumulate>
+        inline void nibble_multiply_region(const NibbleTables &tables, const uint8_t *src, uint8_t *dst,
+                                           size_t size) noexcept
+        {
+            size_t i = 0;
+
+#if defined(ECC_X86_DISPATCH)
+            switch (active_simd_level())
+            {
+            case SimdLevel::AVX512:
+                i = nibble_multiply_avx512<accumulate>(tables, src, dst, size, i);
+                [[fallthrough]];
+            case SimdLevel::AVX2:
+                i = nibble_multiply_avx2<accumulate>(tables, src, dst, size, i);
+                [[fallthrough]];
+            case SimdLevel::SSE42:
+                i = nibble_multiply_sse42<accumulate>(tables, src, dst, size, i);
+                break;
+            default:
+                break;
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            if (active_simd_level() == SimdLevel::NEON)
+            {
+                const uint8x16_t low_128 = vld1q_u8(tables.low.data());
+                const uint8x16_t high_128 = vld1q_u8(tables.high.data());
+                const uint8x16_t mask_128 = vdupq_n_u8(0x0F);
+                for (; i + 16 <= size; i += 16)
+                {
+                    const uint8x16_t x = vld1q_u8(src + i);
+                    uint8x16_t product = veorq_u8(vqtbl1q_u8(low_128, vandq_u8(x, mask_128)),
+                                                  vqtbl1q_u8(high_128, vshrq_n_u8(x, 4)));
+                    if constexpr (accumulate)
+                    {
+                        product = veorq_u8(product, vld1q_u8(dst + i));
+                    }
+                    vst1q_u8(dst + i, product);
+                }
+            }
+#endif
+
+            // Scalar tail (and full fallback without SIMD)
+            for (; i < size; ++i)
+            {
+                const uint8_t product = tables.low[src[i] & 0x0F] ^ tables.high[src[i] >> 4];
+                if constexpr (accumulate)
+                {
+                    dst[i] ^= product;
+                }
+                else
+                {
+                    dst[i] = product;
+                }
+            }
+        }
+
+        /// dst ^= src
+        inline void xor_region(const uint8_t *src, uint8_t *dst, size_t size) noexcept
+        {
+            size_t i = 0;
+
+#if defined(ECC_X86_DISPATCH)
+            switch (active_simd_level())
+            {
+            case SimdLevel::AVX512:
+                i = xor_region_avx512(src, dst, size, i);
+                [[fallthrough]];
+            case SimdLevel::AVX2:
+                i = xor_region_avx2(src, dst, size, i);
+                [[fallthrough]];
+            case SimdLevel::SSE42:
+                i = xor_region_sse42(src, dst, size, i);
+                break;
+            default:
+                break;
+            }
+#elif defined(__ARM_NEON)
+            if (active_simd_level() == SimdLevel::NEON)
+            {
+                for (; i + 16 <= size; i += 16)
+                {
+                    vst1q_u8(dst + i, veorq_u8(vld1q_u8(src + i), vld1q_u8(dst + i)));
+                }
+            }
+#endif
+
+            for (; i < size; ++i)
+            {
+                dst[i] ^= src[i];
+            }
+        }
+
+        /// Split product tables for a constant c in GF(2^16)
+        ///
+        /// Scalar code splits x into bytes: c*x = low[x & 0xFF] ^ high[x >> 8], 1 KB that stays in L1.
+        /// SIMD code splits x into nibbles and each product into bytes, so byte b of c*x is the XOR
+        /// over nibbles q of nibble_bytes[b][q][x_q], eight 16-entry shuffle tables.
+        struct SplitTables16
+        {
+            alignas(64) std::array<uint16_t, 256> low{};
+            alignas(64) std::array<uint16_t, 256> high{};
+            alignas(16) std::array<std::array<std::array<uint8_t, 16>, 4>, 2> nibble_bytes{};
+        };
+
+        [[nodiscard]] inline SplitTables16 make_split_tables(const GaloisField<16> &field, uint16_t c) noexcept
+        {
+            // c*x is linear in the bits of x, so every entry is an XOR of the products c * 2^i
+            std::array<uint16_t, 16> basis{};
+            for (size_t bit = 0; bit < 16; ++bit)
+            {
+                basis[bit] = static_cast<uint16_t>(field.multiply(c, 1u << bit));
+            }
+
+            SplitTables16 tables;
+            for (uint32_t x = 1; x < 256; ++x)
+            {
+                const uint32_t rest = x & (x - 1);
+                const size_t bit = static_cast<size_t>(std::countr_zero(x));
+                tables.low[x] = tables.low[rest] ^ basis[bit];
+                tables.high[x] = tables.high[rest] ^ basis[bit + 8];
+            }
+
+            for (uint32_t v = 0; v < 16; ++v)
+            {
+                const std::array<uint16_t, 4> products = {tables.low[v], tables.low[v << 4], tables.high[v], tables.high[v << 4]};
+                for (size_t q = 0; q < 4; ++q)
+                {
+                    tables.nibble_bytes[0][q][v] = static_cast<uint8_t>(products[q]);
+                    tables.nibble_bytes[1][q][v] = static_cast<uint8_t>(products[q] >> 8);
+                }
+            }
+            return tables;
+        }
+
+#if defined(ECC_X86_DISPATCH)
+        /// 128-element steps of the split product from offset i; returns the first unprocessed offset
+        ///
+        /// Each step packs the low and high bytes of two vectors of words into byte planes, applies the
+        /// nibble tables and interleaves the product bytes back. Pack and unpack both work per 128-bit
+        /// lane, so at 256 and 512 bits the lane order they introduce cancels out.
+        template <bool accumulate>
+        ECC_TARGET_AVX512 inline size_t split16_multiply_avx512(const SplitTables16 &tables, const uint16_t *src,
+                                                                uint16_t *dst, size_t size, size_t i) noexcept
+        {
+            // Full-mask maskz forms: the unmasked broadcast/shift trip a GCC 12 -Wuninitialized false positive
+            constexpr __mmask16 all = 0xFFFF;
+            constexpr __mmask32 all_words = 0xFFFFFFFF;
+            __m512i t[2][4];
+            for (size_t b = 0; b < 2; ++b)
+            {
+                for (size_t q = 0; q < 4; ++q)
+                {
+                    t[b][q] = _mm512_maskz_broadcast_i32x4(all, _mm_load_si128(reinterpret_cast<const __m128i *>(tables.nibble_bytes[b][q].data())));
+                }
+            }
+            const __m512i nibble = _mm512_set1_epi8(0x0F);
+            const __m512i byte = _mm512_set1_epi16(0x00FF);
+
+            for (; i + 64 <= size; i += 64)
+            {
+                const __m512i a = _mm512_loadu_si512(src + i);
+                const __m512i b = _mm512_loadu_si512(src + i + 32);
+                const __m512i lo = _mm512_packus_epi16(_mm512_and_si512(a, byte), _mm512_and_si512(b, byte));
+                const __m512i hi = _mm512_packus_epi16(_mm512_maskz_srli_epi16(all_words, a, 8), _mm512_maskz_srli_epi16(all_words, b, 8));
+                const __m512i x[4] = {
+                    _mm512_and_si512(lo, nibble), _mm512_and_si512(_mm512_maskz_srli_epi32(all, lo, 4), nibble),
+                    _mm512_and_si512(hi, nibble), _mm512_and_si512(_mm512_maskz_srli_epi32(all, hi, 4), nibble)};
+
+                __m512i product[2];
+                for (size_t p = 0; p < 2; ++p)
+                {
+                    product[p] = _mm512_xor_si512(_mm512_xor_si512(_mm512_shuffle_epi8(t[p][0], x[0]), _mm512_shuffle_epi8(t[p][1], x[1])),
+                                                  _mm512_xor_si512(_mm512_shuffle_epi8(t[p][2], x[2]), _mm512_shuffle_epi8(t[p][3], x[3])));
+                }
+
+                __m512i out_a = _mm512_unpacklo_epi8(product[0], product[1]);
+                __m512i out_b = _mm512_unpackhi_epi8(product[0], product[1]);
+                if constexpr (accumulate)
+                {
+                    out_a = _mm512_xor_si512(out_a, _mm512_loadu_si512(dst + i));
+                    out_b = _mm512_xor_si512(out_b, _mm512_loadu_si512(dst + i + 32));
+                }
+                _mm512_storeu_si512(dst + i, out_a);
+                _mm512_storeu_si512(dst + i + 32, out_b);
+            }
+            return i;
+        }
+
+        template <bool accumulate>
+        ECC_TARGET_AVX2 inline size_t split16_multiply_avx2(const SplitTables16 &tables, const uint16_t *src,
+                                                            uint16_t *dst, size_t size, size_t i) noexcept
+        {
+            __m256i t[2][4];
+            for (size_t b = 0; b < 2; ++b)
+            {
+                for (size_t q = 0; q < 4; ++q)
+                {
+                    t[b][q] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(tables.nibble_bytes[b][q].data())));
+                }
+            }
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            const __m256i byte = _mm256_set1_epi16(0x00FF);
+
+            for (; i + 32 <= size; i += 32)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 16));
+                const __m256i lo = _mm256_packus_epi16(_mm256_and_si256(a, byte), _mm256_and_si256(b, byte));
+                const __m256i hi = _mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+                const __m256i x[4] = {
+                    _mm256_and_si256(lo, nibble), _mm256_and_si256(_mm256_srli_epi64(lo, 4), nibble),
+                    _mm256_and_si256(hi, nibble), _mm256_and_si256(_mm256_srli_epi64(hi, 4), nibble)};
+
+                __m256i product[2];
+                for (size_t p = 0; p < 2; ++p)
+                {
+                    product[p] = _mm256_xor_si256(_mm256_xor_si256(_mm256_shuffle_epi8(t[p][0], x[0]), _mm256_shuffle_epi8(t[p][1], x[1])),
+                                                  _mm256_xor_si256(_mm256_shuffle_epi8(t[p][2], x[2]), _mm256_shuffle_epi8(t[p][3], x[3])));
+                }
+
+                __m256i out_a = _mm256_unpacklo_epi8(product[0], product[1]);
+                __m256i out_b = _mm256_unpackhi_epi8(product[0], product[1]);
+                if constexpr (accumulate)
+                {
+                    out_a = _mm256_xor_si256(out_a, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i)));
+                    out_b = _mm256_xor_si256(out_b, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i + 16)));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), out_a);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 16), out_b);
+            }
+            return i;
+        }
+
+        template <bool accumulate>
+        ECC_TARGET_SSE42 inline size_t split16_multiply_sse42(const SplitTables16 &tables, const uint16_t *src,
+                                                              uint16_t *dst, size_t size, size_t i) noexcept
+        {
+            __m128i t[2][4];
+            for (size_t b = 0; b < 2; ++b)
+            {
+                for (size_t q = 0; q < 4; ++q)
+                {
+                    t[b][q] = _mm_load_si128(reinterpret_cast<const __m128i *>(tables.nibble_bytes[b][q].data()));
+                }
+            }
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            const __m128i byte = _mm_set1_epi16(0x00FF);
+
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+                const __m128i lo = _mm_packus_epi16(_mm_and_si128(a, byte), _mm_and_si128(b, byte));
+                const __m128i hi = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+                const __m128i x[4] = {
+                    _mm_and_si128(lo, nibble), _mm_and_si128(_mm_srli_epi64(lo, 4), nibble),
+                    _mm_and_si128(hi, nibble), _mm_and_si128(_mm_srli_epi64(hi, 4), nibble)};
+
+                __m128i product[2];
+                for (size_t p = 0; p < 2; ++p)
+                {
+                    product[p] = _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(t[p][0], x[0]), _mm_shuffle_epi8(t[p][1], x[1])),
+                                               _mm_xor_si128(_mm_shuffle_epi8(t[p][2], x[2]), _mm_shuffle_epi8(t[p][3], x[3])));
+                }
+
+                __m128i out_a = _mm_unpacklo_epi8(product[0], product[1]);
+                __m128i out_b = _mm_unpackhi_epi8(product[0], product[1]);
+                if constexpr (accumulate)
+                {
+                    out_a = _mm_xor_si128(out_a, _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i)));
+                    out_b = _mm_xor_si128(out_b, _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i + 8)));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), out_a);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 8), out_b);
+            }
+            return i;
+        }
+#endif
+
+        /// dst = c*src (accumulate = false) or dst ^= c*src (accumulate = true) over GF(2^16) words
+        template <bool accumulate>
+        inline void split16_multiply_region(const SplitTables16 &tables, const uint16_t *src, uint16_t *dst,
+                                            size_t size) noexcept
+        {
+            size_t i = 0;
+
+#if defined(ECC_X86_DISPATCH)
+            switch (active_simd_level())
+            {
+            case SimdLevel::AVX512:
+                i = split16_multiply_avx512<accumulate>(tables, src, dst, size, i);
+                [[fallthrough]];
+            case SimdLevel::AVX2:
+                i = split16_multiply_avx2<accumulate>(tables, src, dst, size, i);
+                [[fallthrough]];
+            case SimdLevel::SSE42:
+                i = split16_multiply_sse42<accumulate>(tables, src, dst, size, i);
+                break;
+            default:
+                break;
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            if (active_simd_level() == SimdLevel::NEON)
+            {
+                // vld2/vst2 split words into byte planes and interleave them back
+                uint8x16_t t[2][4];
+                for (size_t b = 0; b < 2; ++b)
+                {
+                    for (size_t q = 0; q < 4; ++q)
+                    {
+                        t[b][q] = vld1q_u8(tables.nibble_bytes[b][q].data());
+                    }
+                }
+                const uint8x16_t mask_128 = vdupq_n_u8(0x0F);
+                for (; i + 16 <= size; i += 16)
+                {
+                    const uint8x16x2_t planes = vld2q_u8(reinterpret_cast<const uint8_t *>(src + i));
+                    const uint8x16_t x[4] = {vandq_u8(planes.val[0], mask_128), vshrq_n_u8(planes.val[0], 4),
+                                             vandq_u8(planes.val[1], mask_128), vshrq_n_u8(planes.val[1], 4)};
+                    uint8x16x2_t product;
+                    for (size_t p = 0; p < 2; ++p)
+                    {
+                        product.val[p] = veorq_u8(veorq_u8(vqtbl1q_u8(t[p][0], x[0]), vqtbl1q_u8(t[p][1], x[1])),
+                                                  veorq_u8(vqtbl1q_u8(t[p][2], x[2]), vqtbl1q_u8(t[p][3], x[3])));
+                    }
+                    if constexpr (accumulate)
+                    {
+                        const uint8x16x2_t old = vld2q_u8(reinterpret_cast<const uint8_t *>(dst + i));
+                        product.val[0] = veorq_u8(product.val[0], old.val[0]);
+                        product.val[1] = veorq_u8(product.val[1], old.val[1]);
+                    }
+                    vst2q_u8(reinterpret_cast<uint8_t *>(dst + i), product);
+                }
+            }
+#endif
+
+            // Scalar tail (and full fallback without SIMD)
+            for (; i < size; ++i)
+            {
+                const uint16_t product = tables.low[src[i] & 0xFF] ^ tables.high[src[i] >> 8];
+                if constexpr (accumulate)
+                {
+                    dst[i] ^= product;
+                }
+                else
+                {
+                    dst[i] = product;
+                }
+            }
+        }
+
+        /// Constant-multiply region over the symbol width of GF(2^8) or GF(2^16)
+        template <bool accumulate>
+        inline void multiply_region(const NibbleTables &tables, const uint8_t *src, uint8_t *dst, size_t size) noexcept
+        {
+            nibble_multiply_region<accumulate>(tables, src, dst, size);
+        }
+
+        template <bool accumulate>
+        inline void multiply_region(const SplitTables16 &tables, const uint16_t *src, uint16_t *dst, size_t size) noexcept
+        {
+            split16_multiply_region<accumulate>(tables, src, dst, size);
+        }
+
+        /// dst ^= src over GF(2^16) words
+        inline void xor_region(const uint16_t *src, uint16_t *dst, size_t size) noexcept
+        {
+            xor_region(reinterpret_cast<const uint8_t *>(src), reinterpret_cast<uint8_t *>(dst), size * sizeof(uint16_t));
+        }
+    } // namespace detail
+
+    /// Bulk GF(2^8) and GF(2^16) operations over symbol buffers
+    ///
+    /// Each byte (GF(2^8)) or 16-bit word (GF(2^16)) is one field element. The kernels use
+    /// split-nibble shuffle tables (PSHUFB/VPSHUFB at the active SSE4.2/AVX2/AVX-512 level on x86,
+    /// TBL on NEON); scalar code uses the same nibble tables for GF(2^8) and 8-bit split tables for
+    /// GF(2^16).
+    namespace galois_region
+    {
+        /// dst[i] = c * src[i]
+        inline void multiply_region(const GF256 &field, uint8_t c, std::span<const uint8_t> src, std::span<uint8_t> dst)
+        {
+            if (src.size() != dst.size())
+                throw std::invalid_argument("Region sizes do not match");
+
+            if (c == 0)
+            {
+                std::fill(dst.begin(), dst.end(), uint8_t{0});
+            }
+            else if (c == 1)
+            {
+                std::copy(src.begin(), src.end(), dst.begin());
+            }
+            else
+            {
+                detail::nibble_multiply_region<false>(detail::make_nibble_tables(field, c), src.data(), dst.data(), src.size());
+            }
+        }
+
+        /// region[i] = c * region[i]
+        inline void multiply_region(const GF256 &field, uint8_t c, std::span<uint8_t> region)
+        {
+            multiply_region(field, c, std::span<const uint8_t>(region), region);
+        }
+
+        /// dst[i] ^= c * src[i]
+        inline void mul_add_region(const GF256 &field, uint8_t c, std::span<const uint8_t> src, std::span<uint8_t> dst)
+        {
+            if (src.size() != dst.size())
+                throw std::invalid_argument("Region sizes do not match");
+
+            if (c == 0)
+            {
+                return;
+            }
+            else if (c == 1)
+            {
+                detail::xor_region(src.data(), dst.data(), src.size());
+            }
+            else
+            {
+                detail::nibble_multiply_region<true>(detail::make_nibble_tables(field, c), src.data(), dst.data(), src.size());
+            }
+        }
+
+        /// dst[i] ^= src[i] (addition in GF(2^8))
+        inline void xor_region(std::span<const uint8_t> src, std::span<uint8_t> dst)
+        {
+            if (src.size() != dst.size())
+                throw std::invalid_argument("Region sizes do not match");
+
+            detail::xor_region(src.data(), dst.data(), src.size());
+        }
+
+        /// dst[i] = c * src[i] over GF(2^16) words
+        inline void multiply_region(const GF65536 &field, uint16_t c, std::span<const uint16_t> src, std::span<uint16_t> dst)
+        {
+            if (src.size() != dst.size())
+                throw std::invalid_argument("Region sizes do not match");
+
+            if (c == 0)
+            {
+                std::fill(dst.begin(), dst.end(), uint16_t{0});
+            }
+            else if (c == 1)
+            {
+                std::copy(src.begin(), src.end(), dst.begin());
+            }
+            else
+            {
+                detail::split16_multiply_region<false>(detail::make_split_tables(field, c), src.data(), dst.data(), src.size());
+            }
+        }
+
+        /// region[i] = c * region[i] over GF(2^16) words
+        inline void multiply_region(const GF65536 &field, uint16_t c, std::span<uint16_t> region)
+        {
+            multiply_region(field, c, std::span<const uint16_t>(region), region);
+        }
+
+        /// dst[i] ^= c * src[i] over GF(2^16) words
+        inline void mul_add_region(const GF65536 &field, uint16_t c, std::span<const uint16_t> src, std::span<uint16_t> dst)
+        {
+            if (src.size() != dst.size())
+                throw std::invalid_argument("Region sizes do not match");
+
+            if (c == 0)
+            {
+                return;
+            }
+            else if (c == 1)
+            {
+                detail::xor_region(src.data(), dst.data(), src.size());
+            }
+            else
+            {
+                detail::split16_multiply_region<true>(detail::make_split_tables(field, c), src.data(), dst.data(), src.size());
+            }
+        }
+
+        /// dst[i] ^= src[i] (addition in GF(2^16))
+        inline void xor_region(std::span<const uint16_t> src, std::span<uint16_t> dst)
+        {
+            if (src.size() != dst.size())
+                throw std::invalid_argument("Region sizes do not match");
+
+            detail::xor_region(src.data(), dst.data(), src.size());
+        }
     }
 
     /// Utility functions for Galois field operations
@@ -302,24 +1272,7 @@ namespace ecc
         template <size_t m>
         constexpr typename GaloisField<m>::Element get_default_primitive()
         {
-            if constexpr (m == 3)
-                return 0x0B; // x^3 + x + 1
-            else if constexpr (m == 4)
-                return 0x13; // x^4 + x + 1
-            else if constexpr (m == 5)
-                return 0x25; // x^5 + x^2 + 1
-            else if constexpr (m == 6)
-                return 0x43; // x^6 + x + 1
-            else if constexpr (m == 7)
-                return 0x89; // x^7 + x^3 + 1
-            else if constexpr (m == 8)
-                return primitive_poly_8;
-            else if constexpr (m == 10)
-                return primitive_poly_10;
-            else if constexpr (m == 12)
-                return primitive_poly_12;
-            else
-                return (1u << m) | 3; // Default: x^m + x + 1
+            return detail::default_primitive_poly<m>();
         }
 
         /// Convert polynomial to string representation
@@ -345,11 +1298,17 @@ namespace ecc
             double inv_time_ns;
             double exp_time_ns;
             size_t iterations;
+
+            // Region throughput (GF(2^8) only, 0 otherwise)
+            size_t region_bytes;
+            double region_mul_gbps;
+            double region_mul_add_gbps;
+            double region_xor_gbps;
         };
 
         /// Benchmark basic field operations
         template <size_t m>
-        BenchmarkResults<m> benchmark_field_operations(size_t iterations = 1000000);
+        BenchmarkResults<m> benchmark_field_operations(size_t iterations = 1000000, size_t region_bytes = 1 << 20);
 
         /// Print benchmark results
         template <size_t m>
@@ -0,0 +1,287 @@
+#pragma once
+
+#include "cpu_dispatch.hpp"
+#include "rng.hpp"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <span>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecc
+{
+
+    namespace detail
+    {
+        /// Natural log for u in (0, 1], branch-free (Cephes logf polynomial, ~1 ulp)
+        [[nodiscard]] inline float fast_log(float u) noexcept
+        {
+            ECC_NO_FP_CONTRACT
+            const uint32_t bits = std::bit_cast<uint32_t>(u);
+            float exponent = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+            float m = std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F800000u); // [1, 2)
+
+            // Centre the mantissa on 1: [sqrt(1/2), sqrt(2))
+            const bool high = m > 1.41421356f;
+            m = high ? m * 0.5f : m;
+            exponent = high ? exponent + 1.0f : exponent;
+
+            const float x = m - 1.0f;
+            const float z = x * x;
+            float y = 7.0376836292e-2f;
+            y = y * x - 1.1514610310e-1f;
+            y = y * x + 1.1676998740e-1f;
+            y = y * x - 1.2420140846e-1f;
+            y = y * x + 1.4249322787e-1f;
+            y = y * x - 1.6668057665e-1f;
+            y = y * x + 2.0000714765e-1f;
+            y = y * x - 2.4999993993e-1f;
+            y = y * x + 3.3333331174e-1f;
+            y = y * x * z - 0.5f * z;
+
+            return x + y + exponent * 0.69314718056f;
+        }
+
+        /// sqrt(x) for x >= 0 via a refined reciprocal square root (no errno path, so loops vectorize)
+        [[nodiscard]] inline float fast_sqrt(float x) noexcept
+        {
+            ECC_NO_FP_CONTRACT
+            float y = std::bit_cast<float>(0x5F375A86u - (std::bit_cast<uint32_t>(x) >> 1));
+            const float half = 0.5f * x;
+            y = y * (1.5f - half * y * y);
+            y = y * (1.5f - half * y * y);
+            y = y * (1.5f - half * y * y);
+            return x * y;
+        }
+
+        /// sin and cos of 2*pi*t for t in [0, 1), branch-free (quadrant fold + degree 11/12 Taylor)
+        inline void fast_sincos_2pi(float t, float &sine, float &cosine) noexcept
+        {
+            ECC_NO_FP_CONTRACT
+            constexpr float pi = 3.14159265359f;
+
+            // Angle in [-pi, pi], then fold to [0, pi/2] tracking the signs
+            const float centred = t >= 0.5f ? t - 1.0f : t;
+            const float angle = 2.0f * pi * centred;
+            const float magnitude = std::fabs(angle);
+            const bool back = magnitude > 0.5f * pi;
+            const float y = back ? pi - magnitude : magnitude;
+
+            const float y2 = y * y;
+            float s = -2.5052108e-8f;
+            s = s * y2 + 2.7557319e-6f;
+            s = s * y2 - 1.9841270e-4f;
+            s = s * y2 + 8.3333333e-3f;
+            s = s * y2 - 1.6666667e-1f;
+            s = (s * y2 + 1.0f) * y;
+
+            float c = 2.0876757e-9f;
+            c = c * y2 - 2.7557319e-7f;
+            c = c * y2 + 2.4801587e-5f;
+            c = c * y2 - 1.3888889e-3f;
+            c = c * y2 + 4.1666667e-2f;
+            c = c * y2 - 0.5f;
+            c = c * y2 + 1.0f;
+
+            sine = angle < 0.0f ? -s : s;
+            cosine = back ? -c : c;
+        }
+    } // namespace detail
+
+    /// Bulk N(0, sigma^2) generator for float buffers
+    ///
+    /// Runs `lanes` independent xoshiro256** states in structure-of-arrays form and turns each 64-bit
+    /// draw into one Box-Muller pair with branch-free float log/sqrt/sincos, so every inner loop runs across
+    /// lanes and auto-vectorizes. The radius uses 31 uniform bits, which caps |z| at about 6.6 sigma
+    /// (tail mass ~4e-11 per sample), well below the BER floors simulated here. The bulk entry points are
+    /// multi-versioned per SIMD level and give the same samples at every level.
+    class GaussianNoise
+    {
+    public:
+        static constexpr size_t lanes = 8;
+
+        /// Samples produced per generator step
+        static constexpr size_t block = 2 * lanes;
+
+    private:
+        alignas(64) std::array<uint64_t, lanes> s0{};
+        alignas(64) std::array<uint64_t, lanes> s1{};
+        alignas(64) std::array<uint64_t, lanes> s2{};
+        alignas(64) std::array<uint64_t, lanes> s3{};
+
+        /// One xoshiro256** step on every lane
+        void next(std::array<uint64_t, lanes> &out) noexcept
+        {
+            for (size_t l = 0; l < lanes; ++l)
+            {
+                const uint64_t x = s1[l] * 5;
+                out[l] = ((x << 7) | (x >> 57)) * 9;
+
+                const uint64_t t = s1[l] << 17;
+                s2[l] ^= s0[l];
+                s3[l] ^= s1[l];
+                s1[l] ^= s2[l];
+                s0[l] ^= s3[l];
+                s2[l] ^= t;
+                s3[l] = (s3[l] << 45) | (s3[l] >> 19);
+            }
+        }
+
+        /// `block` samples of N(0, sigma^2): cos branch in [0, lanes), sin branch in [lanes, block)
+        void generate_block(float *out, float sigma) noexcept
+        {
+            ECC_NO_FP_CONTRACT
+            alignas(64) std::array<uint64_t, lanes> raw;
+            next(raw);
+
+            for (size_t l = 0; l < lanes; ++l)
+            {
+                // u1 in (0, 1] from the top 31 bits, u2 in [0, 1) from 24 low bits
+                const auto high = static_cast<int32_t>(raw[l] >> 33);
+                const auto low = static_cast<int32_t>((raw[l] >> 8) & 0xFFFFFFu);
+                const float u1 = (static_cast<float>(high) + 0.5f) * 0x1.0p-31f;
+                const float u2 = static_cast<float>(low) * 0x1.0p-24f;
+
+                const float radius = sigma * detail::fast_sqrt(-2.0f * detail::fast_log(u1));
+                float sine, cosine;
+                detail::fast_sincos_2pi(u2, sine, cosine);
+                out[l] = radius * cosine;
+                out[lanes + l] = radius * sine;
+            }
+        }
+
+        /// fill() body, run inside simd_dispatch by the public entry points
+        void fill_kernel(std::span<float> out, float sigma) noexcept
+        {
+            size_t i = 0;
+            for (; i + block <= out.size(); i += block)
+            {
+                generate_block(out.data() + i, sigma);
+            }
+            if (i < out.size())
+            {
+                alignas(64) std::array<float, block> tail;
+                generate_block(tail.data(), sigma);
+                std::copy_n(tail.begin(), out.size() - i, out.begin() + i);
+            }
+        }
+
+    public:
+        explicit GaussianNoise(uint64_t seed = 0, uint64_t stream = 0) noexcept
+        {
+            Xoshiro256 seeder(seed, stream);
+            for (size_t l = 0; l < lanes; ++l)
+            {
+                s0[l] = seeder();
+                s1[l] = seeder();
+                s2[l] = seeder();
+                s3[l] = seeder();
+            }
+        }
+
+        /// Noise standard deviation for unit-energy BPSK at `snr_db`
+        [[nodiscard]] static float sigma_from_snr_db(double snr_db) noexcept
+        {
+            const double snr_linear = std::pow(10.0, snr_db / 10.0);
+            return static_cast<float>(std::sqrt(1.0 / (2.0 * snr_linear)));
+        }
+
+        /// Fill `out` with N(0, sigma^2) samples
+        void fill(std::span<float> out, float sigma = 1.0f) noexcept
+        {
+            detail::simd_dispatch([&]
+                                  { fill_kernel(out, sigma); });
+        }
+
+        /// BPSK-modulate 0/1 `bits` (0 -> -1, 1 -> +1), add noise and hard-decide back in place
+        void bpsk_hard_decision(std::span<uint8_t> bits, float sigma) noexcept
+        {
+            detail::simd_dispatch([&]
+                                  {
+                alignas(64) std::array<float, 16 * block> noise;
+
+                for (size_t offset = 0; offset < bits.size(); offset += noise.size())
+                {
+                    const size_t count = std::min(noise.size(), bits.size() - offset);
+                    fill_kernel(std::span<float>(noise.data(), count), sigma);
+
+                    uint8_t *chunk = bits.data() + offset;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const float signal = chunk[i] == 0 ? -1.0f : 1.0f;
+                        chunk[i] = (signal + noise[i]) > 0.0f ? 1 : 0;
+                    }
+                } });
+        }
+
+        /// Default int8 LLR unit, the fixed-point LSB of the LDPC and turbo soft-input decoders
+        static constexpr float default_llr_lsb = 0.25f;
+
+        /// BPSK-modulate 0/1 `bits`, add noise and write soft outputs as int8 LLRs
+        ///
+        /// llrs[i] is log P(0)/P(1) = -2y/sigma^2 of the received sample y in units of `lsb`, rounded
+        /// and saturated to [-127, 127], so a positive value favours 0 as in the decoders. Draws the
+        /// same noise sequence as bpsk_hard_decision, whose decisions match the signs of nonzero LLRs.
+        void bpsk_llr(std::span<const uint8_t> bits, std::span<int8_t> llrs, float sigma,
+                      float lsb = default_llr_lsb) noexcept
+        {
+            detail::simd_dispatch([&]
+                                  {
+                alignas(64) std::array<float, 16 * block> noise;
+                const float scale = -2.0f / (sigma * sigma * lsb);
+                const size_t size = std::min(bits.size(), llrs.size());
+
+                for (size_t offset = 0; offset < size; offset += noise.size())
+                {
+                    const size_t count = std::min(noise.size(), size - offset);
+                    fill_kernel(std::span<float>(noise.data(), count), sigma);
+
+                    const uint8_t *chunk = bits.data() + offset;
+                    int8_t *out = llrs.data() + offset;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const float signal = chunk[i] == 0 ? -1.0f : 1.0f;
+                        const float llr = std::clamp((signal + noise[i]) * scale, -127.0f, 127.0f);
+                        out[i] = static_cast<int8_t>(llr + (llr < 0.0f ? -0.5f : 0.5f));
+                    }
+                } });
+        }
+
+        /// Packed-bit variant over the first `bit_count` bits of little-endian `words`
+        ///
+        /// Draws the same noise sequence as the byte overload, so both give identical decisions.
+        void bpsk_hard_decision(std::span<uint64_t> words, size_t bit_count, float sigma) noexcept
+        {
+            detail::simd_dispatch([&]
+                                  {
+                alignas(64) std::array<float, 16 * block> noise;
+                static_assert(noise.size() % 64 == 0, "noise chunks must start on word boundaries");
+
+                for (size_t offset = 0; offset < bit_count; offset += noise.size())
+                {
+                    const size_t count = std::min(noise.size(), bit_count - offset);
+                    fill_kernel(std::span<float>(noise.data(), count), sigma);
+
+                    for (size_t w = 0; w * 64 < count; ++w)
+                    {
+                        uint64_t &word = words[offset / 64 + w];
+                        const size_t bits = std::min<size_t>(64, count - 64 * w);
+                        const float *chunk = noise.data() + 64 * w;
+
+                        uint64_t decided = 0;
+                        for (size_t b = 0; b < bits; ++b)
+                        {
+                            const float signal = ((word >> b) & 1) ? 1.0f : -1.0f;
+                            decided |= static_cast<uint64_t>((signal + chunk[b]) > 0.0f) << b;
+                        }
+
+                        const uint64_t mask = bits == 64 ? ~0ull : (1ull << bits) - 1;
+                        word = (word & ~mask) | decided;
+                    }
+                } });
+        }
+    };
+
+} // namespace ecc
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "bit_packing.hpp"
+#include "cpu_dispatch.hpp"
+#include "decoder_stats.hpp"
+#include "packed_codewords.hpp"
 #include <array>
 #include <vector>
 #include <bitset>
@@ -8,16 +12,191 @@
 #include <numeric>
 #include <concepts>
 #include <span>
+#include <bit>
+#include <optional>
+#include <cstdint>
 
 namespace ecc
 {
 
+    namespace detail
+    {
+        /// Parity (XOR of all bits) of the AND of two word arrays
+        template <size_t words>
+        [[nodiscard]] inline constexpr bool masked_parity(const std::array<uint64_t, words> &value,
+                                                          const std::array<uint64_t, words> &mask) noexcept
+        {
+            uint64_t acc = 0;
+            for (size_t w = 0; w < words; ++w)
+            {
+                acc ^= value[w] & mask[w];
+            }
+            return std::popcount(acc) & 1;
+        }
+
+        /// In-place transpose of a 64x64 bit matrix: afterwards bit j of rows[i] is the former bit i of rows[j]
+        inline void transpose_64x64(std::array<uint64_t, 64> &rows) noexcept
+        {
+            uint64_t mask = 0x00000000FFFFFFFFull;
+            for (size_t width = 32; width != 0; width >>= 1, mask ^= mask << width)
+            {
+                for (size_t i = 0; i < 64; i = ((i | width) + 1) & ~width)
+                {
+                    uint64_t swap = ((rows[i] >> width) ^ rows[i | width]) & mask;
+                    rows[i] ^= swap << width;
+                    rows[i | width] ^= swap;
+                }
+            }
+        }
+
+        /// Bit-sliced lane words: 256 lanes, XORed at the vector width of the active SIMD level
+        inline constexpr size_t slice_words = 4;
+        using Slice = std::array<uint64_t, slice_words>;
+
+        inline void slice_xor(Slice &dst, const Slice &src) noexcept
+        {
+            for (size_t w = 0; w < slice_words; ++w)
+            {
+                dst[w] ^= src[w];
+            }
+        }
+
+        /// Transpose `count` packed rows (bit b of row l) into bit slices (bit l of slice b)
+        template <size_t row_words>
+        inline void rows_to_slices(const std::array<uint64_t, row_words> *rows, size_t count,
+                                   Slice *slices, size_t bits) noexcept
+        {
+            std::array<uint64_t, 64> block;
+            for (size_t lane_word = 0; lane_word < slice_words; ++lane_word)
+            {
+                const size_t first_row = 64 * lane_word;
+                for (size_t w = 0; w < row_words; ++w)
+                {
+                    for (size_t l = 0; l < 64; ++l)
+                    {
+                        block[l] = (first_row + l < count) ? rows[first_row + l][w] : 0;
+                    }
+                    transpose_64x64(block);
+                    for (size_t b = 0; b < 64 && 64 * w + b < bits; ++b)
+                    {
+                        slices[64 * w + b][lane_word] = block[b];
+                    }
+                }
+            }
+        }
+
+        /// Transpose up to 64 bit slices back into one word per row (bit b of values[l] is bit l of slice b)
+        inline void slices_to_values(const Slice *slices, size_t slice_count,
+                                     uint64_t *values, size_t count) noexcept
+        {
+            std::array<uint64_t, 64> block;
+            for (size_t lane_word = 0; lane_word < slice_words && 64 * lane_word < count; ++lane_word)
+            {
+                for (size_t b = 0; b < 64; ++b)
+                {
+                    block[b] = (b < slice_count) ? slices[b][lane_word] : 0;
+                }
+                transpose_64x64(block);
+                for (size_t l = 0; l < 64 && 64 * lane_word + l < count; ++l)
+                {
+                    values[64 * lane_word + l] = block[l];
+                }
+            }
+        }
+    } // namespace detail
+
     /// Concept for valid Hamming code parameters
     template <size_t n, size_t k>
     concept ValidHammingParams = (n > k) && (n == (1u << (n - k)) - 1) && (k == n - (n - k));
 
+    namespace detail
+    {
+        /// Generator, parity-check and syndrome tables for Hamming(n,k), built at compile time
+        ///
+        /// Parity columns of H are the unit vectors; data bit i uses the i-th syndrome value that is
+        /// not a power of two, so every column of H is distinct and non-zero.
+        template <size_t n, size_t k>
+        struct HammingTables
+        {
+            static constexpr size_t parity_length = n - k;
+            using CodeMask = std::array<uint64_t, word_count<n>>;
+            using DataMask = std::array<uint64_t, word_count<k>>;
+
+            static_assert(n < (1u << 16), "Syndrome table entries are stored as 16-bit positions");
+
+            // Generator matrix G = [I_k | P] (k x n), one packed row per data bit
+            std::array<CodeMask, k> generator_rows{};
+
+            // Parity check matrix H = [P^T | I_(n-k)], one packed row per parity bit
+            std::array<CodeMask, parity_length> check_masks{};
+
+            // Parity part of G packed per parity bit: bit j set if data bit j feeds parity i
+            std::array<DataMask, parity_length> parity_masks{};
+
+            // Syndrome of a single error at each position (column j of H)
+            std::array<uint16_t, n> column_syndromes{};
+
+            // Syndrome lookup table for error correction (n means "no error")
+            std::array<uint16_t, (1u << parity_length)> syndrome_table{};
+
+            [[nodiscard]] static constexpr HammingTables build() noexcept
+            {
+                HammingTables tables;
+
+                size_t column = 1;
+                for (size_t i = 0; i < k; ++i, ++column)
+                {
+                    // Skip power-of-two columns, they belong to the parity bits
+                    while (std::has_single_bit(column))
+                    {
+                        ++column;
+                    }
+                    tables.column_syndromes[i] = static_cast<uint16_t>(column);
+                }
+                for (size_t i = 0; i < parity_length; ++i)
+                {
+                    tables.column_syndromes[k + i] = static_cast<uint16_t>(1u << i);
+                }
+
+                for (size_t j = 0; j < n; ++j)
+                {
+                    for (size_t i = 0; i < parity_length; ++i)
+                    {
+                        if ((tables.column_syndromes[j] >> i) & 1u)
+                        {
+                            tables.check_masks[i][j / 64] |= 1ull << (j % 64);
+                            if (j < k)
+                            {
+                                tables.parity_masks[i][j / 64] |= 1ull << (j % 64);
+                                tables.generator_rows[j][(k + i) / 64] |= 1ull << ((k + i) % 64);
+                            }
+                        }
+                    }
+
+                    if (j < k)
+                    {
+                        tables.generator_rows[j][j / 64] |= 1ull << (j % 64);
+                    }
+                }
+
+                for (auto &entry : tables.syndrome_table)
+                {
+                    entry = static_cast<uint16_t>(n);
+                }
+                for (size_t pos = 0; pos < n; ++pos)
+                {
+                    tables.syndrome_table[tables.column_syndromes[pos]] = static_cast<uint16_t>(pos);
+                }
+
+                return tables;
+            }
+        };
+    } // namespace detail
+
     /// Template class for Hamming codes with compile-time parameters
-    template <size_t n, size_t k>
+    ///
+    /// `Stats` is the decoder stats policy (see decoder_stats.hpp); the default records nothing.
+    template <size_t n, size_t k, typename Stats = NoDecoderStats>
         requires ValidHammingParams<n, k>
     class HammingCode
     {
@@ -30,45 +209,63 @@ namespace ecc
         using CodeWord = std::bitset<n>;
         using DataWord = std::bitset<k>;
         using Syndrome = std::bitset<parity_length>;
+        using SyndromeValue = size_t; // Syndrome as a table index, linear in the error pattern
 
-    private:
-        // Generator matrix G (k x n)
-        std::array<std::bitset<n>, k> generator_matrix;
+        /// Packed word representation used by the word-parallel kernels
+        static constexpr size_t code_words = detail::word_count<n>;
+        static constexpr size_t data_words = detail::word_count<k>;
+        using CodeMask = std::array<uint64_t, code_words>;
+        using DataMask = std::array<uint64_t, data_words>;
 
-        // Parity check matrix H ((n-k) x n)
-        std::array<std::bitset<n>, parity_length> parity_check_matrix;
+        /// Number of codewords processed per bit-sliced block by the batch API
+        static constexpr size_t batch_width = 64 * detail::slice_words;
 
-        // Syndrome lookup table for error correction
-        std::array<size_t, (1u << parity_length)> syndrome_table;
+    private:
+        // Shared read-only tables, computed once per <n,k> at compile time
+        static constexpr detail::HammingTables<n, k> tables = detail::HammingTables<n, k>::build();
+
+    protected:
+        ECC_NO_UNIQUE_ADDRESS Stats stats;
 
     public:
-        /// Constructor - generates the matrices
-        HammingCode()
+        /// Constructor - all tables are static, so constructing a code is free
+        constexpr HammingCode() noexcept = default;
+
+        /// Packed row i of the generator matrix G = [I_k | P]
+        [[nodiscard]] static constexpr const CodeMask &generator_row(size_t i) noexcept
         {
-            generate_matrices();
-            build_syndrome_table();
+            return tables.generator_rows[i];
+        }
+
+        /// Packed row i of the parity check matrix H = [P^T | I_(n-k)]
+        [[nodiscard]] static constexpr const CodeMask &parity_check_row(size_t i) noexcept
+        {
+            return tables.check_masks[i];
+        }
+
+        /// Syndrome produced by a single error at position pos (column pos of H)
+        [[nodiscard]] static constexpr size_t column_syndrome(size_t pos) noexcept
+        {
+            return tables.column_syndromes[pos];
         }
 
         /// Encode a data word into a codeword
         [[nodiscard]] CodeWord encode(const DataWord &data) const noexcept
         {
-            CodeWord codeword;
-
             // Systematic encoding: codeword = [data | parity]
-            for (size_t i = 0; i < k; ++i)
-            {
-                codeword[i] = data[i];
-            }
+            return detail::from_words<n>(encode_words(detail::to_words(data)));
+        }
+
+        /// Encode a packed data word (bit i of the word array is data bit i)
+        [[nodiscard]] CodeMask encode_words(const DataMask &data) const noexcept
+        {
+            CodeMask codeword{};
+            std::copy(data.begin(), data.end(), codeword.begin());
 
-            // Calculate parity bits
             for (size_t i = 0; i < parity_length; ++i)
             {
-                bool parity = false;
-                for (size_t j = 0; j < k; ++j)
-                {
-                    parity ^= (data[j] && generator_matrix[j][k + i]);
-                }
-                codeword[k + i] = parity;
+                const size_t pos = k + i;
+                codeword[pos / 64] |= static_cast<uint64_t>(detail::masked_parity(data, tables.parity_masks[i])) << (pos % 64);
             }
 
             return codeword;
@@ -77,31 +274,174 @@ namespace ecc
         /// Encode vector of data words
         [[nodiscard]] std::vector<CodeWord> encode(std::span<const DataWord> data) const
         {
-            std::vector<CodeWord> result;
-            result.reserve(data.size());
+            std::vector<CodeWord> result(data.size());
+            encode(data, std::span<CodeWord>(result));
+            return result;
+        }
 
-            for (const auto &word : data)
+        /// Bit-sliced batch encode into a caller-provided output span (no allocation)
+        void encode(std::span<const DataWord> data, std::span<CodeWord> out) const
+        {
+            if (out.size() < data.size())
+                throw std::invalid_argument("Output span too small for batch encode");
+
+            std::array<DataMask, batch_width> packed_data;
+            std::array<CodeMask, batch_width> packed_code;
+
+            for (size_t offset = 0; offset < data.size(); offset += batch_width)
             {
-                result.push_back(encode(word));
+                const size_t count = std::min(batch_width, data.size() - offset);
+                for (size_t l = 0; l < count; ++l)
+                {
+                    packed_data[l] = detail::to_words(data[offset + l]);
+                }
+
+                encode_block(packed_data.data(), packed_code.data(), count);
+
+                for (size_t l = 0; l < count; ++l)
+                {
+                    out[offset + l] = detail::from_words<n>(packed_code[l]);
+                }
             }
+        }
 
-            return result;
+        /// Bit-sliced batch encode of packed data words
+        void encode_words(std::span<const DataMask> data, std::span<CodeMask> out) const
+        {
+            if (out.size() < data.size())
+                throw std::invalid_argument("Output span too small for batch encode");
+
+            for (size_t offset = 0; offset < data.size(); offset += batch_width)
+            {
+                encode_block(data.data() + offset, out.data() + offset,
+                             std::min(batch_width, data.size() - offset));
+            }
+        }
+
+        /// Bit-sliced batch encode of a packed buffer of k-bit data words into `out` (n-bit codewords)
+        void encode(const PackedCodewords &data, PackedCodewords &out) const
+        {
+            if (data.codeword_length() != k)
+                throw std::invalid_argument("Packed data words do not match the code dimension");
+
+            out.reshape(n, data.size());
+            std::array<DataMask, batch_width> packed_data;
+            std::array<CodeMask, batch_width> packed_code;
+
+            for (size_t offset = 0; offset < data.size(); offset += batch_width)
+            {
+                const size_t count = std::min(batch_width, data.size() - offset);
+                for (size_t l = 0; l < count; ++l)
+                {
+                    packed_data[l] = data.load_words<k>(offset + l);
+                }
+
+                encode_block(packed_data.data(), packed_code.data(), count);
+
+                for (size_t l = 0; l < count; ++l)
+                {
+                    out.store_words<n>(offset + l, packed_code[l]);
+                }
+            }
         }
 
         /// Decode a received codeword with error correction
         [[nodiscard]] DataWord decode(const CodeWord &received) const
         {
-            auto syndrome = calculate_syndrome(received);
-            auto corrected = correct_errors(received, syndrome);
+            return detail::from_words<k>(decode_words(detail::to_words(received)));
+        }
+
+        /// Decode a packed codeword, correcting a single error through the syndrome table
+        [[nodiscard]] DataMask decode_words(const CodeMask &received) const noexcept
+        {
+            auto corrected = received;
+            const size_t syndrome = syndrome_words(received);
+            size_t error_pos = tables.syndrome_table[syndrome];
+            stats.record_decode(syndrome != 0, error_pos < n, error_pos < n);
+
+            if (error_pos < n)
+            {
+                corrected[error_pos / 64] ^= 1ull << (error_pos % 64);
+            }
 
             // Extract data bits (systematic code)
-            DataWord data;
-            for (size_t i = 0; i < k; ++i)
+            return extract_data(corrected);
+        }
+
+        /// Bit-sliced batch decode into a caller-provided output span; returns the number of corrected words
+        size_t decode(std::span<const CodeWord> received, std::span<DataWord> out) const
+        {
+            if (out.size() < received.size())
+                throw std::invalid_argument("Output span too small for batch decode");
+
+            std::array<CodeMask, batch_width> packed_code;
+            std::array<DataMask, batch_width> packed_data;
+            size_t corrected = 0;
+
+            for (size_t offset = 0; offset < received.size(); offset += batch_width)
             {
-                data[i] = corrected[i];
+                const size_t count = std::min(batch_width, received.size() - offset);
+                for (size_t l = 0; l < count; ++l)
+                {
+                    packed_code[l] = detail::to_words(received[offset + l]);
+                }
+
+                corrected += decode_block(packed_code.data(), packed_data.data(), count);
+
+                for (size_t l = 0; l < count; ++l)
+                {
+                    out[offset + l] = detail::from_words<k>(packed_data[l]);
+                }
             }
 
-            return data;
+            return corrected;
+        }
+
+        /// Bit-sliced batch decode of packed codewords; returns the number of corrected words
+        size_t decode_words(std::span<const CodeMask> received, std::span<DataMask> out) const
+        {
+            if (out.size() < received.size())
+                throw std::invalid_argument("Output span too small for batch decode");
+
+            size_t corrected = 0;
+            for (size_t offset = 0; offset < received.size(); offset += batch_width)
+            {
+                corrected += decode_block(received.data() + offset, out.data() + offset,
+                                          std::min(batch_width, received.size() - offset));
+            }
+
+            return corrected;
+        }
+
+        /// Bit-sliced batch decode of a packed buffer of n-bit codewords into `out` (k-bit data words);
+        /// returns the number of corrected words
+        size_t decode(const PackedCodewords &received, PackedCodewords &out) const
+        {
+            if (received.codeword_length() != n)
+                throw std::invalid_argument("Packed codewords do not match the code length");
+
+            out.reshape(k, received.size());
+            std::array<CodeMask, batch_width> packed_code;
+            std::array<DataMask, batch_width> packed_data;
+            size_t corrected = 0;
+
+            for (size_t offset = 0; offset < received.size(); offset += batch_width)
+            {
+                const size_t count = std::min(batch_width, received.size() - offset);
+                for (size_t l = 0; l < count; ++l)
+                {
+                    packed_code[l] = received.load_words<n>(offset + l);
+                }
+
+                corrected += decode_block(packed_code.data(), packed_data.data(), count);
+
+                for (size_t l = 0; l < count; ++l)
+                {
+                    out.store_words<k>(offset + l, packed_data[l]);
+                }
+            }
+
+            return corrected;
         }
 
         /// Decode with error detection (returns error position if detected)
@@ -115,7 +455,8 @@ namespace ecc
         [[nodiscard]] DecodeResult decode_with_detection(const CodeWord &received) const
         {
             auto syndrome = calculate_syndrome(received);
-            size_t error_pos = syndrome_table[syndrome.to_ulong()];
+            size_t error_pos = tables.syndrome_table[syndrome.to_ulong()];
+            stats.record_decode(syndrome.any(), error_pos < n, error_pos < n);
 
             DecodeResult result;
             result.error_detected = (error_pos < n);
@@ -145,16 +486,17 @@ namespace ecc
         /// Calculate syndrome for received codeword
         [[nodiscard]] Syndrome calculate_syndrome(const CodeWord &received) const noexcept
         {
-            Syndrome syndrome;
+            return Syndrome(syndrome_words(detail::to_words(received)));
+        }
+
+        /// Calculate the syndrome of a packed codeword as an integer index into the syndrome table
+        [[nodiscard]] size_t syndrome_words(const CodeMask &received) const noexcept
+        {
+            size_t syndrome = 0;
 
             for (size_t i = 0; i < parity_length; ++i)
             {
-                bool bit = false;
-                for (size_t j = 0; j < n; ++j)
-                {
-                    bit ^= (received[j] && parity_check_matrix[i][j]);
-                }
-                syndrome[i] = bit;
+                syndrome |= static_cast<size_t>(detail::masked_parity(received, tables.check_masks[i])) << i;
             }
 
             return syndrome;
@@ -184,78 +526,169 @@ namespace ecc
             return static_cast<double>(k) / n;
         }
 
-    private:
-        void generate_matrices()
+        /// Decoder counters (a NoDecoderStats policy holds none)
+        [[nodiscard]] const Stats &get_stats() const noexcept
         {
-            // Generate systematic generator matrix G = [I_k | P]
-            for (size_t i = 0; i < k; ++i)
-            {
-                // Identity part
-                generator_matrix[i][i] = 1;
+            return stats;
+        }
+
+        /// Decoder decision for a syndrome: writes the error positions it would flip and returns their
+        /// count, or nullopt if the decoder cannot correct it (never for a perfect Hamming code)
+        [[nodiscard]] std::optional<size_t> locate_errors(size_t syndrome, std::span<size_t> positions) const noexcept
+        {
+            if (syndrome == 0)
+                return 0;
+
+            const size_t error_pos = error_position(syndrome);
+            if (error_pos >= n)
+                return std::nullopt;
+
+            positions[0] = error_pos;
+            return 1;
+        }
+
+    protected:
+        /// Error position for a syndrome index (n if the syndrome is zero)
+        [[nodiscard]] size_t error_position(size_t syndrome) const noexcept
+        {
+            return tables.syndrome_table[syndrome];
+        }
+
+        /// Encode up to batch_width packed data words: transpose, XOR parity slices, transpose back
+        /// (multi-versioned per SIMD level)
+        void encode_block(const DataMask *data, CodeMask *out, size_t count) const noexcept
+        {
+            detail::simd_dispatch([&]
+                                  {
+                std::array<detail::Slice, k> data_slices;
+                detail::rows_to_slices(data, count, data_slices.data(), k);
 
-                // Parity part - use position-based encoding
-                for (size_t j = 0; j < parity_length; ++j)
+                std::array<detail::Slice, parity_length> parity_slices{};
+                for (size_t i = 0; i < parity_length; ++i)
                 {
-                    size_t col = k + j;
-                    size_t power = 1u << j;
-                    generator_matrix[i][col] = ((i + 1) & power) != 0;
+                    for (size_t w = 0; w < data_words; ++w)
+                    {
+                        for (uint64_t bits = tables.parity_masks[i][w]; bits != 0; bits &= bits - 1)
+                        {
+                            detail::slice_xor(parity_slices[i], data_slices[64 * w + std::countr_zero(bits)]);
+                        }
+                    }
                 }
-            }
 
-            // Generate parity check matrix H = [P^T | I_(n-k)]
-            for (size_t i = 0; i < parity_length; ++i)
-            {
-                // Parity part (transpose of P)
-                for (size_t j = 0; j < k; ++j)
+                std::array<uint64_t, batch_width> parity_values;
+                detail::slices_to_values(parity_slices.data(), parity_length, parity_values.data(), count);
+
+                for (size_t l = 0; l < count; ++l)
                 {
-                    parity_check_matrix[i][j] = generator_matrix[j][k + i];
+                    out[l] = CodeMask{};
+                    std::copy(data[l].begin(), data[l].end(), out[l].begin());
+                    insert_parity(out[l], parity_values[l]);
+                } });
+        }
+
+        /// Compute syndromes of up to batch_width packed codewords with XOR across bit slices
+        void syndrome_block(const CodeMask *received, size_t count, size_t *syndromes) const noexcept
+        {
+            detail::simd_dispatch([&]
+                                  {
+                std::array<detail::Slice, n> code_slices;
+                detail::rows_to_slices(received, count, code_slices.data(), n);
+
+                std::array<detail::Slice, parity_length> syndrome_slices{};
+                for (size_t i = 0; i < parity_length; ++i)
+                {
+                    for (size_t w = 0; w < code_words; ++w)
+                    {
+                        for (uint64_t bits = tables.check_masks[i][w]; bits != 0; bits &= bits - 1)
+                        {
+                            detail::slice_xor(syndrome_slices[i], code_slices[64 * w + std::countr_zero(bits)]);
+                        }
+                    }
                 }
 
-                // Identity part
-                parity_check_matrix[i][k + i] = 1;
-            }
+                std::array<uint64_t, batch_width> values;
+                detail::slices_to_values(syndrome_slices.data(), parity_length, values.data(), count);
+                std::copy(values.begin(), values.begin() + count, syndromes); });
         }
 
-        void build_syndrome_table()
+        /// Decode up to batch_width packed codewords through the syndrome table
+        size_t decode_block(const CodeMask *received, DataMask *out, size_t count) const noexcept
         {
-            // Initialize all entries to "no error"
-            std::fill(syndrome_table.begin(), syndrome_table.end(), n);
+            std::array<size_t, batch_width> syndromes;
+            syndrome_block(received, count, syndromes.data());
 
-            // Single-bit error patterns
-            for (size_t pos = 0; pos < n; ++pos)
+            size_t corrected = 0;
+            size_t nonzero = 0;
+            for (size_t l = 0; l < count; ++l)
             {
-                CodeWord error_pattern;
-                error_pattern[pos] = 1;
+                auto word = received[l];
+                size_t error_pos = tables.syndrome_table[syndromes[l]];
+                nonzero += syndromes[l] != 0;
+                if (error_pos < n)
+                {
+                    word[error_pos / 64] ^= 1ull << (error_pos % 64);
+                    corrected++;
+                }
+                out[l] = extract_data(word);
+            }
 
-                auto syndrome = calculate_syndrome(error_pattern);
-                syndrome_table[syndrome.to_ulong()] = pos;
+            // One update per block rather than per word
+            if constexpr (Stats::enabled)
+            {
+                stats.record(DecoderEvent::Decodes, count);
+                stats.record(DecoderEvent::NonzeroSyndromes, nonzero);
+                stats.record(DecoderEvent::CorrectedWords, corrected);
+                stats.record(DecoderEvent::CorrectedSymbols, corrected);
+                stats.record(DecoderEvent::Failures, nonzero - corrected);
             }
+
+            return corrected;
         }
 
-        [[nodiscard]] CodeWord correct_errors(const CodeWord &received, const Syndrome &syndrome) const
+        /// Systematic data bits of a packed codeword
+        [[nodiscard]] static DataMask extract_data(const CodeMask &codeword) noexcept
         {
-            size_t error_pos = syndrome_table[syndrome.to_ulong()];
-
-            if (error_pos < n)
+            DataMask data{};
+            std::copy(codeword.begin(), codeword.begin() + data_words, data.begin());
+            if constexpr (k % 64 != 0)
             {
-                auto corrected = received;
-                corrected.flip(error_pos);
-                return corrected;
+                data[data_words - 1] &= (1ull << (k % 64)) - 1;
             }
+            return data;
+        }
+
+        /// OR packed parity bits (bit i = parity i) into positions k..n-1 of a codeword
+        static void insert_parity(CodeMask &codeword, uint64_t parity) noexcept
+        {
+            constexpr size_t word = k / 64;
+            constexpr size_t shift = k % 64;
 
-            return received; // No correctable error detected
+            codeword[word] |= parity << shift;
+            if constexpr (shift + parity_length > 64)
+            {
+                codeword[word + 1] |= parity >> (64 - shift);
+            }
         }
     };
 
     /// SECDED (Single Error Correction, Double Error Detection) Hamming Code
-    template <size_t n, size_t k>
+    ///
+    /// Extends a Hamming(n,k) codeword with an overall parity bit at position n.
+    template <size_t n, size_t k, typename Stats = NoDecoderStats>
         requires ValidHammingParams<n, k>
-    class SECDEDHammingCode : public HammingCode<n + 1, k>
+    class SECDEDHammingCode : public HammingCode<n, k, Stats>
     {
     public:
-        using Base = HammingCode<n + 1, k>;
-        using typename Base::CodeWord;
+        using Base = HammingCode<n, k, Stats>;
         using typename Base::DataWord;
+        using typename Base::DataMask;
+
+        static constexpr size_t code_length = n + 1;
+        static constexpr size_t min_distance = 4;
+        static constexpr size_t code_words = detail::word_count<n + 1>;
+
+        using CodeWord = std::bitset<n + 1>;
+        using CodeMask = std::array<uint64_t, code_words>;
 
         struct SECDEDResult
         {
@@ -267,19 +700,147 @@ namespace ecc
                 DOUBLE_ERROR_DETECTED,
                 UNCORRECTABLE_ERROR
             } status;
-            size_t error_position;
+            size_t error_position; // 0-based, n + 1 if no error
         };
 
+        /// Encode a data word into an extended (n+1)-bit codeword
+        [[nodiscard]] CodeWord encode(const DataWord &data) const noexcept
+        {
+            return detail::from_words<n + 1>(encode_words(detail::to_words(data)));
+        }
+
+        /// Encode a packed data word, appending the overall parity bit
+        [[nodiscard]] CodeMask encode_words(const DataMask &data) const noexcept
+        {
+            return extend(Base::encode_words(data));
+        }
+
+        /// Decode, correcting single errors (double errors leave the data uncorrected)
+        [[nodiscard]] DataWord decode(const CodeWord &received) const
+        {
+            return decode_secded(received).data;
+        }
+
+        [[nodiscard]] constexpr size_t get_min_distance() const noexcept
+        {
+            return min_distance;
+        }
+
+        [[nodiscard]] constexpr double get_code_rate() const noexcept
+        {
+            return static_cast<double>(k) / code_length;
+        }
+
+        /// Inner syndrome with the overall parity as bit n-k, for a single error at position pos
+        [[nodiscard]] static constexpr size_t column_syndrome(size_t pos) noexcept
+        {
+            constexpr size_t parity_flag = size_t{1} << Base::parity_length;
+            return (pos < n ? Base::column_syndrome(pos) : 0) | parity_flag;
+        }
+
+        /// Decoder decision for a column_syndrome-style value (see Base::locate_errors); mirrors classify
+        [[nodiscard]] std::optional<size_t> locate_errors(size_t syndrome, std::span<size_t> positions) const noexcept
+        {
+            constexpr size_t parity_flag = size_t{1} << Base::parity_length;
+            const bool overall_parity = syndrome & parity_flag;
+            syndrome &= parity_flag - 1;
+
+            if (!overall_parity)
+            {
+                if (syndrome == 0)
+                    return 0;
+                return std::nullopt; // Double error
+            }
+
+            const size_t error_pos = syndrome == 0 ? n : this->error_position(syndrome);
+            if (syndrome != 0 && error_pos >= n)
+                return std::nullopt;
+
+            positions[0] = error_pos;
+            return 1;
+        }
+
         /// Decode with SECDED capability
         [[nodiscard]] SECDEDResult decode_secded(const CodeWord &received) const
         {
-            // Calculate syndrome and overall parity
-            auto syndrome = this->calculate_syndrome(received);
-            bool overall_parity = received.count() % 2;
+            auto packed = detail::to_words(received);
+            return classify(packed, this->syndrome_words(inner(packed)));
+        }
+
+        /// Bit-sliced batch SECDED decode into a caller-provided output span; returns the number of
+        /// words flagged as double errors
+        size_t decode_secded(std::span<const CodeWord> received, std::span<SECDEDResult> out) const
+        {
+            if (out.size() < received.size())
+                throw std::invalid_argument("Output span too small for batch decode");
+
+            std::array<CodeMask, Base::batch_width> packed;
+            std::array<typename Base::CodeMask, Base::batch_width> inner_words;
+            std::array<size_t, Base::batch_width> syndromes;
+            size_t double_errors = 0;
+
+            for (size_t offset = 0; offset < received.size(); offset += Base::batch_width)
+            {
+                const size_t count = std::min(Base::batch_width, received.size() - offset);
+                for (size_t l = 0; l < count; ++l)
+                {
+                    packed[l] = detail::to_words(received[offset + l]);
+                    inner_words[l] = inner(packed[l]);
+                }
+
+                this->syndrome_block(inner_words.data(), count, syndromes.data());
+
+                for (size_t l = 0; l < count; ++l)
+                {
+                    out[offset + l] = classify(packed[l], syndromes[l]);
+                    double_errors += out[offset + l].status == SECDEDResult::Status::DOUBLE_ERROR_DETECTED;
+                }
+            }
+
+            return double_errors;
+        }
+
+    private:
+        /// Append the overall parity bit to a packed Hamming(n,k) codeword
+        [[nodiscard]] static CodeMask extend(const typename Base::CodeMask &codeword) noexcept
+        {
+            CodeMask extended{};
+            std::copy(codeword.begin(), codeword.end(), extended.begin());
+
+            uint64_t parity = 0;
+            for (uint64_t word : codeword)
+            {
+                parity ^= word;
+            }
+            extended[n / 64] |= static_cast<uint64_t>(std::popcount(parity) & 1) << (n % 64);
+
+            return extended;
+        }
+
+        /// Inner Hamming(n,k) codeword without the overall parity bit
+        [[nodiscard]] static typename Base::CodeMask inner(const CodeMask &codeword) noexcept
+        {
+            typename Base::CodeMask result{};
+            std::copy(codeword.begin(), codeword.begin() + Base::code_words, result.begin());
+            result[Base::code_words - 1] &= ~0ull >> (64 * Base::code_words - n);
+            return result;
+        }
+
+        /// Combine syndrome and overall parity into a SECDED decision
+        [[nodiscard]] SECDEDResult classify(const CodeMask &received, size_t syndrome) const noexcept
+        {
+            uint64_t parity_acc = 0;
+            for (uint64_t word : received)
+            {
+                parity_acc ^= word;
+            }
+            const bool overall_parity = std::popcount(parity_acc) & 1;
 
             SECDEDResult result;
+            result.data = detail::from_words<k>(Base::extract_data(inner(received)));
+            result.error_position = code_length;
 
-            if (syndrome.none())
+            if (syndrome == 0)
             {
                 if (!overall_parity)
                 {
@@ -291,25 +852,267 @@ namespace ecc
                     result.error_position = n; // Error in overall parity bit
                 }
             }
-            else
+            else if (overall_parity)
             {
-                if (overall_parity)
+                // Single error - correct it
+                size_t error_pos = this->error_position(syndrome);
+                if (error_pos < n)
                 {
-                    // Single error - correct it
                     result.status = SECDEDResult::Status::SINGLE_ERROR_CORRECTED;
-                    auto decode_result = this->decode_with_detection(received);
-                    result.data = decode_result.data;
-                    result.error_position = decode_result.error_position;
+                    result.error_position = error_pos;
+                    if (error_pos < k)
+                    {
+                        result.data.flip(error_pos);
+                    }
                 }
                 else
                 {
-                    // Double error detected
-                    result.status = SECDEDResult::Status::DOUBLE_ERROR_DETECTED;
+                    result.status = SECDEDResult::Status::UNCORRECTABLE_ERROR;
+                }
+            }
+            else
+            {
+                // Double error detected
+                result.status = SECDEDResult::Status::DOUBLE_ERROR_DETECTED;
+            }
+
+            this->stats.record_decode(syndrome != 0 || overall_parity,
+                                      result.status == SECDEDResult::Status::SINGLE_ERROR_CORRECTED,
+                                      result.status == SECDEDResult::Status::SINGLE_ERROR_CORRECTED);
+            return result;
+        }
+    };
+
+    namespace detail
+    {
+        /// Column, check-byte and syndrome tables of the (72,64) Hsiao code, built at compile time
+        ///
+        /// Data columns are the 56 weight-3 bytes followed by the 8 rotations of 0x1F, so every row
+        /// of H has the same weight (27); check bit j has the column 1 << j.
+        struct SECDED72Tables
+        {
+            static constexpr uint8_t no_error = 0x80;
+            static constexpr uint8_t double_error = 0x81;  // Even-weight syndrome
+            static constexpr uint8_t uncorrectable = 0x82; // Odd weight, but not a column of H
+
+            std::array<uint8_t, 72> columns{};
+            std::array<std::array<uint8_t, 256>, 8> check_bytes{}; // Check byte of data byte p = v
+            std::array<uint8_t, 256> syndrome_action{};            // Bit to flip (0..71) or a marker
+        };
+
+        [[nodiscard]] consteval SECDED72Tables make_secded72_tables()
+        {
+            SECDED72Tables tables;
+
+            size_t bit = 0;
+            for (unsigned value = 0; value < 256 && bit < 56; ++value)
+            {
+                if (std::popcount(value) == 3)
+                {
+                    tables.columns[bit++] = static_cast<uint8_t>(value);
                 }
             }
+            for (unsigned shift = 0; shift < 8; ++shift)
+            {
+                tables.columns[bit++] = static_cast<uint8_t>((0x1Fu << shift | 0x1Fu >> (8 - shift)) & 0xFF);
+            }
+            for (unsigned j = 0; j < 8; ++j)
+            {
+                tables.columns[64 + j] = static_cast<uint8_t>(1u << j);
+            }
+
+            for (size_t p = 0; p < 8; ++p)
+            {
+                for (unsigned value = 0; value < 256; ++value)
+                {
+                    uint8_t check = 0;
+                    for (unsigned b = 0; b < 8; ++b)
+                    {
+                        if ((value >> b) & 1)
+                        {
+                            check ^= tables.columns[8 * p + b];
+                        }
+                    }
+                    tables.check_bytes[p][value] = check;
+                }
+            }
+
+            for (unsigned syndrome = 0; syndrome < 256; ++syndrome)
+            {
+                tables.syndrome_action[syndrome] = (std::popcount(syndrome) & 1) ? SECDED72Tables::uncorrectable
+                                                                                 : SECDED72Tables::double_error;
+            }
+            tables.syndrome_action[0] = SECDED72Tables::no_error;
+            for (size_t i = 0; i < 72; ++i)
+            {
+                tables.syndrome_action[tables.columns[i]] = static_cast<uint8_t>(i);
+            }
+
+            return tables;
+        }
+
+        inline constexpr SECDED72Tables secded72_tables = make_secded72_tables();
+    } // namespace detail
+
+    /// SECDED(72,64) for 64-bit memory words: a uint64_t of data plus one check byte
+    ///
+    /// A Hsiao code (odd-weight columns): check bits come from eight byte-table lookups and a single
+    /// 256-entry table turns the syndrome into the bit to flip, a double error or an uncorrectable
+    /// pattern, so no bitset or popcount is involved on either path.
+    class SECDED72
+    {
+    public:
+        static constexpr size_t code_length = 72;
+        static constexpr size_t data_length = 64;
+        static constexpr size_t min_distance = 4;
+
+        using SyndromeValue = uint8_t;
+
+        enum class Status
+        {
+            NO_ERROR,
+            SINGLE_ERROR_CORRECTED,
+            DOUBLE_ERROR_DETECTED,
+            UNCORRECTABLE_ERROR
+        };
+
+        struct DecodeResult
+        {
+            uint64_t data;
+            uint8_t check;
+            Status status;
+            size_t error_position; // 0..63 data bit, 64..71 check bit, 72 if none
+        };
+
+        /// Counts of a bulk decode
+        struct BulkCounts
+        {
+            size_t corrected = 0;
+            size_t double_errors = 0;
+            size_t uncorrectable = 0;
+        };
+
+        /// Check byte of a data word
+        [[nodiscard]] static constexpr uint8_t encode(uint64_t data) noexcept
+        {
+            const auto &tables = detail::secded72_tables.check_bytes;
+            uint8_t check = 0;
+            for (size_t p = 0; p < 8; ++p)
+            {
+                check ^= tables[p][(data >> (8 * p)) & 0xFF];
+            }
+            return check;
+        }
+
+        /// Syndrome of a stored (data, check) pair; zero for a codeword
+        [[nodiscard]] static constexpr uint8_t syndrome(uint64_t data, uint8_t check) noexcept
+        {
+            return encode(data) ^ check;
+        }
 
+        /// Decode a stored pair, returning the corrected word and what was found
+        [[nodiscard]] static constexpr DecodeResult decode(uint64_t data, uint8_t check) noexcept
+        {
+            DecodeResult result{data, check, Status::NO_ERROR, code_length};
+            result.status = correct(result.data, result.check, result.error_position);
             return result;
         }
+
+        /// Correct a stored pair in place; `error_position` receives the flipped bit (72 if none)
+        static constexpr Status correct(uint64_t &data, uint8_t &check, size_t &error_position) noexcept
+        {
+            const uint8_t action = detail::secded72_tables.syndrome_action[syndrome(data, check)];
+            error_position = code_length;
+
+            switch (action)
+            {
+            case detail::SECDED72Tables::no_error:
+                return Status::NO_ERROR;
+            case detail::SECDED72Tables::double_error:
+                return Status::DOUBLE_ERROR_DETECTED;
+            case detail::SECDED72Tables::uncorrectable:
+                return Status::UNCORRECTABLE_ERROR;
+            default:
+                break;
+            }
+
+            error_position = action;
+            if (action < data_length)
+            {
+                data ^= 1ull << action;
+            }
+            else
+            {
+                check ^= static_cast<uint8_t>(1u << (action - data_length));
+            }
+            return Status::SINGLE_ERROR_CORRECTED;
+        }
+
+        static constexpr Status correct(uint64_t &data, uint8_t &check) noexcept
+        {
+            size_t position;
+            return correct(data, check, position);
+        }
+
+        /// Syndrome of a single error at position pos (column pos of H)
+        [[nodiscard]] static constexpr uint8_t column_syndrome(size_t pos) noexcept
+        {
+            return detail::secded72_tables.columns[pos];
+        }
+
+        /// Position the decoder would flip for a syndrome (count 0 or 1), nullopt if it only detects
+        [[nodiscard]] static std::optional<size_t> locate_errors(uint8_t syndrome, std::span<size_t> positions) noexcept
+        {
+            const uint8_t action = detail::secded72_tables.syndrome_action[syndrome];
+            if (action == detail::SECDED72Tables::no_error)
+                return 0;
+            if (action >= code_length)
+                return std::nullopt;
+
+            positions[0] = action;
+            return 1;
+        }
+
+        /// Check bytes of an array of data words
+        static void encode(std::span<const uint64_t> data, std::span<uint8_t> check)
+        {
+            if (check.size() < data.size())
+                throw std::invalid_argument("Check byte span too small for bulk encode");
+
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                check[i] = encode(data[i]);
+            }
+        }
+
+        /// Correct arrays of data words and check bytes in place
+        static BulkCounts decode(std::span<uint64_t> data, std::span<uint8_t> check)
+        {
+            if (check.size() < data.size())
+                throw std::invalid_argument("Check byte span too small for bulk decode");
+
+            BulkCounts counts;
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                // Clean words cost one table pass and a compare
+                if (syndrome(data[i], check[i]) == 0)
+                    continue;
+
+                switch (correct(data[i], check[i]))
+                {
+                case Status::SINGLE_ERROR_CORRECTED:
+                    ++counts.corrected;
+                    break;
+                case Status::DOUBLE_ERROR_DETECTED:
+                    ++counts.double_errors;
+                    break;
+                default:
+                    ++counts.uncorrectable;
+                    break;
+                }
+            }
+            return counts;
+        }
     };
 
     /// Convenience type aliases for common Hamming codes
@@ -322,5 +1125,6 @@ namespace ecc
     using SECDED_16_11 = SECDEDHammingCode<15, 11>;
     using SECDED_32_26 = SECDEDHammingCode<31, 26>;
     using SECDED_64_57 = SECDEDHammingCode<63, 57>;
+    using SECDED_72_64 = SECDED72;
 
 } // namespace ecc
@@ -0,0 +1,1055 @@
+#pragma once
+
+#include "cpu_dispatch.hpp"
+#include "decoder_stats.hpp"
+#include "packed_codewords.hpp"
+#include <span>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace ecc
+{
+
+    namespace detail
+    {
+        /// Clamp to the symmetric range of a fixed-point LLR type (-max..max keeps negation safe)
+        template <typename Message>
+        [[nodiscard]] constexpr Message saturate_llr(int32_t value) noexcept
+        {
+            constexpr int32_t limit = std::numeric_limits<Message>::max();
+            return static_cast<Message>(std::clamp(value, -limit, limit));
+        }
+    } // namespace detail
+
+    /// Sparse Tanner graph of a parity-check matrix
+    ///
+    /// Edges are numbered in check-major (CSR) order: the edges of check c are
+    /// [check_offsets[c], check_offsets[c + 1]) and edge_variables[e] is the variable of edge e.
+    /// The variable-major (CSC) view lists, for variable v, the edge numbers
+    /// variable_edges[variable_offsets[v] .. variable_offsets[v + 1]), so both sides of message
+    /// passing address the same per-edge message slot; edge_checks[e] maps an edge back to its check.
+    struct TannerGraph
+    {
+        size_t variable_count = 0;
+        size_t check_count = 0;
+        size_t max_check_degree = 0;
+        std::vector<size_t> check_offsets;
+        std::vector<uint32_t> edge_variables;
+        std::vector<uint32_t> edge_checks;
+        std::vector<size_t> variable_offsets;
+        std::vector<uint32_t> variable_edges;
+
+        /// Build both views from the variable lists of each check (row of H)
+        [[nodiscard]] static TannerGraph from_rows(size_t variables, const std::vector<std::vector<size_t>> &rows)
+        {
+            TannerGraph graph;
+            graph.variable_count = variables;
+            graph.check_count = rows.size();
+
+            graph.check_offsets.resize(rows.size() + 1, 0);
+            for (size_t c = 0; c < rows.size(); ++c)
+            {
+                graph.check_offsets[c + 1] = graph.check_offsets[c] + rows[c].size();
+                graph.max_check_degree = std::max(graph.max_check_degree, rows[c].size());
+            }
+
+            graph.edge_variables.reserve(graph.check_offsets.back());
+            graph.edge_checks.reserve(graph.check_offsets.back());
+            graph.variable_offsets.assign(variables + 1, 0);
+            for (size_t c = 0; c < rows.size(); ++c)
+            {
+                for (size_t v : rows[c])
+                {
+                    if (v >= variables)
+                        throw std::invalid_argument("Parity-check entry outside the code length");
+                    graph.edge_variables.push_back(static_cast<uint32_t>(v));
+                    graph.edge_checks.push_back(static_cast<uint32_t>(c));
+                    ++graph.variable_offsets[v + 1];
+                }
+            }
+
+            // Counting sort of the edges by variable
+            std::partial_sum(graph.variable_offsets.begin(), graph.variable_offsets.end(), graph.variable_offsets.begin());
+            graph.variable_edges.resize(graph.edge_variables.size());
+            std::vector<size_t> fill(graph.variable_offsets.begin(), graph.variable_offsets.end() - 1);
+            for (size_t e = 0; e < graph.edge_variables.size(); ++e)
+            {
+                graph.variable_edges[fill[graph.edge_variables[e]]++] = static_cast<uint32_t>(e);
+            }
+
+            return graph;
+        }
+
+        [[nodiscard]] size_t edge_count() const noexcept
+        {
+            return edge_variables.size();
+        }
+
+        /// True when every check of H is satisfied by the hard decisions in `bits`
+        [[nodiscard]] bool satisfied(const std::vector<uint8_t> &bits) const noexcept
+        {
+            for (size_t c = 0; c < check_count; ++c)
+            {
+                uint8_t parity = 0;
+                for (size_t e = check_offsets[c]; e < check_offsets[c + 1]; ++e)
+                {
+                    parity ^= bits[edge_variables[e]];
+                }
+                if (parity != 0)
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    /// Base graph of a quasi-cyclic LDPC code
+    ///
+    /// Entry (r, c) is the cyclic shift of a Z x Z circulant permutation block (row i of P^s has its
+    /// one in column (i + s) mod Z), or -1 for an all-zero block. The last `rows` columns are the
+    /// parity part and must have the dual-diagonal form used by IEEE 802.11n/802.16e: a first column
+    /// with shifts (x, y, x) in rows 0, some middle row and the last row, followed by a staircase of
+    /// zero-shift identities. Shifts are taken modulo the lifting factor, so one base graph serves
+    /// several block sizes.
+    ///
+    /// Only the 802.11n rate-1/2 matrix is bundled. The 5G NR base graphs (BG1, BG2) are not: their
+    /// parity part is a double-diagonal core followed by a single-diagonal extension, which this
+    /// encoder does not accept. They also use per-set shift tables and punctured systematic columns.
+    /// NR-sized blocks can still be built by lifting an 802.11n-style graph with a larger Z.
+    struct QCBaseGraph
+    {
+        size_t rows = 0;
+        size_t columns = 0;
+        std::vector<int16_t> shifts; // Row-major, -1 = zero block
+
+        [[nodiscard]] int16_t at(size_t r, size_t c) const noexcept
+        {
+            return shifts[r * columns + c];
+        }
+
+        [[nodiscard]] size_t data_columns() const noexcept
+        {
+            return columns - rows;
+        }
+
+        /// IEEE 802.11n rate-1/2 base matrix (12 x 24, native lifting Z = 27: n = 648)
+        [[nodiscard]] static QCBaseGraph ieee80211n_rate_half()
+        {
+            constexpr int16_t _ = -1;
+            return {12, 24, {
+                0, _, _, _, 0, 0, _, _, 0, _, _, 0, 1, 0, _, _, _, _, _, _, _, _, _, _,
+                22, 0, _, _, 17, _, 0, 0, 12, _, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _,
+                6, _, 0, _, 10, _, _, _, 24, _, 0, _, _, _, 0, 0, _, _, _, _, _, _, _, _,
+                2, _, _, 0, 20, _, _, _, 25, 0, _, _, _, _, _, 0, 0, _, _, _, _, _, _, _,
+                23, _, _, _, 3, _, _, _, 0, _, 9, 11, _, _, _, _, 0, 0, _, _, _, _, _, _,
+                24, _, 23, 1, 17, _, 3, _, 10, _, _, _, _, _, _, _, _, 0, 0, _, _, _, _, _,
+                25, _, _, _, 8, _, _, _, 7, 18, _, _, 0, _, _, _, _, _, 0, 0, _, _, _, _,
+                13, 24, _, _, 0, _, 8, _, 6, _, _, _, _, _, _, _, _, _, _, 0, 0, _, _, _,
+                7, 20, _, 16, 22, 10, _, _, 23, _, _, _, _, _, _, _, _, _, _, _, 0, 0, _, _,
+                11, _, _, _, 19, _, _, _, 13, _, 3, 17, _, _, _, _, _, _, _, _, _, 0, 0, _,
+                25, _, 8, _, 23, 18, _, 14, 9, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, 0,
+                3, _, _, _, 16, _, _, 2, 25, 5, _, _, 1, _, _, _, _, _, _, _, _, _, _, 0}};
+        }
+    };
+
+    /// LDPC code with a sparse regular parity-check matrix and iterative decoding
+    ///
+    /// H = [A | B] with B dual-diagonal, so encoding is a linear-time accumulation of the data checks:
+    /// - Random codes (n, k): every data bit joins data_column_weight random checks and check i also
+    ///   covers parity bits k + i - 1 and k + i.
+    /// - Quasi-cyclic codes: H is a QCBaseGraph lifted by circulant permutations of size Z; the
+    ///   layered decoder then processes the Z rows of a block row together, lane by lane.
+    ///
+    /// Messages live on the edges of the Tanner graph (O(edges) memory) in a Workspace that callers
+    /// can keep across decodes, one per thread.
+    ///
+    /// The default decoder is layered offset min-sum on saturated int16 messages (int8 and floating
+    /// point sum-product are selectable), multi-versioned per SIMD level. Every decoder stops as soon
+    /// as all checks are satisfied. `Stats` is the decoder stats policy (see decoder_stats.hpp);
+    /// LDPCCode uses the default, which records nothing.
+    template <typename Stats = NoDecoderStats>
+    class BasicLDPCCode
+    {
+    public:
+        /// Decoding algorithm
+        enum class Algorithm
+        {
+            LayeredMinSum16,  // Row-serial offset min-sum, int16 messages
+            LayeredMinSum8,   // Row-serial offset min-sum, int8 messages
+            BeliefPropagation // Flooding sum-product, double messages
+        };
+
+    private:
+        size_t n, k;
+        TannerGraph graph;
+        size_t max_iterations;
+        Algorithm algorithm;
+
+        // Quasi-cyclic structure (lifting == 0 for random codes): block rows list their non-zero
+        // blocks as (block column, shift); message e * lifting + r belongs to row r of block entry e
+        size_t lifting = 0;
+        QCBaseGraph base_graph;
+        std::vector<size_t> block_row_offsets;
+        std::vector<uint32_t> block_columns;
+        std::vector<uint32_t> block_shifts;
+        size_t middle_row = 0; // Base row holding the second block of the first parity column
+
+        static constexpr size_t data_column_weight = 3; // Checks per data bit in random codes
+
+        ECC_NO_UNIQUE_ADDRESS Stats stats;
+
+    public:
+        /// Fixed-point LLRs count in units of fixed_point_lsb; a hard channel bit maps to +-hard_input_llr
+        /// (LLR 2.0, a crossover probability of about 0.12) and min-sum magnitudes lose min_sum_offset
+        static constexpr double fixed_point_lsb = 0.25;
+        static constexpr int32_t hard_input_llr = 8;
+        static constexpr int32_t min_sum_offset = 1;
+
+        using CodeWord = std::vector<uint8_t>;
+        using DataWord = std::vector<uint8_t>;
+
+        static constexpr size_t code_length = 0; // Dynamic
+        static constexpr size_t data_length = 0; // Dynamic
+
+        /// Reusable decoder state: per-variable LLRs and per-edge messages
+        struct Workspace
+        {
+            // Sum-product
+            std::vector<double> channel_llr;
+            std::vector<double> posterior_llr;
+            std::vector<double> check_to_var;
+            std::vector<double> var_to_check;
+
+            // Layered min-sum: a-posteriori LLRs per variable and check-to-variable messages per edge
+            std::vector<int8_t> posterior8;
+            std::vector<int8_t> messages8;
+            std::vector<int16_t> posterior16;
+            std::vector<int16_t> messages16;
+            std::vector<int32_t> row_scratch;
+            std::vector<int32_t> lane_min1;
+            std::vector<int32_t> lane_min2;
+            std::vector<int32_t> lane_min_index;
+            std::vector<int32_t> lane_sign;
+            std::vector<uint8_t> check_parity;
+
+            std::vector<uint8_t> hard_decision;
+
+            /// Size the buffers `algorithm` needs for `graph`, processing `lanes` checks at once in the
+            /// layered decoder (no reallocation once sized)
+            void prepare(const TannerGraph &graph, Algorithm algorithm, size_t lanes = 1)
+            {
+                hard_decision.resize(graph.variable_count);
+                switch (algorithm)
+                {
+                case Algorithm::BeliefPropagation:
+                    channel_llr.resize(graph.variable_count);
+                    posterior_llr.resize(graph.variable_count);
+                    check_to_var.assign(graph.edge_count(), 0.0);
+                    var_to_check.resize(graph.edge_count());
+                    break;
+                case Algorithm::LayeredMinSum8:
+                    posterior8.resize(graph.variable_count);
+                    messages8.assign(graph.edge_count(), 0);
+                    break;
+                case Algorithm::LayeredMinSum16:
+                    posterior16.resize(graph.variable_count);
+                    messages16.assign(graph.edge_count(), 0);
+                    break;
+                }
+                if (algorithm != Algorithm::BeliefPropagation)
+                {
+                    row_scratch.resize(graph.max_check_degree * lanes);
+                    lane_min1.resize(lanes);
+                    lane_min2.resize(lanes);
+                    lane_min_index.resize(lanes);
+                    lane_sign.resize(lanes);
+                    check_parity.resize(graph.check_count);
+                }
+            }
+
+            template <typename Message>
+            [[nodiscard]] std::vector<Message> &posterior() noexcept
+            {
+                if constexpr (sizeof(Message) == 1)
+                    return posterior8;
+                else
+                    return posterior16;
+            }
+
+            template <typename Message>
+            [[nodiscard]] std::vector<Message> &messages() noexcept
+            {
+                if constexpr (sizeof(Message) == 1)
+                    return messages8;
+                else
+                    return messages16;
+            }
+        };
+
+        BasicLDPCCode(size_t code_length, size_t data_length, size_t max_iter = 50,
+                 Algorithm decoder = Algorithm::LayeredMinSum16)
+            : n(code_length), k(data_length), max_iterations(max_iter), algorithm(decoder)
+        {
+            if (k == 0 || k >= n)
+                throw std::invalid_argument("LDPC data length must be in [1, code length)");
+            generate_ldpc_matrices();
+        }
+
+        /// Quasi-cyclic code: `base` lifted by circulants of size `lifting_factor`
+        BasicLDPCCode(const QCBaseGraph &base, size_t lifting_factor, size_t max_iter = 50,
+                 Algorithm decoder = Algorithm::LayeredMinSum16)
+            : n(base.columns * lifting_factor), k(base.data_columns() * lifting_factor),
+              max_iterations(max_iter), algorithm(decoder), lifting(lifting_factor), base_graph(base)
+        {
+            if (lifting == 0 || base.rows < 3 || base.columns <= base.rows || base.shifts.size() != base.rows * base.columns)
+                throw std::invalid_argument("Invalid QC-LDPC base graph or lifting factor");
+            generate_qc_matrices();
+        }
+
+        /// Encode data using LDPC code
+        [[nodiscard]] CodeWord encode(const DataWord &data) const
+        {
+            if (data.size() != k)
+                throw std::invalid_argument("Invalid data length");
+
+            CodeWord codeword(n, 0);
+
+            // Systematic encoding: copy data bits
+            std::copy(data.begin(), data.end(), codeword.begin());
+            encode_parity(codeword);
+
+            return codeword;
+        }
+
+        /// Batch encode of a packed buffer of data words into `out` (packed codewords)
+        void encode(const PackedCodewords &data, PackedCodewords &out) const
+        {
+            if (data.codeword_length() != k)
+                throw std::invalid_argument("Packed data words do not match the code dimension");
+
+            out.reshape(n, data.size());
+            CodeWord codeword(n, 0);
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                data.load_bits(i, std::span<uint8_t>(codeword).first(k));
+                encode_parity(codeword);
+                out.store_bits(i, codeword);
+            }
+        }
+
+        /// Fill the n - k parity bits of `codeword`, whose first k bits already hold the data, in place
+        void encode_parity(std::span<uint8_t> codeword) const
+        {
+            if (codeword.size() != n)
+                throw std::invalid_argument("Invalid codeword length");
+
+            if (lifting != 0)
+            {
+                encode_qc(codeword);
+                return;
+            }
+
+            // Staircase parity: p_i = (data checks of row i) + p_(i-1)
+            uint8_t previous = 0;
+            for (size_t i = 0; i < n - k; ++i)
+            {
+                uint8_t parity = previous;
+                for (size_t e = graph.check_offsets[i]; e < graph.check_offsets[i + 1]; ++e)
+                {
+                    if (graph.edge_variables[e] < k)
+                        parity ^= codeword[graph.edge_variables[e]];
+                }
+                codeword[k + i] = parity;
+                previous = parity;
+            }
+        }
+
+        /// Decode using belief propagation
+        struct DecodeResult
+        {
+            DataWord data;
+            bool success;
+            size_t iterations_used;
+        };
+
+        [[nodiscard]] DecodeResult decode(const CodeWord &received) const
+        {
+            Workspace workspace;
+            return decode(received, workspace);
+        }
+
+        /// Decode reusing `workspace` for all message buffers
+        [[nodiscard]] DecodeResult decode(const CodeWord &received, Workspace &workspace) const
+        {
+            if (received.size() != n)
+                throw std::invalid_argument("Invalid codeword length");
+
+            workspace.prepare(graph, algorithm, std::max<size_t>(lifting, 1));
+            auto channel_bit = [&](size_t i)
+            {
+                return received[i] != 0;
+            };
+            auto channel_llr = [&](size_t i)
+            {
+                return received[i] ? -hard_input_llr : hard_input_llr;
+            };
+            return run_decoder(workspace, channel_bit, channel_llr);
+        }
+
+        /// Hard-input decode that leaves the decisions in workspace.hard_decision (data bits first)
+        /// rather than copying them into a DecodeResult; returns whether every check is satisfied
+        [[nodiscard]] bool decode_into(std::span<const uint8_t> received, Workspace &workspace) const
+        {
+            if (received.size() != n)
+                throw std::invalid_argument("Invalid codeword length");
+
+            workspace.prepare(graph, algorithm, std::max<size_t>(lifting, 1));
+            auto channel_bit = [&](size_t i)
+            {
+                return received[i] != 0;
+            };
+            auto channel_llr = [&](size_t i)
+            {
+                return received[i] ? -hard_input_llr : hard_input_llr;
+            };
+            return run_iterations(workspace, channel_bit, channel_llr).success;
+        }
+
+        /// Decode soft channel output: one int8 LLR per code bit in units of fixed_point_lsb
+        ///
+        /// Positive values favour 0, as in the hard-input path, which is the special case
+        /// llrs[i] = +-hard_input_llr. Reliable bits now outweigh unreliable ones from the first
+        /// iteration, so the decoder converges in fewer iterations than on hard decisions of the
+        /// same channel. int16 and floating-point decoders take the values unchanged; the int8
+        /// decoder clamps -128 to -127.
+        [[nodiscard]] DecodeResult decode(std::span<const int8_t> llrs) const
+        {
+            Workspace workspace;
+            return decode(llrs, workspace);
+        }
+
+        /// Soft-input decode reusing `workspace` for all message buffers
+        [[nodiscard]] DecodeResult decode(std::span<const int8_t> llrs, Workspace &workspace) const
+        {
+            if (llrs.size() != n)
+                throw std::invalid_argument("Invalid LLR count");
+
+            workspace.prepare(graph, algorithm, std::max<size_t>(lifting, 1));
+            auto channel_bit = [&](size_t i)
+            {
+                return llrs[i] < 0;
+            };
+            auto channel_llr = [&](size_t i)
+            {
+                return int32_t{llrs[i]};
+            };
+            return run_decoder(workspace, channel_bit, channel_llr);
+        }
+
+        /// Batch hard-input decode of a packed buffer of codewords into `out` (packed data words);
+        /// returns the number of words that still fail a parity check, whose decisions are stored as is
+        size_t decode(const PackedCodewords &received, PackedCodewords &out) const
+        {
+            Workspace workspace;
+            return decode(received, out, workspace);
+        }
+
+        /// Packed batch decode reusing `workspace` for all message buffers
+        size_t decode(const PackedCodewords &received, PackedCodewords &out, Workspace &workspace) const
+        {
+            if (received.codeword_length() != n)
+                throw std::invalid_argument("Packed codewords do not match the code length");
+
+            out.reshape(k, received.size());
+            size_t failures = 0;
+            for (size_t w = 0; w < received.size(); ++w)
+            {
+                workspace.prepare(graph, algorithm, std::max<size_t>(lifting, 1));
+                auto channel_bit = [&](size_t i)
+                {
+                    return received.get(w, i);
+                };
+                auto channel_llr = [&](size_t i)
+                {
+                    return received.get(w, i) ? -hard_input_llr : hard_input_llr;
+                };
+                failures += !run_iterations(workspace, channel_bit, channel_llr).success;
+                out.store_bits(w, std::span<const uint8_t>(workspace.hard_decision).first(k));
+            }
+
+            return failures;
+        }
+
+        /// Workspace already sized for this code
+        [[nodiscard]] Workspace make_workspace() const
+        {
+            Workspace workspace;
+            workspace.prepare(graph, algorithm, std::max<size_t>(lifting, 1));
+            return workspace;
+        }
+
+        void set_algorithm(Algorithm decoder) noexcept
+        {
+            algorithm = decoder;
+        }
+
+        [[nodiscard]] Algorithm get_algorithm() const noexcept
+        {
+            return algorithm;
+        }
+
+        /// Sparse parity-check matrix
+        [[nodiscard]] const TannerGraph &get_tanner_graph() const noexcept
+        {
+            return graph;
+        }
+
+        [[nodiscard]] size_t get_code_length() const noexcept { return n; }
+        [[nodiscard]] size_t get_data_length() const noexcept { return k; }
+
+        /// Circulant size of a quasi-cyclic code, 0 for random codes
+        [[nodiscard]] size_t get_lifting_factor() const noexcept { return lifting; }
+
+        /// Decoder counters (a NoDecoderStats policy holds none)
+        [[nodiscard]] const Stats &get_stats() const noexcept { return stats; }
+
+    private:
+        void generate_ldpc_matrices()
+        {
+            const size_t parity_bits = n - k;
+            const size_t column_weight = std::min(data_column_weight, parity_bits);
+            std::vector<std::vector<size_t>> rows(parity_bits);
+
+            std::mt19937 rng(42); // Fixed seed for reproducibility
+            std::uniform_int_distribution<size_t> dist(0, parity_bits - 1);
+
+            // Column-regular data part: distinct random checks per data bit
+            std::vector<size_t> checks;
+            for (size_t v = 0; v < k; ++v)
+            {
+                checks.clear();
+                while (checks.size() < column_weight)
+                {
+                    const size_t check = dist(rng);
+                    if (std::find(checks.begin(), checks.end(), check) == checks.end())
+                        checks.push_back(check);
+                }
+                for (size_t check : checks)
+                {
+                    rows[check].push_back(v);
+                }
+            }
+
+            // Dual-diagonal parity part
+            for (size_t i = 0; i < parity_bits; ++i)
+            {
+                if (i > 0)
+                    rows[i].push_back(k + i - 1);
+                rows[i].push_back(k + i);
+            }
+
+            graph = TannerGraph::from_rows(n, rows);
+        }
+
+        /// Validate the dual-diagonal parity part of the base graph and lift it into the Tanner graph
+        void generate_qc_matrices()
+        {
+            const size_t mb = base_graph.rows;
+            const size_t kb = base_graph.data_columns();
+            const auto shift = [&](size_t r, size_t c)
+            { return base_graph.at(r, kb + c); };
+
+            // First parity column: equal shifts in rows 0 and mb-1 plus one middle block
+            size_t middle_blocks = 0;
+            for (size_t r = 1; r + 1 < mb; ++r)
+            {
+                if (shift(r, 0) >= 0)
+                {
+                    middle_row = r;
+                    ++middle_blocks;
+                }
+            }
+            bool valid = shift(0, 0) >= 0 && shift(0, 0) == shift(mb - 1, 0) && middle_blocks == 1;
+
+            // Remaining parity columns: zero-shift staircase
+            for (size_t c = 1; c < mb && valid; ++c)
+            {
+                for (size_t r = 0; r < mb; ++r)
+                {
+                    const bool on_diagonal = (r == c - 1 || r == c);
+                    valid = valid && (on_diagonal ? shift(r, c) == 0 : shift(r, c) < 0);
+                }
+            }
+            if (!valid)
+                throw std::invalid_argument("QC-LDPC base graph parity part is not dual-diagonal");
+
+            block_row_offsets.assign(1, 0);
+            std::vector<std::vector<size_t>> rows(mb * lifting);
+            for (size_t r = 0; r < mb; ++r)
+            {
+                for (size_t c = 0; c < base_graph.columns; ++c)
+                {
+                    if (base_graph.at(r, c) < 0)
+                        continue;
+
+                    const size_t s = static_cast<size_t>(base_graph.at(r, c)) % lifting;
+                    block_columns.push_back(static_cast<uint32_t>(c));
+                    block_shifts.push_back(static_cast<uint32_t>(s));
+                    for (size_t i = 0; i < lifting; ++i)
+                    {
+                        rows[r * lifting + i].push_back(c * lifting + (i + s) % lifting);
+                    }
+                }
+                block_row_offsets.push_back(block_columns.size());
+            }
+
+            graph = TannerGraph::from_rows(n, rows);
+        }
+
+        /// Parity of a lifted QC codeword whose data part is already in place
+        ///
+        /// With lambda_r the data part of block row r, summing all block rows leaves P^y p_0 (the
+        /// x-shifted blocks cancel), so p_0 is one rotation of sum(lambda_r). The staircase then gives
+        /// p_1 = lambda_0 + P^x p_0 and p_(r+1) = lambda_r + p_r (+ P^y p_0 in the middle row).
+        ///
+        /// Works inside the parity section: lambda_r is built in parity block r + 1 (lambda_(mb-1) in
+        /// block 0, which then collects the sum), so each p_(r+1) overwrites the lambda_r it consumes.
+        void encode_qc(std::span<uint8_t> codeword) const
+        {
+            const size_t mb = base_graph.rows;
+            const size_t kb = base_graph.data_columns();
+            const size_t z = lifting;
+            uint8_t *parity = codeword.data() + k;
+
+            // lambda_r for every block row, from the data blocks only
+            std::fill(parity, parity + mb * z, uint8_t{0});
+            for (size_t r = 0; r < mb; ++r)
+            {
+                uint8_t *row = parity + ((r + 1) % mb) * z;
+                for (size_t e = block_row_offsets[r]; e < block_row_offsets[r + 1]; ++e)
+                {
+                    if (block_columns[e] >= kb)
+                        continue;
+
+                    const uint8_t *block = codeword.data() + block_columns[e] * z;
+                    rotate_accumulate(block, block_shifts[e], row);
+                }
+            }
+
+            const auto shift_of = [&](size_t r)
+            { return static_cast<size_t>(base_graph.at(r, kb)) % z; };
+            const size_t x = shift_of(0);
+            const size_t y = shift_of(middle_row);
+
+            // P^y p_0 = sum(lambda_r)  =>  p_0[(i + y) mod z] = sum[i]
+            for (size_t r = 1; r < mb; ++r)
+            {
+                for (size_t i = 0; i < z; ++i)
+                {
+                    parity[i] ^= parity[r * z + i];
+                }
+            }
+            std::rotate(parity, parity + (z - y) % z, parity + z);
+
+            // p_1 = lambda_0 + P^x p_0
+            rotate_accumulate(parity, x, parity + z);
+
+            // p_(r+1) = lambda_r + p_r (+ P^y p_0 in the middle row)
+            for (size_t r = 1; r + 1 < mb; ++r)
+            {
+                uint8_t *next = parity + (r + 1) * z;
+                const uint8_t *current = parity + r * z;
+                for (size_t i = 0; i < z; ++i)
+                {
+                    next[i] ^= current[i];
+                }
+                if (r == middle_row)
+                    rotate_accumulate(parity, y, next);
+            }
+        }
+
+        /// out ^= P^shift * block over one circulant (out[i] ^= block[(i + shift) mod Z])
+        void rotate_accumulate(const uint8_t *block, size_t shift, uint8_t *out) const noexcept
+        {
+            const size_t z = lifting;
+            for (size_t i = 0; i < z - shift; ++i)
+            {
+                out[i] ^= block[i + shift];
+            }
+            for (size_t i = z - shift; i < z; ++i)
+            {
+                out[i] ^= block[i + shift - z];
+            }
+        }
+
+        /// Flooding-schedule sum-product over the edge messages in `ws`
+        ///
+        /// Leaves hard decisions in ws and returns the iterations run (0 when the input already
+        /// satisfies every check).
+        size_t belief_propagation(Workspace &ws) const
+        {
+            ws.posterior_llr = ws.channel_llr;
+            for (size_t v = 0; v < n; ++v)
+            {
+                ws.hard_decision[v] = ws.channel_llr[v] < 0 ? 1 : 0;
+            }
+            if (graph.satisfied(ws.hard_decision))
+                return 0;
+
+            for (size_t iter = 0; iter < max_iterations; ++iter)
+            {
+                // Variable to check: posterior minus the check's own contribution
+                for (size_t e = 0; e < graph.edge_count(); ++e)
+                {
+                    ws.var_to_check[e] = std::tanh((ws.posterior_llr[graph.edge_variables[e]] - ws.check_to_var[e]) / 2.0);
+                }
+
+                // Check to variable: tanh rule over the other edges of each check
+                for (size_t c = 0; c < graph.check_count; ++c)
+                {
+                    const size_t first = graph.check_offsets[c];
+                    const size_t last = graph.check_offsets[c + 1];
+                    for (size_t e = first; e < last; ++e)
+                    {
+                        double product = 1.0;
+                        for (size_t other = first; other < last; ++other)
+                        {
+                            if (other != e)
+                                product *= ws.var_to_check[other];
+                        }
+                        ws.check_to_var[e] = 2.0 * std::atanh(std::max(-0.999, std::min(0.999, product)));
+                    }
+                }
+
+                // Update posterior LLR
+                for (size_t v = 0; v < n; ++v)
+                {
+                    double sum = ws.channel_llr[v];
+                    for (size_t j = graph.variable_offsets[v]; j < graph.variable_offsets[v + 1]; ++j)
+                    {
+                        sum += ws.check_to_var[graph.variable_edges[j]];
+                    }
+                    ws.posterior_llr[v] = sum;
+                    ws.hard_decision[v] = sum < 0 ? 1 : 0;
+                }
+
+                if (graph.satisfied(ws.hard_decision))
+                    return iter + 1;
+            }
+
+            return max_iterations;
+        }
+
+        struct IterationResult
+        {
+            bool success;
+            size_t iterations_used;
+        };
+
+        /// Run the configured decoder on the channel (`channel_llr(i)` in fixed-point units, with hard
+        /// decision `channel_bit(i)`) of a prepared workspace
+        template <typename ChannelBit, typename ChannelLLR>
+        [[nodiscard]] DecodeResult run_decoder(Workspace &workspace, ChannelBit channel_bit, ChannelLLR channel_llr) const
+        {
+            const IterationResult result = run_iterations(workspace, channel_bit, channel_llr);
+            DataWord data(workspace.hard_decision.begin(), workspace.hard_decision.begin() + k);
+            return {data, result.success, result.iterations_used};
+        }
+
+        /// Iterate to convergence, leaving the decisions in workspace.hard_decision
+        template <typename ChannelBit, typename ChannelLLR>
+        IterationResult run_iterations(Workspace &workspace, ChannelBit channel_bit, ChannelLLR channel_llr) const
+        {
+            size_t iterations = 0;
+            switch (algorithm)
+            {
+            case Algorithm::BeliefPropagation:
+                for (size_t i = 0; i < n; ++i)
+                {
+                    workspace.channel_llr[i] = channel_llr(i) * fixed_point_lsb;
+                }
+                iterations = belief_propagation(workspace);
+                break;
+            case Algorithm::LayeredMinSum8:
+                load_channel<int8_t>(workspace, channel_bit, channel_llr);
+                iterations = detail::simd_dispatch([&]
+                                                   { return lifting ? layered_min_sum_qc<int8_t>(workspace) : layered_min_sum<int8_t>(workspace); });
+                break;
+            case Algorithm::LayeredMinSum16:
+                load_channel<int16_t>(workspace, channel_bit, channel_llr);
+                iterations = detail::simd_dispatch([&]
+                                                   { return lifting ? layered_min_sum_qc<int16_t>(workspace) : layered_min_sum<int16_t>(workspace); });
+                break;
+            }
+
+            // Check if decoding was successful
+            bool success = graph.satisfied(workspace.hard_decision);
+
+            // The bit comparison only runs with a stats policy enabled
+            if constexpr (Stats::enabled)
+            {
+                size_t flipped = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    flipped += (workspace.hard_decision[i] != 0) != channel_bit(i);
+                }
+
+                // Every decoder returns 0 iterations exactly when the channel hard decisions already
+                // satisfy all checks; with max_iterations == 0 the decisions are the input itself
+                const bool error_detected = iterations > 0 || !success;
+                stats.record_decode(error_detected, success, flipped);
+                stats.record(DecoderEvent::Iterations, iterations);
+            }
+
+            return {success, iterations};
+        }
+
+        /// Saturate the channel LLRs into the a-posteriori messages and take their hard decisions
+        template <typename Message, typename ChannelBit, typename ChannelLLR>
+        void load_channel(Workspace &ws, ChannelBit channel_bit, ChannelLLR channel_llr) const
+        {
+            auto &posterior = ws.posterior<Message>();
+            for (size_t v = 0; v < n; ++v)
+            {
+                posterior[v] = detail::saturate_llr<Message>(channel_llr(v));
+                ws.hard_decision[v] = channel_bit(v) ? 1 : 0;
+            }
+        }
+
+        /// Layered (row-serial) offset min-sum on saturated fixed-point messages
+        ///
+        /// Each check in turn removes its old message from the a-posteriori LLRs, computes the two
+        /// smallest magnitudes and the sign parity of its inputs, and folds the new offset message
+        /// back in. Check parities are kept current as hard decisions flip, so the decoder stops after
+        /// the first layer that leaves no unsatisfied check. Returns the iterations run, counting a
+        /// partial last iteration as one.
+        template <typename Message>
+        size_t layered_min_sum(Workspace &ws) const
+        {
+            auto &posterior = ws.posterior<Message>();
+            auto &messages = ws.messages<Message>();
+            auto &parity = ws.check_parity;
+            int32_t *incoming = ws.row_scratch.data();
+
+            size_t unsatisfied = 0;
+            for (size_t c = 0; c < graph.check_count; ++c)
+            {
+                uint8_t p = 0;
+                for (size_t e = graph.check_offsets[c]; e < graph.check_offsets[c + 1]; ++e)
+                {
+                    p ^= ws.hard_decision[graph.edge_variables[e]];
+                }
+                parity[c] = p;
+                unsatisfied += p;
+            }
+            if (unsatisfied == 0)
+                return 0;
+
+            constexpr int32_t limit = std::numeric_limits<Message>::max();
+            for (size_t iter = 0; iter < max_iterations; ++iter)
+            {
+                for (size_t c = 0; c < graph.check_count; ++c)
+                {
+                    const size_t first = graph.check_offsets[c];
+                    const size_t degree = graph.check_offsets[c + 1] - first;
+
+                    int32_t min1 = limit;
+                    int32_t min2 = limit;
+                    size_t min_index = 0;
+                    uint32_t sign = 0;
+
+                    for (size_t i = 0; i < degree; ++i)
+                    {
+                        const size_t e = first + i;
+                        const int32_t q = detail::saturate_llr<Message>(
+                            int32_t{posterior[graph.edge_variables[e]]} - int32_t{messages[e]});
+                        incoming[i] = q;
+
+                        const int32_t magnitude = q < 0 ? -q : q;
+                        sign ^= static_cast<uint32_t>(q < 0);
+                        if (magnitude < min1)
+                        {
+                            min2 = min1;
+                            min1 = magnitude;
+                            min_index = i;
+                        }
+                        else if (magnitude < min2)
+                        {
+                            min2 = magnitude;
+                        }
+                    }
+
+                    const int32_t offset1 = std::max(min1 - min_sum_offset, 0);
+                    const int32_t offset2 = std::max(min2 - min_sum_offset, 0);
+
+                    for (size_t i = 0; i < degree; ++i)
+                    {
+                        const size_t e = first + i;
+                        const int32_t q = incoming[i];
+                        const int32_t magnitude = (i == min_index) ? offset2 : offset1;
+                        const int32_t r = (sign ^ static_cast<uint32_t>(q < 0)) ? -magnitude : magnitude;
+                        messages[e] = static_cast<Message>(r);
+
+                        const Message updated = detail::saturate_llr<Message>(q + r);
+                        const uint32_t v = graph.edge_variables[e];
+                        posterior[v] = updated;
+
+                        const uint8_t bit = updated < 0 ? 1 : 0;
+                        if (bit != ws.hard_decision[v])
+                        {
+                            ws.hard_decision[v] = bit;
+                            for (size_t j = graph.variable_offsets[v]; j < graph.variable_offsets[v + 1]; ++j)
+                            {
+                                const uint32_t check = graph.edge_checks[graph.variable_edges[j]];
+                                parity[check] ^= 1;
+                                unsatisfied = parity[check] ? unsatisfied + 1 : unsatisfied - 1;
+                            }
+                        }
+                    }
+
+                    if (unsatisfied == 0)
+                        return iter + 1;
+                }
+            }
+
+            return max_iterations;
+        }
+
+        /// Layered offset min-sum for quasi-cyclic codes, one block row (Z checks) per layer
+        ///
+        /// The Z checks of a block row touch disjoint variables, so they run as Z independent lanes:
+        /// every loop below walks the lanes of one circulant with unit stride (the rotation splits into
+        /// two contiguous runs), which the compiler vectorizes. Messages are stored lane-major per
+        /// block entry. Early termination works as in layered_min_sum, checked after each block row.
+        template <typename Message>
+        size_t layered_min_sum_qc(Workspace &ws) const
+        {
+            auto &posterior = ws.posterior<Message>();
+            auto &messages = ws.messages<Message>();
+            auto &parity = ws.check_parity;
+            const size_t z = lifting;
+            int32_t *min1 = ws.lane_min1.data();
+            int32_t *min2 = ws.lane_min2.data();
+            int32_t *min_index = ws.lane_min_index.data();
+            int32_t *sign = ws.lane_sign.data();
+
+            size_t unsatisfied = 0;
+            for (size_t c = 0; c < graph.check_count; ++c)
+            {
+                uint8_t p = 0;
+                for (size_t e = graph.check_offsets[c]; e < graph.check_offsets[c + 1]; ++e)
+                {
+                    p ^= ws.hard_decision[graph.edge_variables[e]];
+                }
+                parity[c] = p;
+                unsatisfied += p;
+            }
+            if (unsatisfied == 0)
+                return 0;
+
+            constexpr int32_t limit = std::numeric_limits<Message>::max();
+            for (size_t iter = 0; iter < max_iterations; ++iter)
+            {
+                for (size_t r = 0; r + 1 < block_row_offsets.size(); ++r)
+                {
+                    const size_t first = block_row_offsets[r];
+                    const size_t degree = block_row_offsets[r + 1] - first;
+
+                    std::fill(min1, min1 + z, limit);
+                    std::fill(min2, min2 + z, limit);
+                    std::fill(min_index, min_index + z, 0);
+                    std::fill(sign, sign + z, 0);
+
+                    // Variable-to-check inputs, lane i reading variable (i + shift) mod Z of the block
+                    for (size_t d = 0; d < degree; ++d)
+                    {
+                        const size_t e = first + d;
+                        const Message *block = posterior.data() + block_columns[e] * z;
+                        const Message *old = messages.data() + e * z;
+                        int32_t *incoming = ws.row_scratch.data() + d * z;
+                        const size_t s = block_shifts[e];
+
+                        for (size_t i = 0; i < z - s; ++i)
+                        {
+                            incoming[i] = int32_t{block[i + s]} - int32_t{old[i]};
+                        }
+                        for (size_t i = z - s; i < z; ++i)
+                        {
+                            incoming[i] = int32_t{block[i + s - z]} - int32_t{old[i]};
+                        }
+
+                        const int32_t index = static_cast<int32_t>(d);
+                        for (size_t i = 0; i < z; ++i)
+                        {
+                            const int32_t q = std::clamp(incoming[i], -limit, limit);
+                            incoming[i] = q;
+                            const int32_t magnitude = q < 0 ? -q : q;
+                            sign[i] ^= static_cast<int32_t>(q < 0);
+                            const bool smallest = magnitude < min1[i];
+                            min2[i] = smallest ? min1[i] : std::min(min2[i], magnitude);
+                            min_index[i] = smallest ? index : min_index[i];
+                            min1[i] = smallest ? magnitude : min1[i];
+                        }
+                    }
+
+                    for (size_t i = 0; i < z; ++i)
+                    {
+                        min1[i] = std::max(min1[i] - min_sum_offset, 0);
+                        min2[i] = std::max(min2[i] - min_sum_offset, 0);
+                    }
+
+                    // New messages and a-posteriori LLRs, then parity bookkeeping for flipped bits
+                    for (size_t d = 0; d < degree; ++d)
+                    {
+                        const size_t e = first + d;
+                        const size_t base = block_columns[e] * z;
+                        Message *out = messages.data() + e * z;
+                        const int32_t *incoming = ws.row_scratch.data() + d * z;
+                        const size_t s = block_shifts[e];
+                        const int32_t index = static_cast<int32_t>(d);
+
+                        for (size_t i = 0; i < z; ++i)
+                        {
+                            const int32_t q = incoming[i];
+                            const int32_t magnitude = (min_index[i] == index) ? min2[i] : min1[i];
+                            const int32_t r_value = (sign[i] ^ static_cast<int32_t>(q < 0)) ? -magnitude : magnitude;
+                            out[i] = static_cast<Message>(r_value);
+                        }
+
+                        for (size_t i = 0; i < z; ++i)
+                        {
+                            const size_t v = base + (i + s < z ? i + s : i + s - z);
+                            const Message updated = detail::saturate_llr<Message>(incoming[i] + int32_t{out[i]});
+                            posterior[v] = updated;
+
+                            const uint8_t bit = updated < 0 ? 1 : 0;
+                            if (bit != ws.hard_decision[v])
+                            {
+                                ws.hard_decision[v] = bit;
+                                for (size_t j = graph.variable_offsets[v]; j < graph.variable_offsets[v + 1]; ++j)
+                                {
+                                    const uint32_t check = graph.edge_checks[graph.variable_edges[j]];
+                                    parity[check] ^= 1;
+                                    unsatisfied = parity[check] ? unsatisfied + 1 : unsatisfied - 1;
+                                }
+                            }
+                        }
+                    }
+
+                    if (unsatisfied == 0)
+                        return iter + 1;
+                }
+            }
+
+            return max_iterations;
+        }
+    };
+
+    using LDPCCode = BasicLDPCCode<>;
+
+} // namespace ecc
@@ -0,0 +1,516 @@
+#pragma once
+
+#include "hamming_code.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ecc
+{
+
+    namespace detail
+    {
+        /// Hint that `address` will be read soon without keeping it in the cache hierarchy
+        inline void prefetch_streaming(const void *address) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address, 0, 0);
+#else
+            (void)address;
+#endif
+        }
+
+        /// CPUs listed in a sysfs cpulist string such as "0-3,8,10-11"
+        [[nodiscard]] inline std::vector<size_t> parse_cpu_list(const std::string &list)
+        {
+            std::vector<size_t> cpus;
+            size_t pos = 0;
+            while (pos < list.size())
+            {
+                size_t end = list.find(',', pos);
+                if (end == std::string::npos)
+                    end = list.size();
+
+                const std::string range = list.substr(pos, end - pos);
+                const size_t dash = range.find('-');
+                if (!range.empty() && range.find_first_not_of("0123456789-\n") == std::string::npos)
+                {
+                    const size_t first = std::stoul(range.substr(0, dash));
+                    const size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+                    for (size_t cpu = first; cpu <= last; ++cpu)
+                    {
+                        cpus.push_back(cpu);
+                    }
+                }
+                pos = end + 1;
+            }
+            return cpus;
+        }
+
+        /// Restrict the calling thread to the CPUs of NUMA node `node`; false where unsupported
+        inline bool pin_to_numa_node(int node)
+        {
+#if defined(__linux__)
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            std::string list;
+            if (!file || !std::getline(file, list))
+                return false;
+
+            const auto cpus = parse_cpu_list(list);
+            if (cpus.empty())
+                return false;
+
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (size_t cpu : cpus)
+            {
+                if (cpu < CPU_SETSIZE)
+                    CPU_SET(cpu, &set);
+            }
+            return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+            (void)node;
+            return false;
+#endif
+        }
+    } // namespace detail
+
+    /// Background scrubber for SECDED(72,64)-protected memory
+    ///
+    /// Walks a data array and its check-byte array one cache line (8 words, 8 check bytes) at a
+    /// time with streaming prefetches, corrects single-bit errors in place and logs double errors
+    /// with their addresses. Words are read through std::atomic_ref and a correction is written back
+    /// with a compare-exchange against the word it was computed from, so a concurrent application
+    /// store is never overwritten with stale data; the application must still update a word and its
+    /// check byte together (SECDED72::encode) for the pair to verify.
+    class MemoryScrubber
+    {
+    public:
+        static constexpr size_t line_words = 8;    // 64-byte cache line of data
+        static constexpr size_t prefetch_lines = 8; // Distance ahead of the scan
+        static constexpr size_t batch_lines = 64;   // Lines between rate-limit checks and counter flushes
+        static constexpr size_t default_event_capacity = 1024;
+
+        /// An uncorrectable word found by the scrubber
+        struct Event
+        {
+            size_t word_index;
+            const uint64_t *address;
+            uint64_t data;
+            uint8_t check;
+            SECDED72::Status status; // DOUBLE_ERROR_DETECTED or UNCORRECTABLE_ERROR
+        };
+
+        /// Snapshot of the scrubber counters
+        struct Counters
+        {
+            uint64_t words_scanned = 0;
+            uint64_t passes = 0; // Complete passes over the whole region
+            uint64_t corrected = 0;
+            uint64_t double_errors = 0;
+            uint64_t uncorrectable = 0;
+            uint64_t races = 0; // Corrections skipped because the word changed underneath
+            uint64_t events_dropped = 0;
+            uint64_t throttle_ns = 0; // Time spent waiting on the rate limit
+        };
+
+    private:
+        std::span<uint64_t> data;
+        std::span<uint8_t> check;
+
+        size_t threads = 1;
+        double rate_limit = 0.0; // Protected bytes (data + check) per second, 0 = unlimited
+        int numa_node = -1;
+        std::chrono::nanoseconds pass_interval{0};
+        size_t event_capacity = default_event_capacity;
+
+        struct alignas(64) Shared
+        {
+            std::atomic<uint64_t> words_scanned{0};
+            std::atomic<uint64_t> corrected{0};
+            std::atomic<uint64_t> double_errors{0};
+            std::atomic<uint64_t> uncorrectable{0};
+            std::atomic<uint64_t> races{0};
+            std::atomic<uint64_t> events_dropped{0};
+            std::atomic<uint64_t> throttle_ns{0};
+            std::atomic<uint64_t> passes{0}; // scrub_pass() calls and passes of stopped background runs
+        } shared;
+
+        std::vector<std::unique_ptr<std::atomic<uint64_t>>> thread_passes; // Guarded by state_mutex
+
+        std::mutex event_mutex;
+        std::vector<Event> events;
+
+        mutable std::mutex state_mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+        std::vector<std::thread> workers;
+
+        /// Per-thread counts, flushed to the shared atomics once per batch
+        struct LocalCounts
+        {
+            uint64_t words = 0;
+            uint64_t corrected = 0;
+            uint64_t double_errors = 0;
+            uint64_t uncorrectable = 0;
+            uint64_t races = 0;
+        };
+
+        void flush(LocalCounts &local) noexcept
+        {
+            shared.words_scanned.fetch_add(local.words, std::memory_order_relaxed);
+            shared.corrected.fetch_add(local.corrected, std::memory_order_relaxed);
+            shared.double_errors.fetch_add(local.double_errors, std::memory_order_relaxed);
+            shared.uncorrectable.fetch_add(local.uncorrectable, std::memory_order_relaxed);
+            shared.races.fetch_add(local.races, std::memory_order_relaxed);
+            local = {};
+        }
+
+        void log_event(const Event &event)
+        {
+            std::lock_guard lock(event_mutex);
+            if (events.size() < event_capacity)
+                events.push_back(event);
+            else
+                shared.events_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// Check and repair one word; the slow path of scan_line
+        void repair_word(size_t index, LocalCounts &local)
+        {
+            std::atomic_ref<uint64_t> word(data[index]);
+            std::atomic_ref<uint8_t> check_byte(check[index]);
+
+            uint64_t observed = word.load(std::memory_order_relaxed);
+            const uint8_t observed_check = check_byte.load(std::memory_order_relaxed);
+            uint64_t repaired = observed;
+            uint8_t repaired_check = observed_check;
+            size_t position;
+
+            switch (SECDED72::correct(repaired, repaired_check, position))
+            {
+            case SECDED72::Status::NO_ERROR:
+                return; // Rewritten since the line was read
+            case SECDED72::Status::SINGLE_ERROR_CORRECTED:
+                break;
+            case SECDED72::Status::DOUBLE_ERROR_DETECTED:
+                ++local.double_errors;
+                log_event({index, &data[index], observed, observed_check, SECDED72::Status::DOUBLE_ERROR_DETECTED});
+                return;
+            default:
+                ++local.uncorrectable;
+                log_event({index, &data[index], observed, observed_check, SECDED72::Status::UNCORRECTABLE_ERROR});
+                return;
+            }
+
+            // Only one of the two changes; publish it only if nothing else was stored meanwhile
+            bool stored = true;
+            if (position < SECDED72::data_length)
+            {
+                stored = word.compare_exchange_strong(observed, repaired, std::memory_order_relaxed);
+            }
+            else
+            {
+                uint8_t expected = observed_check;
+                stored = check_byte.compare_exchange_strong(expected, repaired_check, std::memory_order_relaxed);
+            }
+
+            if (stored)
+                ++local.corrected;
+            else
+                ++local.races;
+        }
+
+        /// Scan words [first, last) of one cache line
+        void scan_line(size_t first, size_t last, LocalCounts &local)
+        {
+            for (size_t i = first; i < last; ++i)
+            {
+                const uint64_t value = std::atomic_ref<uint64_t>(data[i]).load(std::memory_order_relaxed);
+                const uint8_t check_byte = std::atomic_ref<uint8_t>(check[i]).load(std::memory_order_relaxed);
+                if (SECDED72::syndrome(value, check_byte) != 0)
+                {
+                    repair_word(i, local);
+                }
+            }
+            local.words += last - first;
+        }
+
+        /// Sleep until `deadline` unless stopped; false once stop() was requested
+        bool wait_until(std::chrono::steady_clock::time_point deadline)
+        {
+            std::unique_lock lock(state_mutex);
+            return !wake.wait_until(lock, deadline, [this]
+                                    { return stopping; });
+        }
+
+        [[nodiscard]] bool stop_requested()
+        {
+            std::lock_guard lock(state_mutex);
+            return stopping;
+        }
+
+        /// One pass over words [begin, end), rate-limited to `bytes_per_second` (0 = unlimited)
+        ///
+        /// Returns false if interrupted by stop().
+        bool scrub_range(size_t begin, size_t end, double bytes_per_second, bool interruptible)
+        {
+            using Clock = std::chrono::steady_clock;
+            const auto start = Clock::now();
+            LocalCounts local;
+            size_t lines_in_batch = 0;
+
+            for (size_t line = begin; line < end; line += line_words)
+            {
+                const size_t ahead = line + prefetch_lines * line_words;
+                if (ahead < end)
+                {
+                    detail::prefetch_streaming(&data[ahead]);
+                    if (ahead % 64 == 0)
+                        detail::prefetch_streaming(&check[ahead]);
+                }
+
+                scan_line(line, std::min(line + line_words, end), local);
+
+                if (++lines_in_batch == batch_lines)
+                {
+                    lines_in_batch = 0;
+                    flush(local);
+
+                    if (bytes_per_second > 0.0)
+                    {
+                        const double seconds = static_cast<double>(line + line_words - begin) * 9.0 / bytes_per_second;
+                        const auto deadline = start + std::chrono::duration_cast<Clock::duration>(
+                                                          std::chrono::duration<double>(seconds));
+                        const auto now = Clock::now();
+                        if (deadline > now)
+                        {
+                            shared.throttle_ns.fetch_add(
+                                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count()),
+                                std::memory_order_relaxed);
+                            if (!interruptible)
+                                std::this_thread::sleep_until(deadline);
+                            else if (!wait_until(deadline))
+                                return false;
+                        }
+                    }
+                    if (interruptible && stop_requested())
+                        return false;
+                }
+            }
+
+            flush(local);
+            return true;
+        }
+
+        /// Whole-region passes of the current background run: the slowest thread's count
+        [[nodiscard]] uint64_t background_passes() const noexcept
+        {
+            if (thread_passes.empty())
+                return 0;
+
+            uint64_t passes = UINT64_MAX;
+            for (const auto &count : thread_passes)
+            {
+                passes = std::min(passes, count->load(std::memory_order_relaxed));
+            }
+            return passes;
+        }
+
+        /// Words [begin, end) owned by thread t of `count`, aligned to cache lines
+        [[nodiscard]] std::pair<size_t, size_t> slice(size_t t, size_t count) const noexcept
+        {
+            const size_t lines = (data.size() + line_words - 1) / line_words;
+            const size_t first = lines * t / count * line_words;
+            const size_t last = std::min(data.size(), lines * (t + 1) / count * line_words);
+            return {first, last};
+        }
+
+        void background_worker(size_t t)
+        {
+            if (numa_node >= 0)
+                detail::pin_to_numa_node(numa_node);
+
+            const auto [begin, end] = slice(t, threads);
+            const double share = rate_limit / static_cast<double>(threads);
+
+            while (scrub_range(begin, end, share, true))
+            {
+                thread_passes[t]->fetch_add(1, std::memory_order_relaxed);
+                if (pass_interval.count() > 0 && !wait_until(std::chrono::steady_clock::now() + pass_interval))
+                    break;
+            }
+        }
+
+    public:
+        /// Scrub `data` protected by `check` (one SECDED72 check byte per word)
+        MemoryScrubber(std::span<uint64_t> data, std::span<uint8_t> check)
+            : data(data), check(check)
+        {
+            if (check.size() != data.size())
+                throw std::invalid_argument("Scrubber needs exactly one check byte per data word");
+        }
+
+        MemoryScrubber(const MemoryScrubber &) = delete;
+        MemoryScrubber &operator=(const MemoryScrubber &) = delete;
+
+        ~MemoryScrubber() { stop(); }
+
+        /// Compute the check bytes of the whole region
+        void protect()
+        {
+            SECDED72::encode(data, check);
+        }
+
+        /// Scrubbing threads of the background scan (0 = hardware concurrency)
+        void set_threads(size_t count)
+        {
+            require_stopped();
+            threads = count == 0 ? std::max(1u, std::thread::hardware_concurrency()) : count;
+        }
+
+        [[nodiscard]] size_t get_threads() const noexcept { return threads; }
+
+        /// Cap on protected bytes (8 data + 1 check per word) scanned per second, 0 = unlimited
+        ///
+        /// Enforced by pacing: after every batch_lines lines a thread sleeps until the time its
+        /// bytes so far in the pass would take at its share of the limit. Unused time is not
+        /// banked beyond that, so the scan never bursts above the limit for more than one batch.
+        void set_rate_limit(double bytes_per_second)
+        {
+            require_stopped();
+            if (bytes_per_second < 0.0)
+                throw std::invalid_argument("Rate limit must be non-negative");
+            rate_limit = bytes_per_second;
+        }
+
+        [[nodiscard]] double get_rate_limit() const noexcept { return rate_limit; }
+
+        /// Pin scrubbing threads to the CPUs of a NUMA node (-1 = no placement)
+        ///
+        /// Best effort: uses the Linux sysfs node cpulist and thread affinity, and is ignored where
+        /// either is unavailable. Place the region itself on the node (first touch) for local scans.
+        void set_numa_node(int node)
+        {
+            require_stopped();
+            numa_node = node;
+        }
+
+        [[nodiscard]] int get_numa_node() const noexcept { return numa_node; }
+
+        /// Pause between background passes
+        void set_pass_interval(std::chrono::nanoseconds interval)
+        {
+            require_stopped();
+            pass_interval = interval;
+        }
+
+        /// Maximum number of events kept until drain_events()
+        void set_event_capacity(size_t capacity)
+        {
+            std::lock_guard lock(event_mutex);
+            event_capacity = capacity;
+        }
+
+        /// One synchronous, rate-limited pass over the region on the calling thread
+        void scrub_pass()
+        {
+            if (scrub_range(0, data.size(), rate_limit, false))
+                shared.passes.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// Scan continuously in the background until stop()
+        void start()
+        {
+            std::lock_guard lock(state_mutex);
+            if (!workers.empty())
+                throw std::logic_error("Scrubber already running");
+
+            stopping = false;
+            shared.passes.fetch_add(background_passes(), std::memory_order_relaxed);
+            thread_passes.clear();
+            for (size_t t = 0; t < threads; ++t)
+            {
+                thread_passes.push_back(std::make_unique<std::atomic<uint64_t>>(0));
+            }
+            for (size_t t = 0; t < threads; ++t)
+            {
+                workers.emplace_back(&MemoryScrubber::background_worker, this, t);
+            }
+        }
+
+        /// Stop the background scan and join its threads
+        void stop()
+        {
+            {
+                std::lock_guard lock(state_mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+            workers.clear();
+        }
+
+        [[nodiscard]] bool running()
+        {
+            std::lock_guard lock(state_mutex);
+            return !workers.empty();
+        }
+
+        [[nodiscard]] Counters get_counters() const
+        {
+            Counters counters;
+            counters.words_scanned = shared.words_scanned.load(std::memory_order_relaxed);
+            counters.corrected = shared.corrected.load(std::memory_order_relaxed);
+            counters.double_errors = shared.double_errors.load(std::memory_order_relaxed);
+            counters.uncorrectable = shared.uncorrectable.load(std::memory_order_relaxed);
+            counters.races = shared.races.load(std::memory_order_relaxed);
+            counters.events_dropped = shared.events_dropped.load(std::memory_order_relaxed);
+            counters.throttle_ns = shared.throttle_ns.load(std::memory_order_relaxed);
+
+            // start() replaces thread_passes under the same lock
+            std::lock_guard lock(state_mutex);
+            counters.passes = shared.passes.load(std::memory_order_relaxed) + background_passes();
+            return counters;
+        }
+
+        /// Take the logged uncorrectable words, oldest first
+        [[nodiscard]] std::vector<Event> drain_events()
+        {
+            std::lock_guard lock(event_mutex);
+            std::vector<Event> drained;
+            drained.swap(events);
+            return drained;
+        }
+
+    private:
+        void require_stopped()
+        {
+            std::lock_guard lock(state_mutex);
+            if (!workers.empty())
+                throw std::logic_error("Stop the scrubber before changing its settings");
+        }
+    };
+
+} // namespace ecc
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "bit_packing.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecc
+{
+
+    /// Contiguous buffer of bit-packed codewords
+    ///
+    /// Codeword i occupies words [i * stride, (i + 1) * stride) with bit j in word j / 64, bit j % 64:
+    /// the layout of detail::to_words, so bitset codewords move in and out with a memcpy. Bits past the
+    /// codeword length in each last word are kept clear, which lets whole words be XORed and popcounted.
+    class PackedCodewords
+    {
+    private:
+        size_t length = 0; // bits per codeword
+        size_t stride = 0; // words per codeword
+        size_t count = 0;
+        std::vector<uint64_t> storage;
+
+    public:
+        PackedCodewords() = default;
+
+        /// `codewords` all-zero codewords of `codeword_length` bits
+        explicit PackedCodewords(size_t codeword_length, size_t codewords = 0)
+            : length(codeword_length), stride((codeword_length + 63) / 64), count(codewords),
+              storage(stride * codewords, 0)
+        {
+            if (codeword_length == 0)
+                throw std::invalid_argument("Packed codeword length must be positive");
+        }
+
+        /// Pack a span of bitset codewords
+        template <size_t bits>
+        [[nodiscard]] static PackedCodewords pack(std::span<const std::bitset<bits>> codewords)
+        {
+            PackedCodewords packed(bits, codewords.size());
+            for (size_t i = 0; i < codewords.size(); ++i)
+            {
+                packed.store(i, codewords[i]);
+            }
+            return packed;
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return count; }
+        [[nodiscard]] bool empty() const noexcept { return count == 0; }
+        [[nodiscard]] size_t codeword_length() const noexcept { return length; }
+        [[nodiscard]] size_t words_per_codeword() const noexcept { return stride; }
+        [[nodiscard]] size_t total_bits() const noexcept { return length * count; }
+
+        /// Valid bits of each codeword's last word
+        [[nodiscard]] uint64_t tail_mask() const noexcept
+        {
+            return length % 64 == 0 ? ~0ull : (1ull << (length % 64)) - 1;
+        }
+
+        /// Grow (zero-filled) or shrink to `codewords` codewords
+        void resize(size_t codewords)
+        {
+            storage.resize(stride * codewords, 0);
+            count = codewords;
+        }
+
+        /// Make room for `codewords` codewords of `codeword_length` bits, keeping the allocation when the
+        /// length is unchanged (for output buffers: codewords that remain are not cleared)
+        void reshape(size_t codeword_length, size_t codewords)
+        {
+            if (codeword_length != length)
+            {
+                *this = PackedCodewords(codeword_length, codewords);
+                return;
+            }
+            resize(codewords);
+        }
+
+        void reserve(size_t codewords) { storage.reserve(stride * codewords); }
+
+        void clear() noexcept
+        {
+            storage.clear();
+            count = 0;
+        }
+
+        [[nodiscard]] std::span<uint64_t> words() noexcept { return storage; }
+        [[nodiscard]] std::span<const uint64_t> words() const noexcept { return storage; }
+
+        [[nodiscard]] std::span<uint64_t> codeword(size_t i) noexcept
+        {
+            return std::span<uint64_t>(storage).subspan(i * stride, stride);
+        }
+
+        [[nodiscard]] std::span<const uint64_t> codeword(size_t i) const noexcept
+        {
+            return std::span<const uint64_t>(storage).subspan(i * stride, stride);
+        }
+
+        [[nodiscard]] bool get(size_t i, size_t bit) const noexcept
+        {
+            return (storage[i * stride + bit / 64] >> (bit % 64)) & 1;
+        }
+
+        void set(size_t i, size_t bit, bool value) noexcept
+        {
+            uint64_t &word = storage[i * stride + bit / 64];
+            const uint64_t mask = 1ull << (bit % 64);
+            word = value ? (word | mask) : (word & ~mask);
+        }
+
+        void flip(size_t i, size_t bit) noexcept
+        {
+            storage[i * stride + bit / 64] ^= 1ull << (bit % 64);
+        }
+
+        /// Bits [first, first + width) of codeword i as an integer, bit `first` lowest (width <= 64)
+        [[nodiscard]] uint64_t get_bits(size_t i, size_t first, size_t width) const noexcept
+        {
+            const uint64_t *word = storage.data() + i * stride + first / 64;
+            const size_t shift = first % 64;
+            uint64_t value = word[0] >> shift;
+            if (shift + width > 64)
+            {
+                value |= word[1] << (64 - shift);
+            }
+            return width == 64 ? value : value & ((1ull << width) - 1);
+        }
+
+        /// Overwrite bits [first, first + width) of codeword i with the low bits of `value`
+        void set_bits(size_t i, size_t first, size_t width, uint64_t value) noexcept
+        {
+            const uint64_t mask = width == 64 ? ~0ull : (1ull << width) - 1;
+            value &= mask;
+
+            uint64_t *word = storage.data() + i * stride + first / 64;
+            const size_t shift = first % 64;
+            word[0] = (word[0] & ~(mask << shift)) | (value << shift);
+            if (shift + width > 64)
+            {
+                word[1] = (word[1] & ~(mask >> (64 - shift))) | (value >> (64 - shift));
+            }
+        }
+
+        /// Codeword i as one 0/1 byte per bit (bits.size() must be the codeword length)
+        void load_bits(size_t i, std::span<uint8_t> bits) const
+        {
+            if (bits.size() != length)
+                throw std::invalid_argument("Bit buffer does not match the packed codeword length");
+
+            const auto source = codeword(i);
+            for (size_t bit = 0; bit < length; ++bit)
+            {
+                bits[bit] = static_cast<uint8_t>((source[bit / 64] >> (bit % 64)) & 1);
+            }
+        }
+
+        /// Overwrite codeword i from one byte per bit (non-zero = 1)
+        void store_bits(size_t i, std::span<const uint8_t> bits)
+        {
+            if (bits.size() != length)
+                throw std::invalid_argument("Bit buffer does not match the packed codeword length");
+
+            auto target = codeword(i);
+            std::fill(target.begin(), target.end(), 0ull);
+            for (size_t bit = 0; bit < length; ++bit)
+            {
+                target[bit / 64] |= static_cast<uint64_t>(bits[bit] != 0) << (bit % 64);
+            }
+        }
+
+        /// Overwrite codeword i with a bitset of the buffer's codeword length
+        template <size_t bits>
+        void store(size_t i, const std::bitset<bits> &value)
+        {
+            store_words<bits>(i, detail::to_words(value));
+        }
+
+        /// Overwrite codeword i with packed words (layout of detail::to_words)
+        template <size_t bits>
+        void store_words(size_t i, const std::array<uint64_t, detail::word_count<bits>> &value)
+        {
+            if (bits != length)
+                throw std::invalid_argument("Codeword length does not match packed buffer");
+
+            auto target = codeword(i);
+            std::copy(value.begin(), value.end(), target.begin());
+            target.back() &= tail_mask();
+        }
+
+        /// Append a bitset codeword
+        template <size_t bits>
+        void push_back(const std::bitset<bits> &value)
+        {
+            resize(count + 1);
+            store(count - 1, value);
+        }
+
+        /// Codeword i as a bitset of the buffer's codeword length
+        template <size_t bits>
+        [[nodiscard]] std::bitset<bits> load(size_t i) const
+        {
+            return detail::from_words<bits>(load_words<bits>(i));
+        }
+
+        /// Codeword i as packed words
+        template <size_t bits>
+        [[nodiscard]] std::array<uint64_t, detail::word_count<bits>> load_words(size_t i) const
+        {
+            if (bits != length)
+                throw std::invalid_argument("Codeword length does not match packed buffer");
+
+            // Same length, so the stride is exactly the array size
+            std::array<uint64_t, detail::word_count<bits>> value;
+            std::copy_n(storage.begin() + i * stride, value.size(), value.begin());
+            return value;
+        }
+
+        /// Hamming distance between two packed codewords of equal size
+        [[nodiscard]] static size_t count_differences(std::span<const uint64_t> a, std::span<const uint64_t> b) noexcept
+        {
+            size_t differences = 0;
+            for (size_t w = 0; w < a.size(); ++w)
+            {
+                differences += static_cast<size_t>(std::popcount(a[w] ^ b[w]));
+            }
+            return differences;
+        }
+
+        /// Total bit differences against a buffer of the same shape
+        [[nodiscard]] size_t count_differences(const PackedCodewords &other) const
+        {
+            if (other.length != length || other.count != count)
+                throw std::invalid_argument("Packed buffers differ in shape");
+
+            return count_differences(storage, other.storage);
+        }
+    };
+
+} // namespace ecc
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "rng.hpp"
+#include "gaussian_noise.hpp"
+#include "thread_pool.hpp"
 #include <vector>
 #include <array>
 #include <random>
@@ -10,6 +13,15 @@
 #include <string>
 #include <concepts>
 #include <bitset>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <cmath>
+#include <typeinfo>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
 
 namespace ecc
 {
@@ -23,6 +35,14 @@ namespace ecc
         BURST // Burst Error Channel
     };
 
+    /// Per-operation latency percentiles in nanoseconds
+    struct LatencyPercentiles
+    {
+        double p50_ns;
+        double p99_ns;
+        double p999_ns;
+    };
+
     /// Performance metrics for error correction codes
     struct PerformanceMetrics
     {
@@ -37,6 +57,8 @@ namespace ecc
         size_t error_blocks;
         size_t corrected_errors;
         size_t uncorrectable_errors;
+        LatencyPercentiles encode_latency;
+        LatencyPercentiles decode_latency;
     };
 
     /// Concept for error correction codes
@@ -49,14 +71,287 @@ namespace ecc
         { T::data_length } -> std::convertible_to<size_t>;
     };
 
+    /// Concept for linear codes whose decoder is driven by a syndrome that is linear in the error pattern
+    template <typename T>
+    concept SyndromeDecodable = requires(const T code, size_t pos, typename T::SyndromeValue syndrome,
+                                         std::span<size_t> positions) {
+        { T::code_length } -> std::convertible_to<size_t>;
+        { code.column_syndrome(pos) } -> std::convertible_to<typename T::SyndromeValue>;
+        { code.locate_errors(syndrome, positions) } -> std::convertible_to<std::optional<size_t>>;
+    };
+
+    /// Decoder outcomes of every error pattern of one weight
+    struct PatternWeightCounts
+    {
+        size_t weight = 0;
+        uint64_t patterns = 0;
+        uint64_t corrected = 0;    // Decoder restored the sent codeword
+        uint64_t detected = 0;     // Decoder reported the word uncorrectable
+        uint64_t miscorrected = 0; // Decoder silently moved to a different codeword
+        uint64_t undetected = 0;   // Zero syndrome: the pattern is itself a codeword
+
+        void merge(const PatternWeightCounts &other) noexcept
+        {
+            patterns += other.patterns;
+            corrected += other.corrected;
+            detected += other.detected;
+            miscorrected += other.miscorrected;
+            undetected += other.undetected;
+        }
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        struct is_bitset : std::false_type
+        {
+        };
+
+        template <size_t N>
+        struct is_bitset<std::bitset<N>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        inline constexpr bool is_bitset_v = is_bitset<T>::value;
+
+        /// Cost of one back-to-back steady_clock::now() pair in nanoseconds (median, measured once)
+        [[nodiscard]] inline double timer_overhead_ns()
+        {
+            static const double overhead = []
+            {
+                std::array<double, 255> samples{};
+                for (auto &sample : samples)
+                {
+                    const auto first = std::chrono::steady_clock::now();
+                    const auto second = std::chrono::steady_clock::now();
+                    sample = std::chrono::duration<double, std::nano>(second - first).count();
+                }
+                std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+                return samples[samples.size() / 2];
+            }();
+            return overhead;
+        }
+
+        /// Nearest-rank percentile `q` in [0, 1] of `samples` (reorders the vector)
+        [[nodiscard]] inline double percentile(std::vector<double> &samples, double q)
+        {
+            if (samples.empty())
+            {
+                return 0.0;
+            }
+            const auto rank = static_cast<size_t>(std::ceil(q * samples.size()));
+            const auto nth = samples.begin() + (rank > 0 ? rank - 1 : 0);
+            std::nth_element(samples.begin(), nth, samples.end());
+            return *nth;
+        }
+
+        [[nodiscard]] inline LatencyPercentiles latency_percentiles(std::vector<double> &samples)
+        {
+            return {percentile(samples, 0.50), percentile(samples, 0.99), percentile(samples, 0.999)};
+        }
+
+        /// Data word out of whatever decode() returns: the word itself or a result struct with `.data`
+        template <typename CodeType>
+        [[nodiscard]] typename CodeType::DataWord decoded_data(const CodeType &code,
+                                                               const typename CodeType::CodeWord &received)
+        {
+            auto result = code.decode(received);
+            if constexpr (requires { result.data; })
+            {
+                return result.data;
+            }
+            else
+            {
+                return result;
+            }
+        }
+
+        inline void syndrome_xor(std::unsigned_integral auto &a, std::unsigned_integral auto b) noexcept
+        {
+            a ^= b;
+        }
+
+        template <typename T, size_t N>
+        inline void syndrome_xor(std::array<T, N> &a, const std::array<T, N> &b) noexcept
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                a[i] ^= b[i];
+            }
+        }
+
+        /// Pascal's triangle C(a, b) for a <= n, b <= k, saturating at UINT64_MAX
+        class BinomialTable
+        {
+        private:
+            size_t columns;
+            std::vector<uint64_t> table;
+
+        public:
+            BinomialTable(size_t n, size_t k) : columns(k + 1), table((n + 1) * (k + 1), 0)
+            {
+                for (size_t a = 0; a <= n; ++a)
+                {
+                    table[a * columns] = 1;
+                    for (size_t b = 1; b <= std::min(a, k); ++b)
+                    {
+                        const uint64_t left = table[(a - 1) * columns + b - 1];
+                        const uint64_t up = table[(a - 1) * columns + b];
+                        table[a * columns + b] = left > UINT64_MAX - up ? UINT64_MAX : left + up;
+                    }
+                }
+            }
+
+            [[nodiscard]] uint64_t operator()(size_t a, size_t b) const noexcept
+            {
+                return b < columns && b <= a ? table[a * columns + b] : 0;
+            }
+        };
+
+        /// Combination of rank `rank` in revolving-door order of the w-subsets of {0..n-1}
+        ///
+        /// The order is Gamma(n, w) = Gamma(n-1, w), then Gamma(n-1, w-1) reversed with n-1 added, so
+        /// consecutive combinations differ by one element out and one in. `c` receives w ascending elements.
+        inline void revolving_door_unrank(const BinomialTable &binomial, size_t n, size_t w, uint64_t rank,
+                                          std::span<size_t> c) noexcept
+        {
+            while (w > 0)
+            {
+                const uint64_t without = binomial(n - 1, w);
+                if (rank >= without)
+                {
+                    rank = binomial(n, w) - 1 - rank;
+                    c[--w] = n - 1;
+                }
+                --n;
+            }
+        }
+
+        /// Step `c` (w ascending elements followed by the sentinel n) to its revolving-door successor
+        ///
+        /// Knuth's Algorithm R (TAOCP 7.2.1.3). Reports the element that left and the one that entered;
+        /// returns false after the last combination.
+        inline bool revolving_door_next(std::span<size_t> c, size_t &removed, size_t &added) noexcept
+        {
+            const size_t w = c.size() - 1;
+            size_t j = 2; // 1-based index into c_1..c_w as in Algorithm R
+            bool increase;
+
+            if (w % 2 == 1)
+            {
+                if (c[0] + 1 < c[1])
+                {
+                    removed = c[0]++;
+                    added = c[0];
+                    return true;
+                }
+                increase = false;
+            }
+            else
+            {
+                if (c[0] > 0)
+                {
+                    removed = c[0]--;
+                    added = c[0];
+                    return true;
+                }
+                increase = true;
+            }
+
+            while (j <= w)
+            {
+                if (!increase)
+                {
+                    // R4: try to decrease c_j
+                    if (c[j - 1] >= j)
+                    {
+                        removed = c[j - 1];
+                        c[j - 1] = c[j - 2];
+                        c[j - 2] = j - 2;
+                        added = j - 2;
+                        return true;
+                    }
+                    ++j;
+                    increase = true;
+                }
+                else
+                {
+                    // R5: try to increase c_j
+                    if (c[j - 1] + 1 < c[j])
+                    {
+                        removed = c[j - 2];
+                        c[j - 2] = c[j - 1];
+                        added = ++c[j - 1];
+                        return true;
+                    }
+                    ++j;
+                    increase = false;
+                }
+            }
+            return false;
+        }
+    } // namespace detail
+
     /// Performance analyzer for error correction codes
+    ///
+    /// Monte Carlo runs are cut into chunks of `chunk_iterations`; chunk c always draws from RNG streams
+    /// 3c (data), 3c+1 (channel) and 3c+2 (Gaussian noise) of the analyzer seed and per-chunk metrics are merged in chunk order, so a seed gives the same
+    /// BER/BLER for any thread count.
+    ///
+    /// Encode and decode are timed in batches of `timing_batch` operations between two clock reads, with
+    /// the calibrated cost of the reads subtracted; every batch contributes one per-op latency sample to
+    /// the p50/p99/p999 figures. A batch of 1 samples single operations at the price of clock noise.
     class PerformanceAnalyzer
     {
+    public:
+        /// Iterations per Monte Carlo chunk (the unit of work and of RNG stream assignment)
+        static constexpr size_t chunk_iterations = 256;
+
     private:
-        std::mt19937 rng;
+        /// Metrics of one chunk plus its raw per-op latency samples
+        struct ChunkResult
+        {
+            PerformanceMetrics metrics{};
+            std::vector<double> encode_ns;
+            std::vector<double> decode_ns;
+        };
+
+        /// Channel randomness of one chunk; the BSC/BEC gap carries from one codeword to the next
+        struct ChannelState
+        {
+            Xoshiro256 rng;
+            GeometricSkipSampler skipper;
+            GaussianNoise noise;
+            std::vector<float> samples;
+        };
+
+        uint64_t seed;
+        WorkStealingPool *pool = nullptr;
+        size_t timing_batch = 16;
 
     public:
-        PerformanceAnalyzer() : rng(std::chrono::steady_clock::now().time_since_epoch().count()) {}
+        PerformanceAnalyzer()
+            : PerformanceAnalyzer(static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count())) {}
+
+        explicit PerformanceAnalyzer(uint64_t seed) : seed(seed) {}
+
+        void set_seed(uint64_t value) noexcept { seed = value; }
+        [[nodiscard]] uint64_t get_seed() const noexcept { return seed; }
+
+        /// Run analyze_performance chunks on `worker_pool` (which must outlive its use); without a
+        /// pool they run on the calling thread
+        void set_pool(WorkStealingPool &worker_pool) noexcept { pool = &worker_pool; }
+
+        /// Chunks analyzed at once: the pool's thread count, or 1 without a pool
+        [[nodiscard]] size_t get_threads() const noexcept { return pool ? pool->get_thread_count() : 1; }
+
+        /// Operations timed per clock-read pair (clamped to [1, chunk_iterations])
+        void set_timing_batch(size_t operations) noexcept
+        {
+            timing_batch = std::clamp<size_t>(operations, 1, chunk_iterations);
+        }
+        [[nodiscard]] size_t get_timing_batch() const noexcept { return timing_batch; }
 
         /// Analyze BER performance over SNR range
         template <ErrorCorrectionCode CodeType>
@@ -86,81 +381,82 @@ namespace ecc
         PerformanceMetrics analyze_performance(
             ChannelType channel, double parameter, size_t iterations)
         {
+            const size_t chunks = (iterations + chunk_iterations - 1) / chunk_iterations;
+            const size_t workers = std::min(get_threads(), chunks);
 
-            CodeType code;
-            PerformanceMetrics metrics{};
-
-            auto start_time = std::chrono::high_resolution_clock::now();
+            std::vector<ChunkResult> partial(chunks);
+            std::vector<std::exception_ptr> failures(std::max<size_t>(workers, 1));
+            std::atomic<size_t> next_chunk{0};
 
-            for (size_t iter = 0; iter < iterations; ++iter)
+            auto worker = [&](size_t worker_index)
             {
-                // Generate random data
-                auto data = generate_random_data<CodeType>();
-
-                // Encode
-                auto encode_start = std::chrono::high_resolution_clock::now();
-                auto codeword = code.encode(data);
-                auto encode_end = std::chrono::high_resolution_clock::now();
-
-                metrics.encoding_time_ms += std::chrono::duration<double, std::milli>(
-                                                encode_end - encode_start)
-                                                .count();
-
-                // Add channel errors
-                auto received = add_channel_errors(codeword, channel, parameter);
-
-                // Count bit errors before correction
-                auto bit_errors = count_bit_errors(codeword, received);
-                metrics.error_bits += bit_errors;
-
-                // Decode
-                auto decode_start = std::chrono::high_resolution_clock::now();
-                auto decoded_data = code.decode(received);
-                auto decode_end = std::chrono::high_resolution_clock::now();
-
-                metrics.decoding_time_ms += std::chrono::duration<double, std::milli>(
-                                                decode_end - decode_start)
-                                                .count();
-
-                // Count remaining errors
-                bool block_error = false;
-                for (size_t i = 0; i < CodeType::data_length; ++i)
+                try
                 {
-                    if constexpr (std::is_same_v<typename CodeType::DataWord, std::bitset<CodeType::data_length>>)
+                    CodeType code;
+                    for (size_t chunk; (chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) < chunks;)
                     {
-                        if (data[i] != decoded_data[i])
-                        {
-                            block_error = true;
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        if (!std::equal(data.begin(), data.end(), decoded_data.begin()))
-                        {
-                            block_error = true;
-                            break;
-                        }
+                        const size_t count = std::min(chunk_iterations, iterations - chunk * chunk_iterations);
+                        partial[chunk] = run_chunk(code, channel, parameter, chunk, count);
                     }
                 }
-                if (block_error)
+                catch (...)
                 {
-                    metrics.error_blocks++;
+                    failures[worker_index] = std::current_exception();
+                    next_chunk.store(chunks, std::memory_order_relaxed);
                 }
+            };
+
+            auto start_time = std::chrono::steady_clock::now();
 
-                metrics.total_bits += CodeType::code_length;
-                metrics.total_blocks++;
+            if (workers <= 1)
+            {
+                worker(0);
+            }
+            else
+            {
+                TaskGroup group(*pool);
+                for (size_t t = 1; t < workers; ++t)
+                {
+                    group.run([&worker, t]
+                              { worker(t); });
+                }
+                worker(0);
+                group.wait();
             }
 
-            auto end_time = std::chrono::high_resolution_clock::now();
+            auto end_time = std::chrono::steady_clock::now();
             auto total_time = std::chrono::duration<double>(end_time - start_time).count();
 
+            for (const auto &failure : failures)
+            {
+                if (failure)
+                {
+                    std::rethrow_exception(failure);
+                }
+            }
+
+            // Merge in chunk order so floating-point sums do not depend on scheduling
+            PerformanceMetrics metrics{};
+            std::vector<double> encode_ns;
+            std::vector<double> decode_ns;
+            for (const auto &part : partial)
+            {
+                accumulate(metrics, part.metrics);
+                encode_ns.insert(encode_ns.end(), part.encode_ns.begin(), part.encode_ns.end());
+                decode_ns.insert(decode_ns.end(), part.decode_ns.begin(), part.decode_ns.end());
+            }
+            metrics.encode_latency = detail::latency_percentiles(encode_ns);
+            metrics.decode_latency = detail::latency_percentiles(decode_ns);
+
             // Calculate final metrics
-            metrics.bit_error_rate = static_cast<double>(metrics.error_bits) / metrics.total_bits;
-            metrics.block_error_rate = static_cast<double>(metrics.error_blocks) / metrics.total_blocks;
-            metrics.throughput_mbps = (metrics.total_bits * CodeType::data_length / CodeType::code_length) / (total_time * 1e6);
-            metrics.encoding_time_ms /= iterations;
-            metrics.decoding_time_ms /= iterations;
+            if (iterations > 0)
+            {
+                metrics.bit_error_rate = static_cast<double>(metrics.error_bits) / metrics.total_bits;
+                metrics.block_error_rate = static_cast<double>(metrics.error_blocks) / metrics.total_blocks;
+                metrics.throughput_mbps = (metrics.total_bits * CodeType::data_length / CodeType::code_length) / (total_time * 1e6);
+                metrics.encoding_time_ms /= iterations;
+                metrics.decoding_time_ms /= iterations;
+            }
 
             return metrics;
         }
@@ -177,7 +473,8 @@ namespace ecc
 
             // Write header
             file << "BER,BLER,Throughput_Mbps,Encoding_Time_ms,Decoding_Time_ms,"
-                 << "Total_Bits,Error_Bits,Total_Blocks,Error_Blocks\n";
+                 << "Total_Bits,Error_Bits,Total_Blocks,Error_Blocks,"
+                 << "Encode_p50_ns,Encode_p99_ns,Encode_p999_ns,Decode_p50_ns,Decode_p99_ns,Decode_p999_ns\n";
 
             // Write data
             for (const auto &metrics : results)
@@ -192,7 +489,13 @@ namespace ecc
                      << metrics.total_bits << ","
                      << metrics.error_bits << ","
                      << metrics.total_blocks << ","
-                     << metrics.error_blocks << "\n";
+                     << metrics.error_blocks << ","
+                     << metrics.encode_latency.p50_ns << ","
+                     << metrics.encode_latency.p99_ns << ","
+                     << metrics.encode_latency.p999_ns << ","
+                     << metrics.decode_latency.p50_ns << ","
+                     << metrics.decode_latency.p99_ns << ","
+                     << metrics.decode_latency.p999_ns << "\n";
             }
         }
 
@@ -201,14 +504,15 @@ namespace ecc
         void compare_codes(ChannelType channel, double parameter, size_t iterations)
         {
             std::cout << "\nCode Comparison Results:\n";
-            std::cout << std::string(80, '=') << "\n";
+            std::cout << std::string(92, '=') << "\n";
             std::cout << std::left << std::setw(15) << "Code"
                       << std::setw(12) << "BER"
                       << std::setw(12) << "BLER"
                       << std::setw(15) << "Throughput"
                       << std::setw(12) << "Enc Time"
-                      << std::setw(12) << "Dec Time" << "\n";
-            std::cout << std::string(80, '-') << "\n";
+                      << std::setw(12) << "Dec Time"
+                      << std::setw(12) << "Dec p99 ns" << "\n";
+            std::cout << std::string(92, '-') << "\n";
 
             auto print_metrics = [this, channel, parameter, iterations](const std::string &name, auto &&code_type)
             {
@@ -220,20 +524,118 @@ namespace ecc
                           << std::setw(12) << metrics.block_error_rate
                           << std::fixed << std::setprecision(1) << std::setw(15) << metrics.throughput_mbps
                           << std::setprecision(3) << std::setw(12) << metrics.encoding_time_ms
-                          << std::setw(12) << metrics.decoding_time_ms << "\n";
+                          << std::setw(12) << metrics.decoding_time_ms
+                          << std::setprecision(1) << std::setw(12) << metrics.decode_latency.p99_ns << "\n";
             };
 
             (print_metrics(get_code_name<CodeTypes>(), CodeTypes{}), ...);
         }
 
     private:
+        /// One chunk of Monte Carlo iterations on the streams of `chunk`, timed in batches
         template <typename CodeType>
-        typename CodeType::DataWord generate_random_data()
+        ChunkResult run_chunk(const CodeType &code, ChannelType channel, double parameter,
+                              size_t chunk, size_t count) const
+        {
+            using Clock = std::chrono::steady_clock;
+
+            // Separate data and channel streams keep the sample independent of the batch size
+            Xoshiro256 data_rng(seed, 3 * chunk);
+            ChannelState state{Xoshiro256(seed, 3 * chunk + 1),
+                               GeometricSkipSampler(channel == ChannelType::BSC || channel == ChannelType::BEC ? parameter : 0.0),
+                               GaussianNoise(seed, 3 * chunk + 2),
+                               {}};
+            ChunkResult result;
+            auto &metrics = result.metrics;
+            const size_t batches = (count + timing_batch - 1) / timing_batch;
+            result.encode_ns.reserve(batches);
+            result.decode_ns.reserve(batches);
+
+            const double overhead_ns = detail::timer_overhead_ns();
+            auto batch_ns = [overhead_ns](Clock::time_point start, Clock::time_point end)
+            {
+                return std::max(0.0, std::chrono::duration<double, std::nano>(end - start).count() - overhead_ns);
+            };
+
+            std::vector<typename CodeType::DataWord> data(std::min(timing_batch, count));
+            std::vector<typename CodeType::CodeWord> codewords(data.size());
+            std::vector<typename CodeType::CodeWord> received(data.size());
+            std::vector<typename CodeType::DataWord> decoded(data.size());
+
+            for (size_t begin = 0; begin < count; begin += timing_batch)
+            {
+                const size_t size = std::min(timing_batch, count - begin);
+
+                // Generate random data
+                for (size_t i = 0; i < size; ++i)
+                {
+                    data[i] = generate_random_data<CodeType>(data_rng);
+                }
+
+                // Encode
+                const auto encode_start = Clock::now();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    codewords[i] = code.encode(data[i]);
+                }
+                const auto encode_end = Clock::now();
+
+                // Add channel errors and count bit errors before correction
+                for (size_t i = 0; i < size; ++i)
+                {
+                    received[i] = add_channel_errors(codewords[i], channel, parameter, state);
+                    metrics.error_bits += count_bit_errors(codewords[i], received[i]);
+                }
+
+                // Decode
+                const auto decode_start = Clock::now();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    decoded[i] = detail::decoded_data(code, received[i]);
+                }
+                const auto decode_end = Clock::now();
+
+                const double encode_ns = batch_ns(encode_start, encode_end);
+                const double decode_ns = batch_ns(decode_start, decode_end);
+                metrics.encoding_time_ms += encode_ns * 1e-6;
+                metrics.decoding_time_ms += decode_ns * 1e-6;
+                result.encode_ns.push_back(encode_ns / size);
+                result.decode_ns.push_back(decode_ns / size);
+
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (decoded[i] != data[i])
+                    {
+                        metrics.error_blocks++;
+                    }
+                }
+
+                metrics.total_bits += size * CodeType::code_length;
+                metrics.total_blocks += size;
+            }
+
+            return result;
+        }
+
+        static void accumulate(PerformanceMetrics &total, const PerformanceMetrics &part) noexcept
         {
-            typename CodeType::DataWord data;
+            total.encoding_time_ms += part.encoding_time_ms;
+            total.decoding_time_ms += part.decoding_time_ms;
+            total.total_bits += part.total_bits;
+            total.error_bits += part.error_bits;
+            total.total_blocks += part.total_blocks;
+            total.error_blocks += part.error_blocks;
+            total.corrected_errors += part.corrected_errors;
+            total.uncorrectable_errors += part.uncorrectable_errors;
+        }
+
+        template <typename CodeType, typename Rng>
+        static typename CodeType::DataWord generate_random_data(Rng &rng)
+        {
+            typename CodeType::DataWord data{};
             std::uniform_int_distribution<int> dist(0, 1);
 
-            if constexpr (std::is_same_v<typename CodeType::DataWord, std::bitset<CodeType::data_length>>)
+            if constexpr (detail::is_bitset_v<typename CodeType::DataWord>)
             {
                 for (size_t i = 0; i < CodeType::data_length; ++i)
                 {
@@ -252,113 +654,68 @@ namespace ecc
         }
 
         template <typename CodeWord>
-        CodeWord add_channel_errors(const CodeWord &codeword, ChannelType channel, double parameter)
+        static CodeWord add_channel_errors(const CodeWord &codeword, ChannelType channel, double parameter,
+                                           ChannelState &state)
         {
             auto received = codeword;
 
             switch (channel)
             {
             case ChannelType::BSC:
-                add_bsc_errors(received, parameter);
+                add_bsc_errors(received, state.rng, state.skipper);
                 break;
             case ChannelType::AWGN:
-                add_awgn_errors(received, parameter);
+                add_awgn_errors(received, parameter, state);
                 break;
             case ChannelType::BEC:
-                add_bec_errors(received, parameter);
+                add_bec_errors(received, state.rng, state.skipper);
                 break;
             case ChannelType::BURST:
-                add_burst_errors(received, static_cast<size_t>(parameter));
+                add_burst_errors(received, static_cast<size_t>(parameter), state.rng);
                 break;
             }
 
             return received;
         }
 
-        template <typename CodeWord>
-        void add_bsc_errors(CodeWord &codeword, double error_probability)
+        template <typename CodeWord, typename Rng>
+        static void add_bsc_errors(CodeWord &codeword, Rng &rng, GeometricSkipSampler &skipper)
         {
-            std::uniform_real_distribution<double> dist(0.0, 1.0);
-
-            if constexpr (std::is_same_v<CodeWord, std::bitset<std::tuple_size_v<CodeWord>>>)
+            if constexpr (detail::is_bitset_v<CodeWord>)
             {
-                for (size_t i = 0; i < codeword.size(); ++i)
-                {
-                    if (dist(rng) < error_probability)
-                    {
-                        codeword.flip(i);
-                    }
-                }
+                skipper.for_each_event(codeword.size(), rng, [&codeword](size_t i)
+                                       { codeword.flip(i); });
             }
             else
             {
-                for (auto &bit : codeword)
-                {
-                    if (dist(rng) < error_probability)
-                    {
-                        bit = (bit == 0) ? 1 : 0;
-                    }
-                }
+                skipper.for_each_event(codeword.size(), rng, [&codeword](size_t i)
+                                       { codeword[i] = (codeword[i] == 0) ? 1 : 0; });
             }
         }
 
         template <typename CodeWord>
-        void add_awgn_errors(CodeWord &codeword, double snr_db)
+        static void add_awgn_errors(CodeWord &codeword, double snr_db, ChannelState &state)
         {
-            double snr_linear = std::pow(10.0, snr_db / 10.0);
-            double noise_variance = 1.0 / (2.0 * snr_linear);
-            std::normal_distribution<double> noise_dist(0.0, std::sqrt(noise_variance));
+            state.samples.resize(codeword.size());
+            state.noise.fill(state.samples, GaussianNoise::sigma_from_snr_db(snr_db));
 
-            if constexpr (std::is_same_v<CodeWord, std::bitset<std::tuple_size_v<CodeWord>>>)
+            for (size_t i = 0; i < codeword.size(); ++i)
             {
-                for (size_t i = 0; i < codeword.size(); ++i)
-                {
-                    double signal = codeword[i] ? 1.0 : -1.0;
-                    double received_signal = signal + noise_dist(rng);
-                    codeword[i] = (received_signal > 0.0);
-                }
-            }
-            else
-            {
-                for (auto &bit : codeword)
-                {
-                    double signal = (bit == 0) ? -1.0 : 1.0;
-                    double received_signal = signal + noise_dist(rng);
-                    bit = (received_signal > 0.0) ? 1 : 0;
-                }
+                const float signal = codeword[i] ? 1.0f : -1.0f;
+                codeword[i] = (signal + state.samples[i]) > 0.0f;
             }
         }
 
-        template <typename CodeWord>
-        void add_bec_errors(CodeWord &codeword, double erasure_probability)
+        template <typename CodeWord, typename Rng>
+        static void add_bec_errors(CodeWord &codeword, Rng &rng, GeometricSkipSampler &skipper)
         {
-            std::uniform_real_distribution<double> dist(0.0, 1.0);
-
-            if constexpr (std::is_same_v<CodeWord, std::bitset<std::tuple_size_v<CodeWord>>>)
-            {
-                for (size_t i = 0; i < codeword.size(); ++i)
-                {
-                    if (dist(rng) < erasure_probability)
-                    {
-                        codeword[i] = 0; // Simple implementation
-                    }
-                }
-            }
-            else
-            {
-                for (auto &bit : codeword)
-                {
-                    if (dist(rng) < erasure_probability)
-                    {
-                        // Mark as erasure (could use special value)
-                        bit = 0; // Simple implementation
-                    }
-                }
-            }
+            // Mark as erasure (could use special value)
+            skipper.for_each_event(codeword.size(), rng, [&codeword](size_t i)
+                                   { codeword[i] = 0; });
         }
 
-        template <typename CodeWord>
-        void add_burst_errors(CodeWord &codeword, size_t burst_length)
+        template <typename CodeWord, typename Rng>
+        static void add_burst_errors(CodeWord &codeword, size_t burst_length, Rng &rng)
         {
             if (codeword.size() < burst_length)
                 return;
@@ -373,17 +730,24 @@ namespace ecc
         }
 
         template <typename CodeWord>
-        size_t count_bit_errors(const CodeWord &original, const CodeWord &received)
+        static size_t count_bit_errors(const CodeWord &original, const CodeWord &received)
         {
-            size_t errors = 0;
-            for (size_t i = 0; i < original.size(); ++i)
+            if constexpr (detail::is_bitset_v<CodeWord>)
+            {
+                return (original ^ received).count();
+            }
+            else
             {
-                if (original[i] != received[i])
+                size_t errors = 0;
+                for (size_t i = 0; i < original.size(); ++i)
                 {
-                    errors++;
+                    if (original[i] != received[i])
+                    {
+                        errors++;
+                    }
                 }
+                return errors;
             }
-            return errors;
         }
 
         template <typename CodeType>
@@ -408,10 +772,156 @@ namespace ecc
     {
     private:
         std::mt19937 rng;
+        WorkStealingPool *pool = nullptr;
+
+        // Patterns per work item of the exhaustive enumeration
+        static constexpr uint64_t enumeration_chunk = 1u << 14;
 
     public:
         ErrorPatternAnalyzer() : rng(std::chrono::steady_clock::now().time_since_epoch().count()) {}
 
+        /// Run exhaustive enumeration chunks on `worker_pool` (which must outlive its use); without a
+        /// pool they run on the calling thread
+        void set_pool(WorkStealingPool &worker_pool) noexcept { pool = &worker_pool; }
+
+        /// Chunks enumerated at once: the pool's thread count, or 1 without a pool
+        [[nodiscard]] size_t get_threads() const noexcept { return pool ? pool->get_thread_count() : 1; }
+
+        /// Decode every error pattern of weight 1..max_weight and count the outcomes per weight
+        ///
+        /// By linearity the all-zero codeword is sent, so a pattern's outcome depends only on its
+        /// syndrome. Patterns of each weight are visited in revolving-door order, where each step swaps
+        /// one position out and one in: the syndrome is updated with two column XORs instead of
+        /// re-encoding. Threads take chunks of consecutive combination ranks, unranking the first.
+        /// Outcomes are judged on the whole codeword, parity bits included.
+        template <SyndromeDecodable CodeType>
+        [[nodiscard]] std::vector<PatternWeightCounts> enumerate_error_patterns(const CodeType &code,
+                                                                                size_t max_weight) const
+        {
+            using Syndrome = typename CodeType::SyndromeValue;
+            constexpr size_t n = CodeType::code_length;
+
+            if (max_weight > n)
+                throw std::invalid_argument("Pattern weight exceeds the code length");
+
+            std::vector<Syndrome> columns(n);
+            for (size_t pos = 0; pos < n; ++pos)
+            {
+                columns[pos] = code.column_syndrome(pos);
+            }
+
+            const detail::BinomialTable binomial(n, max_weight);
+            std::vector<PatternWeightCounts> results;
+
+            for (size_t w = 1; w <= max_weight; ++w)
+            {
+                const uint64_t total = binomial(n, w);
+                if (total == UINT64_MAX)
+                    throw std::invalid_argument("Too many error patterns to enumerate");
+
+                const uint64_t chunks = (total + enumeration_chunk - 1) / enumeration_chunk;
+                const size_t workers = static_cast<size_t>(std::min<uint64_t>(get_threads(), chunks));
+
+                std::atomic<uint64_t> next_chunk{0};
+                std::vector<PatternWeightCounts> partial(workers);
+                std::vector<std::exception_ptr> errors(workers);
+
+                auto worker = [&](size_t id)
+                {
+                    try
+                    {
+                        std::vector<size_t> c(w + 1);
+                        std::vector<size_t> positions(n);
+                        auto &counts = partial[id];
+
+                        for (uint64_t chunk; (chunk = next_chunk.fetch_add(1)) < chunks;)
+                        {
+                            const uint64_t first = chunk * enumeration_chunk;
+                            const uint64_t count = std::min(enumeration_chunk, total - first);
+
+                            detail::revolving_door_unrank(binomial, n, w, first, std::span<size_t>(c).first(w));
+                            c[w] = n;
+
+                            Syndrome syndrome{};
+                            for (size_t i = 0; i < w; ++i)
+                            {
+                                detail::syndrome_xor(syndrome, columns[c[i]]);
+                            }
+
+                            for (uint64_t r = 0; r < count; ++r)
+                            {
+                                classify_pattern(code, syndrome, std::span<const size_t>(c).first(w), positions, counts);
+
+                                size_t removed, added;
+                                if (r + 1 < count && detail::revolving_door_next(c, removed, added))
+                                {
+                                    detail::syndrome_xor(syndrome, columns[removed]);
+                                    detail::syndrome_xor(syndrome, columns[added]);
+                                }
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        errors[id] = std::current_exception();
+                    }
+                };
+
+                std::optional<TaskGroup> group;
+                if (workers > 1)
+                {
+                    group.emplace(*pool);
+                    for (size_t id = 1; id < workers; ++id)
+                    {
+                        group->run([&worker, id]
+                                   { worker(id); });
+                    }
+                }
+                worker(0);
+                if (group)
+                    group->wait();
+                for (const auto &error : errors)
+                {
+                    if (error)
+                        std::rethrow_exception(error);
+                }
+
+                PatternWeightCounts counts;
+                counts.weight = w;
+                for (const auto &part : partial)
+                {
+                    counts.merge(part);
+                }
+                results.push_back(counts);
+            }
+
+            return results;
+        }
+
+        /// Print the per-weight outcome histogram of an exhaustive enumeration
+        static void print_pattern_histogram(const std::string &code_name, const std::vector<PatternWeightCounts> &results)
+        {
+            std::cout << "\nExhaustive Error Pattern Analysis for " << code_name << ":\n";
+            std::cout << std::string(84, '=') << "\n";
+            std::cout << std::left << std::setw(8) << "Weight"
+                      << std::setw(16) << "Patterns"
+                      << std::setw(15) << "Corrected"
+                      << std::setw(15) << "Detected"
+                      << std::setw(15) << "Miscorrected"
+                      << std::setw(15) << "Undetected" << "\n";
+            std::cout << std::string(84, '-') << "\n";
+
+            for (const auto &counts : results)
+            {
+                std::cout << std::left << std::setw(8) << counts.weight
+                          << std::setw(16) << counts.patterns
+                          << std::setw(15) << counts.corrected
+                          << std::setw(15) << counts.detected
+                          << std::setw(15) << counts.miscorrected
+                          << std::setw(15) << counts.undetected << "\n";
+            }
+        }
+
         /// Analyze error correction patterns
         template <ErrorCorrectionCode CodeType>
         void analyze_error_patterns(size_t max_errors, size_t iterations_per_pattern)
@@ -451,6 +961,33 @@ namespace ecc
         }
 
     private:
+        /// Outcome of one error pattern (ascending positions `pattern`) with syndrome `syndrome`
+        template <SyndromeDecodable CodeType>
+        static void classify_pattern(const CodeType &code, const typename CodeType::SyndromeValue &syndrome,
+                                     std::span<const size_t> pattern, std::vector<size_t> &positions,
+                                     PatternWeightCounts &counts)
+        {
+            ++counts.patterns;
+            if (syndrome == typename CodeType::SyndromeValue{})
+            {
+                ++counts.undetected;
+                return;
+            }
+
+            const auto located = code.locate_errors(syndrome, positions);
+            if (!located)
+            {
+                ++counts.detected;
+                return;
+            }
+
+            std::sort(positions.begin(), positions.begin() + *located);
+            if (*located == pattern.size() && std::equal(pattern.begin(), pattern.end(), positions.begin()))
+                ++counts.corrected;
+            else
+                ++counts.miscorrected;
+        }
+
         template <ErrorCorrectionCode CodeType>
         std::pair<double, double> test_error_pattern(
             const CodeType &code, size_t num_errors, size_t iterations, bool burst_pattern)
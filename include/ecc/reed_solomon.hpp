@@ -1,17 +1,27 @@
 #pragma once
 
 #include "galois_field.hpp"
+#include "decoder_stats.hpp"
+#include "packed_codewords.hpp"
 #include <vector>
 #include <memory>
 #include <algorithm>
 #include <numeric>
 #include <span>
+#include <array>
+#include <stdexcept>
+#include <bitset>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 namespace ecc
 {
 
     /// Reed-Solomon code implementation with configurable parameters
-    template <size_t n, size_t k, size_t m = 8>
+    ///
+    /// `Stats` is the decoder stats policy (see decoder_stats.hpp); the default records nothing.
+    template <size_t n, size_t k, size_t m = 8, typename Stats = NoDecoderStats>
         requires(n <= (1u << m) - 1) && (k <= n) && (n - k <= n)
     class ReedSolomonCode
     {
@@ -26,21 +36,55 @@ namespace ecc
         using Symbol = uint32_t;
         using CodeWord = std::array<Symbol, n>;
         using DataWord = std::array<Symbol, k>;
+        using Syndromes = std::array<Symbol, parity_length>;
         using Field = GaloisField<m>;
         using Polynomial = GFPolynomial<m>;
 
     private:
-        std::unique_ptr<Field> field;
+        /// Marks a zero generator coefficient in generator_log
+        static constexpr Symbol log_zero = static_cast<Symbol>(Field::field_size);
+
+        /// Symbol and per-constant product table types of the batched paths (GF(2^8) and GF(2^16))
+        static constexpr bool has_region_kernels = (m == 8 || m == 16);
+        using RegionWord = std::conditional_t<(m == 16), uint16_t, uint8_t>;
+        using RegionTables = std::conditional_t<(m == 16), detail::SplitTables16, detail::NibbleTables>;
+
+        /// Target size of the parity workspace of one batched block
+        static constexpr size_t block_workspace_bytes = 16384;
+
+        /// Codewords per block in the batched encoder (bounds the parity workspace to ~16 KiB)
+        static constexpr size_t batch_lanes =
+            std::clamp<size_t>((block_workspace_bytes / (std::max<size_t>(parity_length, 1) * sizeof(RegionWord))) & ~size_t{31}, 32, 256);
+
+        /// Long GF(2^16) parity sections overflow the budget even at the minimum lane count; their
+        /// block registers live in a per-thread heap buffer instead of on the stack
+        static constexpr size_t block_register_words = parity_length * batch_lanes;
+        static constexpr bool block_registers_on_heap = block_register_words * sizeof(RegionWord) > block_workspace_bytes;
+        using BlockRegisterStack = std::array<RegionWord, block_registers_on_heap ? 0 : block_register_words>;
+
+        const Field *field; // Shared per primitive polynomial, see GaloisField::shared()
         Polynomial generator_poly;
         Symbol primitive_element;
 
+        // log of each generator coefficient g_0..g_(n-k-1) (g_(n-k) = 1), for the LFSR encoder
+        std::array<Symbol, parity_length> generator_log{};
+
+        // Product tables for each generator coefficient (batch encoder only; GF(2^16) tables are
+        // 1 KB+ each, so they live on the heap rather than in the code object)
+        std::vector<RegionTables> generator_tables;
+
+        // Product tables for alpha^1..alpha^(n-k) (batch syndromes only)
+        std::vector<RegionTables> syndrome_tables;
+
+        ECC_NO_UNIQUE_ADDRESS Stats stats;
+
     public:
         /// Constructor with default primitive polynomial
         ReedSolomonCode() : ReedSolomonCode(get_default_primitive_poly()) {}
 
         /// Constructor with custom primitive polynomial
         explicit ReedSolomonCode(Symbol primitive_polynomial)
-            : field(std::make_unique<Field>(primitive_polynomial)),
+            : field(&Field::shared(primitive_polynomial)),
               generator_poly(*field),
               primitive_element(field->get_primitive())
         {
@@ -49,29 +93,38 @@ namespace ecc
         }
 
         /// Encode data symbols into codeword
-        [[nodiscard]] CodeWord encode(const DataWord &data) const
+        ///
+        /// Systematic layout: codeword[0..k) holds the data (data[i] is the coefficient of x^(n-k+i))
+        /// and codeword[k + i] the parity coefficient of x^i. Parity is produced by an LFSR division
+        /// by g(x), written directly into the codeword with no allocation.
+        [[nodiscard]] CodeWord encode(const DataWord &data) const noexcept
         {
             CodeWord codeword{};
-
-            // Copy data to systematic positions
             std::copy(data.begin(), data.end(), codeword.begin());
 
-            // Calculate parity symbols
-            auto data_poly = Polynomial(*field,
-                                        std::vector<Symbol>(data.begin(), data.end()));
+            if constexpr (parity_length > 0)
+            {
+                Symbol *parity = codeword.data() + k;
 
-            // Multiply by x^(n-k) to shift data
-            std::vector<Symbol> shifted_coeffs(parity_length, 0);
-            shifted_coeffs.insert(shifted_coeffs.end(), data.begin(), data.end());
-            auto shifted_poly = Polynomial(*field, std::move(shifted_coeffs));
+                // Feed data from the highest degree term down
+                for (size_t j = k; j-- > 0;)
+                {
+                    Symbol feedback = data[j] ^ parity[parity_length - 1];
 
-            // Calculate remainder
-            auto remainder = polynomial_mod(shifted_poly, generator_poly);
+                    if (feedback == 0)
+                    {
+                        std::copy_backward(parity, parity + parity_length - 1, parity + parity_length);
+                        parity[0] = 0;
+                        continue;
+                    }
 
-            // Add parity symbols
-            for (size_t i = 0; i < parity_length; ++i)
-            {
-                codeword[k + i] = remainder[i];
+                    size_t feedback_log = field->log(feedback);
+                    for (size_t i = parity_length - 1; i > 0; --i)
+                    {
+                        parity[i] = parity[i - 1] ^ scale_generator(feedback_log, i);
+                    }
+                    parity[0] = scale_generator(feedback_log, 0);
+                }
             }
 
             return codeword;
@@ -80,15 +133,98 @@ namespace ecc
         /// Encode vector of data symbols
         [[nodiscard]] std::vector<CodeWord> encode(std::span<const DataWord> data) const
         {
-            std::vector<CodeWord> result;
-            result.reserve(data.size());
+            std::vector<CodeWord> result(data.size());
+            encode(data, result);
+            return result;
+        }
+
+        /// Encode into a caller-provided buffer (codewords.size() must equal data.size())
+        void encode(std::span<const DataWord> data, std::span<CodeWord> codewords) const
+        {
+            if (codewords.size() != data.size())
+                throw std::invalid_argument("Output span size does not match input span size");
 
-            for (const auto &word : data)
+            for (size_t i = 0; i < data.size(); ++i)
             {
-                result.push_back(encode(word));
+                codewords[i] = encode(data[i]);
             }
+        }
 
-            return result;
+        /// Batch encode of byte symbols from contiguous buffers (GF(2^8) only)
+        ///
+        /// data holds count * k bytes (one message after another) and codewords receives count * n
+        /// bytes in the same layout as encode(). Codewords are processed in blocks, with the LFSR
+        /// registers of a block stored lane-wise so each generator tap is one SIMD mul-add region.
+        void encode_bytes(std::span<const uint8_t> data, std::span<uint8_t> codewords) const
+            requires(m == 8)
+        {
+            encode_region(data, codewords);
+        }
+
+        /// Batch encode of 16-bit symbols from contiguous buffers (GF(2^16) only)
+        ///
+        /// Same layout and blocking as encode_bytes(), one word per symbol; each generator tap is a
+        /// split-table mul-add region, so the 384 KB exp/log tables stay out of the inner loop.
+        void encode_words(std::span<const uint16_t> data, std::span<uint16_t> codewords) const
+            requires(m == 16)
+        {
+            encode_region(data, codewords);
+        }
+
+        /// Batch encode of a packed buffer of data words into `out` (packed codewords)
+        ///
+        /// Symbol j of a word occupies bits [j * m, (j + 1) * m), so data words are k * m bits and
+        /// codewords n * m bits. GF(2^8) and GF(2^16) codes gather each block of words into the lane
+        /// buffers of the batched encoder; other fields encode word by word.
+        void encode(const PackedCodewords &data, PackedCodewords &out) const
+        {
+            if (data.codeword_length() != k * m)
+                throw std::invalid_argument("Packed data words do not match the code dimension");
+
+            out.reshape(n * m, data.size());
+            if constexpr (has_region_kernels)
+            {
+                const size_t block = std::min(batch_lanes, data.size());
+                std::vector<RegionWord> message(block * k);
+                std::vector<RegionWord> codewords(block * n);
+                for (size_t first = 0; first < data.size(); first += batch_lanes)
+                {
+                    const size_t lanes = std::min(batch_lanes, data.size() - first);
+                    for (size_t l = 0; l < lanes; ++l)
+                    {
+                        for (size_t j = 0; j < k; ++j)
+                        {
+                            message[l * k + j] = static_cast<RegionWord>(data.get_bits(first + l, j * m, m));
+                        }
+                    }
+
+                    encode_block(message.data(), codewords.data(), lanes);
+
+                    for (size_t l = 0; l < lanes; ++l)
+                    {
+                        for (size_t j = 0; j < n; ++j)
+                        {
+                            out.set_bits(first + l, j * m, m, codewords[l * n + j]);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                DataWord message;
+                for (size_t i = 0; i < data.size(); ++i)
+                {
+                    for (size_t j = 0; j < k; ++j)
+                    {
+                        message[j] = static_cast<Symbol>(data.get_bits(i, j * m, m));
+                    }
+                    const CodeWord codeword = encode(message);
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        out.set_bits(i, j * m, m, codeword[j]);
+                    }
+                }
+            }
         }
 
         /// Decode received codeword with error correction
@@ -100,82 +236,180 @@ namespace ecc
             std::vector<size_t> error_positions;
         };
 
+        /// Decode result with error positions held in a fixed array (first errors_corrected valid)
+        template <size_t capacity>
+        struct BasicFixedDecodeResult
+        {
+            DataWord data;
+            bool success;
+            size_t errors_corrected;
+            std::array<size_t, capacity> error_positions;
+        };
+
+        using FixedDecodeResult = BasicFixedDecodeResult<error_correction_capability>;
+
+        /// Errors-and-erasures decode result: up to n-k corrected positions
+        using ErasureDecodeResult = BasicFixedDecodeResult<parity_length>;
+
         [[nodiscard]] DecodeResult decode(const CodeWord &received) const
         {
+            FixedDecodeResult fixed = decode_fixed(received);
+
             DecodeResult result{};
+            result.data = fixed.data;
+            result.success = fixed.success;
+            result.errors_corrected = fixed.errors_corrected;
+            result.error_positions.assign(fixed.error_positions.begin(),
+                                          fixed.error_positions.begin() + fixed.errors_corrected);
 
-            // Calculate syndrome
-            auto syndromes = calculate_syndromes(received);
+            return result;
+        }
 
-            // Check if there are errors
-            bool has_errors = std::any_of(syndromes.begin(), syndromes.end(),
-                                          [](Symbol s)
-                                          { return s != 0; });
+        /// Decode without any heap allocation
+        ///
+        /// All temporaries (syndromes, locator polynomials, evaluator, roots) are fixed arrays bounded
+        /// by the parity length, so this is safe to call from real-time threads.
+        [[nodiscard]] FixedDecodeResult decode_fixed(const CodeWord &received) const noexcept
+        {
+            FixedDecodeResult result = correct<FixedDecodeResult>(received, {});
+            stats.record_decode(!result.success || result.errors_corrected > 0, result.success, result.errors_corrected);
+            return result;
+        }
 
-            if (!has_errors)
-            {
-                // No errors detected
-                std::copy(received.begin(), received.begin() + k, result.data.begin());
-                result.success = true;
-                result.errors_corrected = 0;
-                return result;
-            }
+        /// Decode with known erasures (distinct codeword indices whose symbols are unreliable)
+        ///
+        /// Each erasure costs one parity symbol instead of two, so any e errors and f erasures with
+        /// 2e + f <= n-k are corrected. Erased symbols may hold any value; errors_corrected counts the
+        /// symbols actually changed, erased or not.
+        [[nodiscard]] DecodeResult decode(const CodeWord &received, std::span<const size_t> erasures) const
+        {
+            const ErasureDecodeResult fixed = decode_fixed(received, erasures);
 
-            // Find error locator polynomial using Berlekamp-Massey algorithm
-            auto error_locator = berlekamp_massey(syndromes);
+            DecodeResult result{};
+            result.data = fixed.data;
+            result.success = fixed.success;
+            result.errors_corrected = fixed.errors_corrected;
+            result.error_positions.assign(fixed.error_positions.begin(),
+                                          fixed.error_positions.begin() + fixed.errors_corrected);
 
-            // Find error positions using Chien search
-            auto error_positions = chien_search(error_locator);
+            return result;
+        }
 
-            if (error_positions.size() > error_correction_capability)
+        /// Errors-and-erasures decode without any heap allocation
+        [[nodiscard]] ErasureDecodeResult decode_fixed(const CodeWord &received, std::span<const size_t> erasures) const
+        {
+            for (size_t index : erasures)
             {
-                // Too many errors to correct
-                result.success = false;
-                return result;
+                if (index >= n)
+                    throw std::invalid_argument("Erasure position outside the codeword");
             }
 
-            // Calculate error values using Forney algorithm
-            auto error_values = forney_algorithm(syndromes, error_locator, error_positions);
+            ErasureDecodeResult result = correct<ErasureDecodeResult>(received, erasures);
+            stats.record_decode(!result.success || result.errors_corrected > 0, result.success, result.errors_corrected);
+            return result;
+        }
 
-            // Correct errors
-            auto corrected = received;
-            for (size_t i = 0; i < error_positions.size(); ++i)
+        /// Batch decode of a packed buffer of codewords into `out` (packed data words, layout of the
+        /// packed encode()); returns the number of uncorrectable words, whose data is passed through
+        /// uncorrected
+        size_t decode(const PackedCodewords &received, PackedCodewords &out) const
+        {
+            if (received.codeword_length() != n * m)
+                throw std::invalid_argument("Packed codewords do not match the code length");
+
+            out.reshape(k * m, received.size());
+            CodeWord codeword;
+            size_t failures = 0;
+            for (size_t i = 0; i < received.size(); ++i)
             {
-                corrected[error_positions[i]] = field->add(
-                    corrected[error_positions[i]], error_values[i]);
-            }
+                for (size_t j = 0; j < n; ++j)
+                {
+                    codeword[j] = static_cast<Symbol>(received.get_bits(i, j * m, m));
+                }
 
-            // Extract data
-            std::copy(corrected.begin(), corrected.begin() + k, result.data.begin());
-            result.success = true;
-            result.errors_corrected = error_positions.size();
-            result.error_positions = std::move(error_positions);
+                const FixedDecodeResult result = decode_fixed(codeword);
+                failures += !result.success;
+                for (size_t j = 0; j < k; ++j)
+                {
+                    out.set_bits(i, j * m, m, result.data[j]);
+                }
+            }
 
-            return result;
+            return failures;
         }
 
-        /// Calculate syndrome vector
-        [[nodiscard]] std::vector<Symbol> calculate_syndromes(const CodeWord &received) const
+        /// Calculate syndromes S_i = c(alpha^i), i = 1..n-k
+        ///
+        /// Uses the same symbol-to-power mapping as encode(), evaluated in Horner form from the
+        /// highest degree term: every received symbol updates all accumulators by one multiply. The
+        /// accumulator loop is multi-versioned per SIMD level.
+        [[nodiscard]] Syndromes calculate_syndromes(const CodeWord &received) const noexcept
         {
-            std::vector<Symbol> syndromes(parity_length);
+            return detail::simd_dispatch([&]
+                                         {
+                Syndromes syndromes{};
 
-            for (size_t i = 0; i < parity_length; ++i)
-            {
-                Symbol syndrome = 0;
-                Symbol alpha_power = field->power(primitive_element, i + 1);
-                Symbol current_power = 1;
+                auto accumulate = [&](Symbol symbol)
+                {
+                    for (size_t i = 0; i < parity_length; ++i)
+                    {
+                        Symbol s = syndromes[i];
+                        syndromes[i] = ((s == 0) ? 0 : field->exp(field->log(s) + i + 1)) ^ symbol;
+                    }
+                };
 
-                for (size_t j = 0; j < n; ++j)
+                // Data holds powers n-1 .. n-k, parity powers n-k-1 .. 0
+                for (size_t j = k; j-- > 0;)
+                {
+                    accumulate(received[j]);
+                }
+                for (size_t j = n; j-- > k;)
                 {
-                    syndrome = field->add(syndrome,
-                                          field->multiply(received[j], current_power));
-                    current_power = field->multiply(current_power, alpha_power);
+                    accumulate(received[j]);
                 }
 
-                syndromes[i] = syndrome;
+                return syndromes; });
+        }
+
+        /// Calculate syndromes for many codewords (syndromes.size() must equal received.size())
+        void calculate_syndromes(std::span<const CodeWord> received, std::span<Syndromes> syndromes) const
+        {
+            if (syndromes.size() != received.size())
+                throw std::invalid_argument("Output span size does not match input span size");
+
+            for (size_t i = 0; i < received.size(); ++i)
+            {
+                syndromes[i] = calculate_syndromes(received[i]);
             }
+        }
+
+        /// Batch syndromes of byte codewords from a contiguous buffer (GF(2^8) only)
+        ///
+        /// received holds count * n bytes in the encode() layout; syndromes receives count * (n-k)
+        /// bytes, S_1..S_(n-k) per codeword. Codewords are evaluated in lane-major blocks so that each
+        /// Horner step is one SIMD constant-multiply region per syndrome.
+        void calculate_syndromes_bytes(std::span<const uint8_t> received, std::span<uint8_t> syndromes) const
+            requires(m == 8)
+        {
+            syndromes_region(received, syndromes);
+        }
 
-            return syndromes;
+        /// Batch syndromes of 16-bit codewords from a contiguous buffer (GF(2^16) only)
+        void calculate_syndromes_words(std::span<const uint16_t> received, std::span<uint16_t> syndromes) const
+            requires(m == 16)
+        {
+            syndromes_region(received, syndromes);
+        }
+
+        /// True when every syndrome is zero (received word is a codeword)
+        [[nodiscard]] static bool syndromes_zero(const Syndromes &syndromes) noexcept
+        {
+            Symbol any = 0;
+            for (Symbol s : syndromes)
+            {
+                any |= s;
+            }
+            return any == 0;
         }
 
         /// Get minimum distance
@@ -196,170 +430,791 @@ namespace ecc
             return static_cast<double>(k) / n;
         }
 
+        /// Decoder counters (a NoDecoderStats policy holds none)
+        [[nodiscard]] const Stats &get_stats() const noexcept
+        {
+            return stats;
+        }
+
     private:
         void generate_polynomial()
         {
             // Generator polynomial g(x) = (x - α)(x - α²)...(x - α^(n-k))
-            std::vector<Symbol> coeffs = {1};
-            auto gen_poly = Polynomial(*field, coeffs);
+            InlineGFPolynomial<m, parity_length> gen_poly(*field, {1});
 
             for (size_t i = 1; i <= parity_length; ++i)
             {
                 Symbol root = field->power(primitive_element, i);
 
                 // Multiply by (x - root)
-                std::vector<Symbol> factor_coeffs = {root, 1};
-                auto factor = Polynomial(*field, factor_coeffs);
-                gen_poly = gen_poly * factor;
+                gen_poly = gen_poly * InlineGFPolynomial<m, 1>(*field, {root, 1});
             }
 
-            generator_poly = std::move(gen_poly);
+            generator_poly = gen_poly.to_polynomial();
+
+            for (size_t i = 0; i < parity_length; ++i)
+            {
+                Symbol coefficient = generator_poly[i];
+                generator_log[i] = (coefficient == 0) ? log_zero : static_cast<Symbol>(field->log(coefficient));
+
+                if constexpr (has_region_kernels)
+                {
+                    generator_tables.push_back(make_region_tables(coefficient));
+                    syndrome_tables.push_back(make_region_tables(field->exp(i + 1)));
+                }
+            }
         }
 
-        [[nodiscard]] Polynomial polynomial_mod(const Polynomial &dividend,
-                                                const Polynomial &divisor) const
+        [[nodiscard]] RegionTables make_region_tables(Symbol c) const noexcept
+            requires has_region_kernels
         {
-            auto quotient = dividend;
-            size_t divisor_degree = divisor.degree();
+            if constexpr (m == 16)
+                return detail::make_split_tables(*field, static_cast<uint16_t>(c));
+            else
+                return detail::make_nibble_tables(*field, static_cast<uint8_t>(c));
+        }
 
-            while (quotient.degree() >= divisor_degree && !quotient.is_zero())
+        /// alpha^feedback_log * g_i via log tables
+        [[nodiscard]] Symbol scale_generator(size_t feedback_log, size_t i) const noexcept
+        {
+            if (generator_log[i] == log_zero)
+                return 0;
+
+            return field->exp(feedback_log + generator_log[i]);
+        }
+
+        /// Blocked batch encode shared by encode_bytes() and encode_words()
+        void encode_region(std::span<const RegionWord> data, std::span<RegionWord> codewords) const
+            requires has_region_kernels
+        {
+            if (data.size() % k != 0)
+                throw std::invalid_argument("Data buffer size must be a multiple of the data length");
+
+            const size_t count = data.size() / k;
+            if (codewords.size() != count * n)
+                throw std::invalid_argument("Codeword buffer size does not match data buffer size");
+
+            for (size_t first = 0; first < count; first += batch_lanes)
             {
-                Symbol lead_coeff = quotient[quotient.degree()];
-                Symbol divisor_lead = divisor[divisor_degree];
-                Symbol factor = field->divide(lead_coeff, divisor_lead);
+                const size_t lanes = std::min(batch_lanes, count - first);
+                encode_block(data.data() + first * k, codewords.data() + first * n, lanes);
+            }
+        }
 
-                size_t shift = quotient.degree() - divisor_degree;
+        /// Blocked batch syndromes shared by calculate_syndromes_bytes() and calculate_syndromes_words()
+        void syndromes_region(std::span<const RegionWord> received, std::span<RegionWord> syndromes) const
+            requires has_region_kernels
+        {
+            if (received.size() % n != 0)
+                throw std::invalid_argument("Codeword buffer size must be a multiple of the code length");
 
-                // Subtract factor * x^shift * divisor
-                for (size_t i = 0; i <= divisor_degree; ++i)
-                {
-                    Symbol term = field->multiply(factor, divisor[i]);
-                    Symbol current = quotient[i + shift];
-                    quotient.set_coefficient(i + shift, field->add(current, term));
-                }
+            const size_t count = received.size() / n;
+            if (syndromes.size() != count * parity_length)
+                throw std::invalid_argument("Syndrome buffer size does not match codeword buffer size");
+
+            for (size_t first = 0; first < count; first += batch_lanes)
+            {
+                const size_t lanes = std::min(batch_lanes, count - first);
+                syndrome_block(received.data() + first * n, syndromes.data() + first * parity_length, lanes);
             }
+        }
 
-            return quotient;
+        /// Zeroed parity_length x batch_lanes registers of one block: `stack`, or the thread's heap buffer
+        static std::span<RegionWord> block_registers(BlockRegisterStack &stack)
+        {
+            if constexpr (block_registers_on_heap)
+            {
+                thread_local std::vector<RegionWord> scratch;
+                scratch.assign(block_register_words, RegionWord{0});
+                return scratch;
+            }
+            else
+            {
+                stack.fill(RegionWord{0});
+                return stack;
+            }
         }
 
-        [[nodiscard]] Polynomial berlekamp_massey(const std::vector<Symbol> &syndromes) const
+        /// LFSR encode of `lanes` consecutive messages
+        void encode_block(const RegionWord *data, RegionWord *codewords, size_t lanes) const
+            requires has_region_kernels
         {
-            size_t L = 0;   // Current length
-            size_t pos = 1; // Position of last length change
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                std::copy(data + lane * k, data + (lane + 1) * k, codewords + lane * n);
+            }
 
-            std::vector<Symbol> C(parity_length + 1, 0); // Connection polynomial
-            std::vector<Symbol> B(parity_length + 1, 0); // Previous connection polynomial
-            std::vector<Symbol> T(parity_length + 1, 0); // Temporary
+            if constexpr (parity_length > 0)
+            {
+                // Register r_i of every lane lives in row (base + i) % parity_length
+                BlockRegisterStack stack;
+                const std::span<RegionWord> registers = block_registers(stack);
+                std::array<RegionWord, batch_lanes> feedback{};
+                size_t base = 0;
 
-            C[0] = 1;
-            B[0] = 1;
+                auto row = [&](size_t i)
+                { return registers.data() + ((base + i) % parity_length) * batch_lanes; };
 
-            for (size_t i = 0; i < parity_length; ++i)
-            {
-                // Calculate discrepancy
-                Symbol d = syndromes[i];
-                for (size_t j = 1; j <= L; ++j)
+                for (size_t j = k; j-- > 0;)
                 {
-                    d = field->add(d, field->multiply(C[j], syndromes[i - j]));
+                    const RegionWord *top = row(parity_length - 1);
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        feedback[lane] = data[lane * k + j] ^ top[lane];
+                    }
+
+                    // Shift: r_i <- r_(i-1), and the old top row becomes the new r_0 = 0
+                    base = (base + parity_length - 1) % parity_length;
+                    std::fill_n(row(0), lanes, RegionWord{0});
+
+                    for (size_t i = 0; i < parity_length; ++i)
+                    {
+                        detail::multiply_region<true>(generator_tables[i], feedback.data(), row(i), lanes);
+                    }
                 }
 
-                if (d == 0)
+                for (size_t i = 0; i < parity_length; ++i)
                 {
-                    pos++;
+                    const RegionWord *r = row(i);
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        codewords[lane * n + k + i] = r[lane];
+                    }
                 }
-                else
+            }
+        }
+
+        /// Horner syndromes of `lanes` consecutive codewords
+        void syndrome_block(const RegionWord *received, RegionWord *syndromes, size_t lanes) const
+            requires has_region_kernels
+        {
+            if constexpr (parity_length > 0)
+            {
+                // accumulators[i * batch_lanes + lane] holds S_(i+1) of that lane
+                BlockRegisterStack stack;
+                const std::span<RegionWord> accumulators = block_registers(stack);
+                std::array<RegionWord, batch_lanes> column{};
+
+                auto step = [&](size_t j, bool last)
                 {
-                    std::copy(C.begin(), C.end(), T.begin());
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        column[lane] = received[lane * n + j];
+                    }
 
-                    Symbol d_inv = field->inverse(d);
-                    for (size_t idx = 0; idx < parity_length + 1 - pos && idx + pos < parity_length + 1; ++idx)
+                    for (size_t i = 0; i < parity_length; ++i)
                     {
-                        C[idx + pos] = field->add(C[idx + pos],
-                                                  field->multiply(d_inv, B[idx]));
+                        RegionWord *acc = accumulators.data() + i * batch_lanes;
+                        detail::xor_region(column.data(), acc, lanes);
+                        if (!last)
+                        {
+                            detail::multiply_region<false>(syndrome_tables[i], acc, acc, lanes);
+                        }
                     }
+                };
+
+                for (size_t j = k; j-- > 0;)
+                {
+                    step(j, false);
+                }
+                for (size_t j = n; j-- > k;)
+                {
+                    step(j, j == k);
+                }
 
-                    if (2 * L <= i)
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    for (size_t i = 0; i < parity_length; ++i)
                     {
-                        L = i + 1 - L;
-                        std::copy(T.begin(), T.end(), B.begin());
-                        pos = 1;
+                        syndromes[lane * parity_length + i] = accumulators[i * batch_lanes + lane];
                     }
-                    else
+                }
+            }
+        }
+
+        /// Error locator coefficients Lambda_0..Lambda_(n-k)
+        using Locator = InlineGFPolynomial<m, parity_length>;
+
+        /// a * alpha^exponent for exponent < 2^m - 1
+        [[nodiscard]] Symbol scale(Symbol a, size_t exponent) const noexcept
+        {
+            return (a == 0) ? 0 : field->exp(field->log(a) + exponent);
+        }
+
+        /// Codeword index holding the coefficient of x^power (inverse of the encode() layout)
+        [[nodiscard]] static constexpr size_t index_of_power(size_t power) noexcept
+        {
+            return (power >= parity_length) ? power - parity_length : k + power;
+        }
+
+        /// Power of x whose coefficient codeword[index] holds
+        [[nodiscard]] static constexpr size_t power_of_index(size_t index) noexcept
+        {
+            return (index < k) ? index + parity_length : index - k;
+        }
+
+        /// Syndromes, Berlekamp-Massey, Chien search and Forney correction of one codeword
+        ///
+        /// Erasures seed Berlekamp-Massey with their locator Gamma(x) = prod (1 + X_j x), so the
+        /// locator it returns covers errors and erasures together (Blahut's errata decoder).
+        template <typename Result>
+        [[nodiscard]] Result correct(const CodeWord &received, std::span<const size_t> erasures) const noexcept
+        {
+            Result result{};
+            std::copy(received.begin(), received.begin() + k, result.data.begin());
+
+            // Calculate syndrome
+            const Syndromes syndromes = calculate_syndromes(received);
+
+            if (syndromes_zero(syndromes))
+            {
+                // No errors detected
+                result.success = true;
+                return result;
+            }
+
+            constexpr size_t capacity = std::tuple_size_v<decltype(result.error_positions)>;
+            if constexpr (capacity > 0)
+            {
+                const size_t erasure_count = erasures.size();
+                if (erasure_count > parity_length)
+                {
+                    return result;
+                }
+
+                // Erasure locator, then the errata locator by Berlekamp-Massey
+                Locator locator(*field);
+                locator[0] = 1;
+                for (size_t e = 0; e < erasure_count; ++e)
+                {
+                    const Symbol x = field->exp(power_of_index(erasures[e]));
+                    for (size_t j = e + 1; j > 0; --j)
                     {
-                        pos++;
+                        locator[j] ^= field->multiply(locator[j - 1], x);
                     }
                 }
+                size_t locator_degree = berlekamp_massey(syndromes, locator, erasure_count);
+
+                if (2 * locator_degree > parity_length + erasure_count)
+                {
+                    // Too many errors to correct
+                    return result;
+                }
+
+                // Find error positions (as powers of x) using Chien search
+                std::array<size_t, capacity> error_powers{};
+                if (chien_search(locator, locator_degree, error_powers) != locator_degree)
+                {
+                    // Locator does not split into distinct roots: uncorrectable
+                    return result;
+                }
+
+                // Calculate error values using Forney algorithm and correct data symbols
+                forney_algorithm(syndromes, locator, locator_degree, error_powers, result);
             }
 
-            return Polynomial(*field, std::vector<Symbol>(C.begin(), C.begin() + L + 1));
+            return result;
         }
 
-        [[nodiscard]] std::vector<size_t> chien_search(const Polynomial &error_locator) const
+        /// Berlekamp-Massey: fills the connection polynomial and returns its length L
+        ///
+        /// `C` enters as the locator of the first `erasure_count` erasures (1 without any), which
+        /// fixes its first erasure_count steps; the remaining syndromes then extend it by the errors.
+        size_t berlekamp_massey(const Syndromes &syndromes, Locator &C, size_t erasure_count = 0) const noexcept
         {
-            std::vector<size_t> positions;
+            size_t L = erasure_count; // Current length
+            size_t pos = 1;           // Shift since last length change
+            Symbol b = 1;             // Discrepancy at last length change
+
+            Locator B = C;     // Previous connection polynomial
+            Locator T(*field); // Temporary
 
-            for (size_t i = 0; i < n; ++i)
+            for (size_t i = erasure_count; i < parity_length; ++i)
             {
-                Symbol alpha_inv = field->power(primitive_element, n - 1 - i);
-                if (error_locator.evaluate(alpha_inv) == 0)
+                // Calculate discrepancy
+                Symbol d = syndromes[i];
+                for (size_t j = 1; j <= std::min(L, i); ++j)
+                {
+                    d ^= field->multiply(C[j], syndromes[i - j]);
+                }
+
+                if (d == 0)
+                {
+                    pos++;
+                    continue;
+                }
+
+                // C(x) -= (d / b) x^pos B(x)
+                T = C;
+                C.add_scaled(B, field->divide(d, b), pos);
+
+                if (2 * L <= i + erasure_count)
                 {
-                    positions.push_back(i);
+                    L = i + 1 + erasure_count - L;
+                    B = T;
+                    b = d;
+                    pos = 1;
+                }
+                else
+                {
+                    pos++;
                 }
             }
 
-            return positions;
+            stats.record(DecoderEvent::Iterations, parity_length);
+            return L;
         }
 
-        [[nodiscard]] std::vector<Symbol> forney_algorithm(
-            const std::vector<Symbol> &syndromes,
-            const Polynomial &error_locator,
-            const std::vector<size_t> &error_positions) const
+        /// Chien search: finds powers e with Lambda(alpha^-e) = 0, returns how many were found
+        ///
+        /// Each locator term Lambda_i alpha^(-e i) is advanced by one multiply per step instead of
+        /// evaluating the polynomial from scratch, and the scan stops once `degree` roots are found.
+        size_t chien_search(const Locator &locator, size_t degree, std::span<size_t> powers) const noexcept
         {
+            constexpr size_t order = Field::field_size - 1;
 
-            std::vector<Symbol> error_values(error_positions.size());
+            Locator terms = locator;
+            size_t found = 0;
 
-            // Calculate error evaluator polynomial
-            std::vector<Symbol> syndrome_coeffs(syndromes.rbegin(), syndromes.rend());
-            auto syndrome_poly = Polynomial(*field, syndrome_coeffs);
-            auto error_evaluator = syndrome_poly * error_locator;
+            for (size_t e = 0; e < n && found < degree; ++e)
+            {
+                Symbol sum = 0;
+                for (size_t i = 0; i <= degree; ++i)
+                {
+                    sum ^= terms[i];
+                }
 
-            // Calculate derivative of error locator
-            std::vector<Symbol> derivative_coeffs;
-            for (size_t i = 1; i <= error_locator.degree(); i += 2)
+                if (sum == 0)
+                {
+                    powers[found++] = e;
+                }
+
+                // terms[i] *= alpha^(-i)
+                for (size_t i = 1; i <= degree; ++i)
+                {
+                    terms[i] = scale(terms[i], order - i);
+                }
+            }
+
+            return found;
+        }
+
+        /// Forney algorithm: computes error magnitudes and applies those that fall in the data
+        ///
+        /// All magnitudes are computed before any is applied, so a failure leaves the data exactly as
+        /// received. Roots whose magnitude is zero (an erasure that was received correctly) change
+        /// nothing and are not reported.
+        template <typename Result>
+        void forney_algorithm(const Syndromes &syndromes, const Locator &locator, size_t degree,
+                              std::span<const size_t> powers, Result &result) const noexcept
+        {
+            constexpr size_t order = Field::field_size - 1;
+            constexpr size_t capacity = std::tuple_size_v<decltype(result.error_positions)>;
+
+            // Error evaluator Omega(x) = S(x) Lambda(x) mod x^(n-k), S(x) = sum S_(i+1) x^i
+            InlineGFPolynomial<m, parity_length - 1> syndrome_poly(*field);
+            for (size_t i = 0; i < parity_length; ++i)
             {
-                if (i < error_locator.degree() + 1)
+                syndrome_poly[i] = syndromes[i];
+            }
+            const auto evaluator = syndrome_poly.multiply_mod(locator, parity_length);
+            const Locator locator_derivative = locator.derivative();
+
+            std::array<Symbol, capacity> magnitudes{};
+            for (size_t r = 0; r < degree; ++r)
+            {
+                // X^-1 = alpha^(-e)
+                const Symbol x_inverse = field->exp((order - powers[r] % order) % order);
+
+                const Symbol numerator = evaluator.evaluate(x_inverse);
+                const Symbol denominator = locator_derivative.evaluate(x_inverse);
+
+                if (denominator == 0)
                 {
-                    derivative_coeffs.push_back(error_locator[i]);
+                    return;
                 }
+                magnitudes[r] = (numerator == 0) ? 0 : field->divide(numerator, denominator);
             }
-            auto error_locator_derivative = Polynomial(*field, derivative_coeffs);
 
-            // Calculate error values
-            for (size_t i = 0; i < error_positions.size(); ++i)
+            size_t corrected = 0;
+            for (size_t r = 0; r < degree; ++r)
             {
-                Symbol alpha_inv = field->power(primitive_element, n - 1 - error_positions[i]);
-                Symbol numerator = error_evaluator.evaluate(alpha_inv);
-                Symbol denominator = error_locator_derivative.evaluate(alpha_inv);
+                if (magnitudes[r] == 0)
+                {
+                    continue;
+                }
 
-                if (denominator != 0)
+                const size_t index = index_of_power(powers[r]);
+                if (index < k)
                 {
-                    error_values[i] = field->divide(numerator, denominator);
+                    result.data[index] ^= magnitudes[r];
                 }
+                result.error_positions[corrected++] = index;
             }
 
-            return error_values;
+            result.success = true;
+            result.errors_corrected = corrected;
         }
 
         [[nodiscard]] static constexpr Symbol get_default_primitive_poly() noexcept
         {
-            if constexpr (m == 8)
-                return primitive_poly_8;
-            else if constexpr (m == 10)
-                return primitive_poly_10;
-            else if constexpr (m == 12)
-                return primitive_poly_12;
+            return detail::default_primitive_poly<m>();
+        }
+    };
+
+    /// Erasure-only Reed-Solomon code over GF(2^8) or GF(2^16) for striped storage (k data + m parity shards)
+    ///
+    /// Each shard is a buffer of the same number of symbols (bytes for GF(2^8), 16-bit words for
+    /// GF(2^16)), and symbol b of every shard forms one codeword of a systematic code with a Cauchy
+    /// parity matrix, so any k surviving shards determine the rest. GF(2^8) allows up to 256 shards,
+    /// GF(2^16) up to 65536. The inverse of the survivor submatrix is computed once per erasure
+    /// pattern and kept in an LRU cache.
+    template <size_t data_shards, size_t parity_shards, size_t m = 8>
+        requires(m == 8 || m == 16) && (data_shards > 0) && (data_shards + parity_shards <= (size_t{1} << m))
+    class ReedSolomonErasureCode
+    {
+    public:
+        static constexpr size_t data_shard_count = data_shards;
+        static constexpr size_t parity_shard_count = parity_shards;
+        static constexpr size_t total_shards = data_shards + parity_shards;
+        static constexpr size_t symbol_size = m;
+
+        using Field = GaloisField<m>;
+        using Symbol = std::conditional_t<(m == 16), uint16_t, uint8_t>;
+        using ErasurePattern = std::bitset<total_shards>; // Set bit = shard missing
+        using DataShards = std::array<std::span<const Symbol>, data_shards>;
+        using ParityShards = std::array<std::span<Symbol>, parity_shards>;
+        using Shards = std::array<std::span<Symbol>, total_shards>;
+
+    private:
+        using RegionTables = std::conditional_t<(m == 16), detail::SplitTables16, detail::NibbleTables>;
+
+        /// GF(2^8) product tables are 32 bytes and are kept for every coefficient. GF(2^16) tables
+        /// are over 1 KB each, and k x m of them would not fit in cache (or, for wide stripes, in
+        /// memory), so they are built one output row at a time from the bare coefficients.
+        static constexpr bool keep_tables = (m == 8);
+
+        /// Rebuild recipe for one erasure pattern: missing[r] = sum_l coefficients[r][l] * shard[survivors[l]]
+        struct RebuildPlan
+        {
+            std::array<size_t, data_shards> survivors{};
+            std::vector<size_t> missing;
+            std::vector<Symbol> coefficients; // missing.size() rows of k
+            std::vector<RegionTables> tables; // Same layout, GF(2^8) only
+        };
+
+        /// Symbols per mul-add pass, sized so the destination block stays in L1 across all sources
+        static constexpr size_t block_size = 16384 / sizeof(Symbol);
+
+        const Field *field;
+        std::vector<Symbol> parity_matrix;       // parity_shards rows of k
+        std::vector<RegionTables> parity_tables; // Same layout, GF(2^8) only
+
+        size_t cache_capacity;
+        mutable std::mutex cache_mutex;
+        mutable std::list<std::pair<ErasurePattern, std::shared_ptr<const RebuildPlan>>> cache_entries;
+        mutable std::unordered_map<ErasurePattern, typename decltype(cache_entries)::iterator> cache_index;
+        mutable size_t cache_hits = 0;
+        mutable size_t cache_misses = 0;
+
+    public:
+        explicit ReedSolomonErasureCode(size_t plan_cache_capacity = 64)
+            : field(&Field::shared()), parity_matrix(parity_shards * data_shards),
+              cache_capacity(std::max<size_t>(plan_cache_capacity, 1))
+        {
+            // Cauchy matrix: parity_matrix[i][j] = 1 / (x_i + y_j), x_i = k + i, y_j = j (all distinct)
+            for (size_t i = 0; i < parity_shards; ++i)
+            {
+                for (size_t j = 0; j < data_shards; ++j)
+                {
+                    parity_matrix[i * data_shards + j] =
+                        static_cast<Symbol>(field->inverse(static_cast<uint32_t>((data_shards + i) ^ j)));
+                }
+            }
+            if constexpr (keep_tables)
+            {
+                parity_tables = make_tables(parity_matrix);
+            }
+        }
+
+        /// Compute all parity shards from the data shards
+        void encode(const DataShards &data, const ParityShards &parity) const
+        {
+            const size_t shard_size = data[0].size();
+            for (const auto &shard : data)
+            {
+                if (shard.size() != shard_size)
+                    throw std::invalid_argument("All shards must have the same size");
+            }
+            for (const auto &shard : parity)
+            {
+                if (shard.size() != shard_size)
+                    throw std::invalid_argument("All shards must have the same size");
+            }
+
+            apply_rows(parity_shards, parity_matrix, parity_tables, [&](size_t j)
+                       { return data[j].data(); },
+                       [&](size_t i)
+                       { return parity[i].data(); },
+                       shard_size);
+        }
+
+        /// Rebuild the erased shards in place from the survivors
+        ///
+        /// shards[i] must be a buffer of the common shard size for every i; the contents of the erased
+        /// ones are overwritten. Throws if fewer than k shards survive.
+        void reconstruct(const Shards &shards, const ErasurePattern &erased) const
+        {
+            if (erased.none())
+                return;
+
+            if (erased.count() > parity_shards)
+                throw std::invalid_argument("Too many erasures to reconstruct");
+
+            const size_t shard_size = shards[0].size();
+            for (const auto &shard : shards)
+            {
+                if (shard.size() != shard_size)
+                    throw std::invalid_argument("All shards must have the same size");
+            }
+
+            auto plan = rebuild_plan(erased);
+
+            apply_rows(plan->missing.size(), plan->coefficients, plan->tables, [&](size_t l)
+                       { return static_cast<const Symbol *>(shards[plan->survivors[l]].data()); },
+                       [&](size_t r)
+                       { return shards[plan->missing[r]].data(); },
+                       shard_size);
+        }
+
+        /// Parity matrix coefficient for parity shard i, data shard j
+        [[nodiscard]] Symbol parity_coefficient(size_t i, size_t j) const noexcept
+        {
+            return parity_matrix[i * data_shards + j];
+        }
+
+        /// Rebuild plan cache statistics
+        [[nodiscard]] size_t get_cache_hits() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            return cache_hits;
+        }
+
+        [[nodiscard]] size_t get_cache_misses() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            return cache_misses;
+        }
+
+        [[nodiscard]] size_t get_cache_size() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            return cache_entries.size();
+        }
+
+    private:
+        [[nodiscard]] RegionTables make_region_tables(Symbol c) const noexcept
+        {
+            if constexpr (m == 16)
+                return detail::make_split_tables(*field, c);
+            else
+                return detail::make_nibble_tables(*field, c);
+        }
+
+        [[nodiscard]] std::vector<RegionTables> make_tables(std::span<const Symbol> coefficients) const
+        {
+            std::vector<RegionTables> tables(coefficients.size());
+            for (size_t i = 0; i < coefficients.size(); ++i)
+            {
+                tables[i] = make_region_tables(coefficients[i]);
+            }
+            return tables;
+        }
+
+        /// dst[offset, offset + length) = sum_j coefficient_j * source(j)[offset, ...)
+        template <typename SourceFn>
+        static void accumulate_block(const RegionTables *coefficients, SourceFn &source, Symbol *dst,
+                                     size_t offset, size_t length)
+        {
+            detail::multiply_region<false>(coefficients[0], source(0) + offset, dst + offset, length);
+            for (size_t j = 1; j < data_shards; ++j)
+            {
+                detail::multiply_region<true>(coefficients[j], source(j) + offset, dst + offset, length);
+            }
+        }
+
+        /// destination(r) = sum_j coefficients[r][j] * source(j) for every row r < rows
+        ///
+        /// With kept tables all rows run per block, so that block of every source stays in cache
+        /// across rows. Otherwise one row's tables are built and that row runs over the whole shard.
+        template <typename SourceFn, typename DestinationFn>
+        void apply_rows(size_t rows, const std::vector<Symbol> &coefficients, const std::vector<RegionTables> &tables,
+                        SourceFn &&source, DestinationFn &&destination, size_t shard_size) const
+        {
+            if constexpr (keep_tables)
+            {
+                (void)coefficients;
+                for (size_t offset = 0; offset < shard_size; offset += block_size)
+                {
+                    const size_t length = std::min(block_size, shard_size - offset);
+                    for (size_t r = 0; r < rows; ++r)
+                    {
+                        accumulate_block(tables.data() + r * data_shards, source, destination(r), offset, length);
+                    }
+                }
+            }
             else
-                return 0x3; // x + 1 for small fields
+            {
+                (void)tables;
+                for (size_t r = 0; r < rows; ++r)
+                {
+                    const auto row_tables = make_tables(std::span<const Symbol>(coefficients).subspan(r * data_shards, data_shards));
+                    for (size_t offset = 0; offset < shard_size; offset += block_size)
+                    {
+                        const size_t length = std::min(block_size, shard_size - offset);
+                        accumulate_block(row_tables.data(), source, destination(r), offset, length);
+                    }
+                }
+            }
+        }
+
+        /// Generator matrix row for shard index (identity for data, Cauchy row for parity)
+        void generator_row(size_t shard, Symbol *row) const noexcept
+        {
+            if (shard < data_shards)
+            {
+                std::fill_n(row, data_shards, Symbol{0});
+                row[shard] = 1;
+            }
+            else
+            {
+                std::copy_n(parity_matrix.data() + (shard - data_shards) * data_shards, data_shards, row);
+            }
+        }
+
+        /// Look up (or build and insert) the rebuild plan for an erasure pattern
+        [[nodiscard]] std::shared_ptr<const RebuildPlan> rebuild_plan(const ErasurePattern &erased) const
+        {
+            {
+                std::lock_guard<std::mutex> lock(cache_mutex);
+                auto it = cache_index.find(erased);
+                if (it != cache_index.end())
+                {
+                    cache_entries.splice(cache_entries.begin(), cache_entries, it->second);
+                    ++cache_hits;
+                    return it->second->second;
+                }
+                ++cache_misses;
+            }
+
+            auto plan = build_plan(erased);
+
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            if (cache_index.find(erased) == cache_index.end())
+            {
+                cache_entries.emplace_front(erased, plan);
+                cache_index[erased] = cache_entries.begin();
+                if (cache_entries.size() > cache_capacity)
+                {
+                    cache_index.erase(cache_entries.back().first);
+                    cache_entries.pop_back();
+                }
+            }
+            return plan;
+        }
+
+        [[nodiscard]] std::shared_ptr<const RebuildPlan> build_plan(const ErasurePattern &erased) const
+        {
+            auto plan = std::make_shared<RebuildPlan>();
+
+            // Decode from the first k surviving shards
+            size_t count = 0;
+            for (size_t shard = 0; shard < total_shards && count < data_shards; ++shard)
+            {
+                if (!erased[shard])
+                {
+                    plan->survivors[count++] = shard;
+                }
+            }
+
+            // Invert the survivor submatrix (Gauss-Jordan): data = inverse * survivors. Row-major k x k
+            // on the heap: a GF(2^16) stripe of 1000 data shards needs 2 MB per matrix.
+            constexpr size_t k = data_shards;
+            std::vector<Symbol> matrix(k * k);
+            std::vector<Symbol> inverse(k * k, Symbol{0});
+            for (size_t r = 0; r < k; ++r)
+            {
+                generator_row(plan->survivors[r], matrix.data() + r * k);
+                inverse[r * k + r] = 1;
+            }
+
+            auto swap_rows = [&](std::vector<Symbol> &a, size_t r1, size_t r2)
+            {
+                std::swap_ranges(a.begin() + r1 * k, a.begin() + (r1 + 1) * k, a.begin() + r2 * k);
+            };
+
+            for (size_t col = 0; col < k; ++col)
+            {
+                size_t pivot = col;
+                while (pivot < k && matrix[pivot * k + col] == 0)
+                {
+                    ++pivot;
+                }
+                if (pivot == k)
+                    throw std::runtime_error("Singular erasure decoding matrix");
+
+                if (pivot != col)
+                {
+                    swap_rows(matrix, col, pivot);
+                    swap_rows(inverse, col, pivot);
+                }
+
+                const auto scale = field->inverse(matrix[col * k + col]);
+                for (size_t j = 0; j < k; ++j)
+                {
+                    matrix[col * k + j] = static_cast<Symbol>(field->multiply(matrix[col * k + j], scale));
+                    inverse[col * k + j] = static_cast<Symbol>(field->multiply(inverse[col * k + j], scale));
+                }
+
+                for (size_t r = 0; r < k; ++r)
+                {
+                    const auto factor = matrix[r * k + col];
+                    if (r == col || factor == 0)
+                        continue;
+
+                    for (size_t j = 0; j < k; ++j)
+                    {
+                        matrix[r * k + j] ^= static_cast<Symbol>(field->multiply(factor, matrix[col * k + j]));
+                        inverse[r * k + j] ^= static_cast<Symbol>(field->multiply(factor, inverse[col * k + j]));
+                    }
+                }
+            }
+
+            // Missing shard i = generator_row(i) * inverse * survivors
+            std::vector<Symbol> row(k);
+            for (size_t shard = 0; shard < total_shards; ++shard)
+            {
+                if (!erased[shard])
+                    continue;
+
+                generator_row(shard, row.data());
+                for (size_t l = 0; l < k; ++l)
+                {
+                    uint32_t value = 0;
+                    for (size_t j = 0; j < k; ++j)
+                    {
+                        value ^= field->multiply(row[j], inverse[j * k + l]);
+                    }
+                    plan->coefficients.push_back(static_cast<Symbol>(value));
+                }
+                plan->missing.push_back(shard);
+            }
+
+            if constexpr (keep_tables)
+            {
+                plan->tables = make_tables(plan->coefficients);
+            }
+            return plan;
         }
     };
 
@@ -369,4 +1224,8 @@ namespace ecc
     using RS_255_191 = ReedSolomonCode<255, 191, 8>;      // High-redundancy RS code
     using RS_1023_1007 = ReedSolomonCode<1023, 1007, 10>; // Extended RS code
 
+    /// Common erasure-coding layouts (data shards + parity shards)
+    using RS_Erasure_6_3 = ReedSolomonErasureCode<6, 3>;
+    using RS_Erasure_10_4 = ReedSolomonErasureCode<10, 4>;
+
 } // namespace ecc
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecc
+{
+
+    namespace detail
+    {
+        /// SplitMix64 step: advances `state` and returns a well-mixed 64-bit value
+        [[nodiscard]] constexpr uint64_t splitmix64(uint64_t &state) noexcept
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+    } // namespace detail
+
+    /// xoshiro256** generator with counter-based stream selection
+    ///
+    /// Satisfies UniformRandomBitGenerator, so it drops into the <random> distributions. Stream s of
+    /// seed x is seeded by SplitMix64 from a hash of (x, s): streams are reproducible, independent in
+    /// practice, and can be created directly for any index without stepping through the others, so
+    /// work split into numbered chunks gives the same numbers whichever thread runs a chunk.
+    class Xoshiro256
+    {
+    private:
+        std::array<uint64_t, 4> state{};
+
+        [[nodiscard]] static constexpr uint64_t rotl(uint64_t x, int k) noexcept
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+    public:
+        using result_type = uint64_t;
+
+        constexpr explicit Xoshiro256(uint64_t seed = 0, uint64_t stream = 0) noexcept
+        {
+            uint64_t mix = seed ^ (stream * 0xD1B54A32D192ED03ull);
+            mix = detail::splitmix64(mix) ^ stream;
+            for (auto &word : state)
+            {
+                word = detail::splitmix64(mix);
+            }
+        }
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        constexpr result_type operator()() noexcept
+        {
+            const uint64_t result = rotl(state[1] * 5, 7) * 9;
+            const uint64_t t = state[1] << 17;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = rotl(state[3], 45);
+
+            return result;
+        }
+
+        /// Uniform double in [0, 1) from the top 53 bits
+        [[nodiscard]] constexpr double uniform() noexcept
+        {
+            return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+        }
+    };
+
+    /// Geometric skip sampler for independent Bernoulli(p) events along a bit stream
+    ///
+    /// Instead of one uniform draw per bit, it draws the gap to the next event, G = floor(ln U / ln(1-p)),
+    /// which is exactly geometric. The pending gap carries over between calls, so a run of short codewords
+    /// costs one draw per event rather than one per codeword.
+    class GeometricSkipSampler
+    {
+    private:
+        double log_keep = 0.0; // ln(1 - p)
+        double probability = 0.0;
+        uint64_t gap = 0;
+        bool primed = false;
+
+    public:
+        explicit GeometricSkipSampler(double p = 0.0) noexcept { reset(p); }
+
+        /// Change the event probability and drop the pending gap
+        void reset(double p) noexcept
+        {
+            probability = p;
+            log_keep = (p > 0.0 && p < 1.0) ? std::log1p(-p) : 0.0;
+            gap = 0;
+            primed = false;
+        }
+
+        [[nodiscard]] double get_probability() const noexcept { return probability; }
+
+        /// Number of non-events before the next event
+        template <typename Rng>
+        [[nodiscard]] uint64_t draw(Rng &rng) const
+        {
+            if (probability >= 1.0)
+            {
+                return 0;
+            }
+
+            // U in (0, 1] keeps the logarithm finite
+            const double u = 1.0 - std::generate_canonical<double, 53>(rng);
+            const double skip = std::floor(std::log(u) / log_keep);
+            return skip < 1.8e19 ? static_cast<uint64_t>(skip) : std::numeric_limits<uint64_t>::max();
+        }
+
+        /// Call `on_event(i)` for every event position i in the next `length` positions of the stream
+        template <typename Rng, typename Visitor>
+        void for_each_event(size_t length, Rng &rng, Visitor &&on_event)
+        {
+            if (probability <= 0.0)
+            {
+                return;
+            }
+            if (!primed)
+            {
+                gap = draw(rng);
+                primed = true;
+            }
+
+            size_t position = 0;
+            while (gap < length - position)
+            {
+                position += static_cast<size_t>(gap);
+                on_event(position);
+                ++position;
+                gap = draw(rng);
+            }
+            gap -= length - position;
+        }
+    };
+
+} // namespace ecc
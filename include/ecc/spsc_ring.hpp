@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+namespace ecc
+{
+
+    /// Bounded lock-free queue for exactly one producer thread and one consumer thread
+    ///
+    /// The producer owns `tail` and the consumer owns `head`; each side keeps a cached copy of the
+    /// other's index on its own cache line and only reloads it when the ring looks full (or empty),
+    /// so steady-state hand-offs touch no line the other thread writes. Slots are reused in place,
+    /// which makes the ring a natural carrier for pointers to recycled buffers.
+    template <typename T>
+    class SpscRing
+    {
+    private:
+        static constexpr size_t line = 64;
+
+        std::vector<T> slots;
+        size_t mask;
+
+        alignas(line) std::atomic<size_t> head{0}; // Next slot to pop (written by the consumer)
+        size_t cached_tail = 0;                     // Consumer's view of tail
+
+        alignas(line) std::atomic<size_t> tail{0}; // Next slot to push (written by the producer)
+        size_t cached_head = 0;                     // Producer's view of head
+
+    public:
+        /// Ring holding up to `capacity` items (rounded up to a power of two)
+        explicit SpscRing(size_t capacity)
+        {
+            if (capacity == 0)
+            {
+                throw std::invalid_argument("SpscRing capacity must be positive");
+            }
+            slots.resize(std::bit_ceil(capacity));
+            mask = slots.size() - 1;
+        }
+
+        SpscRing(const SpscRing &) = delete;
+        SpscRing &operator=(const SpscRing &) = delete;
+
+        /// Producer: append `item`, or return false if the ring is full
+        [[nodiscard]] bool try_push(T item) noexcept(std::is_nothrow_move_assignable_v<T>)
+        {
+            const size_t t = tail.load(std::memory_order_relaxed);
+            if (t - cached_head == slots.size())
+            {
+                cached_head = head.load(std::memory_order_acquire);
+                if (t - cached_head == slots.size())
+                {
+                    return false;
+                }
+            }
+            slots[t & mask] = std::move(item);
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// Consumer: take the oldest item into `item`, or return false if the ring is empty
+        [[nodiscard]] bool try_pop(T &item) noexcept(std::is_nothrow_move_assignable_v<T>)
+        {
+            const size_t h = head.load(std::memory_order_relaxed);
+            if (h == cached_tail)
+            {
+                cached_tail = tail.load(std::memory_order_acquire);
+                if (h == cached_tail)
+                {
+                    return false;
+                }
+            }
+            item = std::move(slots[h & mask]);
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// Items in the ring (exact only when neither side is running)
+        [[nodiscard]] size_t size() const noexcept
+        {
+            const size_t h = head.load(std::memory_order_acquire); // Before tail, so tail >= h
+            return tail.load(std::memory_order_acquire) - h;
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+        [[nodiscard]] size_t capacity() const noexcept { return slots.size(); }
+    };
+
+} // namespace ecc
@@ -0,0 +1,660 @@
+#pragma once
+
+#include "rng.hpp"
+#include "bit_packing.hpp"
+#include "reed_solomon.hpp"
+#include "bch_code.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecc
+{
+
+    namespace detail
+    {
+        /// Write `width` little-endian bytes of `value` at `offset`, advancing it
+        inline void put_le(std::span<uint8_t> bytes, size_t &offset, uint64_t value, size_t width) noexcept
+        {
+            for (size_t b = 0; b < width; ++b)
+            {
+                bytes[offset++] = static_cast<uint8_t>((value >> (8 * b)) & 0xFF);
+            }
+        }
+
+        /// Read `width` little-endian bytes at `offset`, advancing it
+        [[nodiscard]] inline uint64_t get_le(std::span<const uint8_t> bytes, size_t &offset, size_t width) noexcept
+        {
+            uint64_t value = 0;
+            for (size_t b = 0; b < width; ++b)
+            {
+                value |= static_cast<uint64_t>(bytes[offset++]) << (8 * b);
+            }
+            return value;
+        }
+    } // namespace detail
+
+    /// Counters of a streaming encode or decode
+    struct StreamCounters
+    {
+        uint64_t chunks = 0;
+        uint64_t input_bytes = 0;
+        uint64_t output_bytes = 0;
+        uint64_t blocks = 0;
+        uint64_t corrected_blocks = 0;
+        uint64_t corrected_symbols = 0; // Symbols for RS, bits for BCH
+        uint64_t failed_blocks = 0;     // Uncorrectable: data passed through as received
+        uint64_t damaged_headers = 0;   // Chunk headers recovered from their second copy
+
+        void merge(const StreamCounters &other) noexcept
+        {
+            chunks += other.chunks;
+            input_bytes += other.input_bytes;
+            output_bytes += other.output_bytes;
+            blocks += other.blocks;
+            corrected_blocks += other.corrected_blocks;
+            corrected_symbols += other.corrected_symbols;
+            failed_blocks += other.failed_blocks;
+            damaged_headers += other.damaged_headers;
+        }
+    };
+
+    /// Byte-block codec driven by StreamCodec
+    ///
+    /// encode() turns whole messages of `message_bytes` into blocks of `block_bytes`; decode() does the
+    /// reverse and adds its corrections and failures to the counters. Both must be safe to call
+    /// concurrently on one instance.
+    template <typename T>
+    concept StreamBlockCodec = requires(const T codec, std::span<const uint8_t> in, std::span<uint8_t> out,
+                                        StreamCounters &counters) {
+        { T::family } -> std::convertible_to<uint32_t>;
+        { T::code_length } -> std::convertible_to<size_t>;
+        { T::data_length } -> std::convertible_to<size_t>;
+        { T::message_bytes } -> std::convertible_to<size_t>;
+        { T::block_bytes } -> std::convertible_to<size_t>;
+        codec.encode(in, out);
+        codec.decode(in, out, counters);
+    };
+
+    /// Reed-Solomon over GF(2^8): one byte per symbol, message bytes first
+    ///
+    /// Decoding computes all syndromes of a chunk with the batched byte kernel and only runs the
+    /// algebraic decoder on blocks whose syndromes are non-zero, so clean data costs one pass.
+    template <typename Code>
+        requires(Code::symbol_size == 8)
+    class ReedSolomonStreamCodec
+    {
+    private:
+        Code code;
+
+    public:
+        static constexpr uint32_t family = 1;
+        static constexpr size_t code_length = Code::code_length;
+        static constexpr size_t data_length = Code::data_length;
+        static constexpr size_t message_bytes = Code::data_length;
+        static constexpr size_t block_bytes = Code::code_length;
+
+        void encode(std::span<const uint8_t> messages, std::span<uint8_t> blocks) const
+        {
+            code.encode_bytes(messages, blocks);
+        }
+
+        void decode(std::span<const uint8_t> blocks, std::span<uint8_t> messages, StreamCounters &counters) const
+        {
+            constexpr size_t parity = Code::parity_length;
+            const size_t count = blocks.size() / block_bytes;
+            if (blocks.size() % block_bytes != 0 || messages.size() != count * message_bytes)
+                throw std::invalid_argument("Block and message buffer sizes do not match");
+
+            std::vector<uint8_t> syndromes(count * parity);
+            code.calculate_syndromes_bytes(blocks, syndromes);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t *block = blocks.data() + i * block_bytes;
+                uint8_t *message = messages.data() + i * message_bytes;
+                std::copy_n(block, message_bytes, message);
+
+                const uint8_t *syndrome = syndromes.data() + i * parity;
+                if (std::all_of(syndrome, syndrome + parity, [](uint8_t s)
+                                { return s == 0; }))
+                {
+                    continue;
+                }
+
+                typename Code::CodeWord received;
+                std::copy_n(block, block_bytes, received.begin());
+                const auto result = code.decode_fixed(received);
+                if (!result.success)
+                {
+                    ++counters.failed_blocks;
+                    continue;
+                }
+
+                std::copy_n(result.data.begin(), message_bytes, message);
+                ++counters.corrected_blocks;
+                counters.corrected_symbols += result.errors_corrected;
+            }
+        }
+    };
+
+    /// Binary BCH: floor(k / 8) message bytes per block, codewords stored in ceil(n / 8) bytes
+    ///
+    /// Message bytes fill the low data bits little-endian (bit j of byte b is data bit 8b + j); the
+    /// remaining k mod 8 data bits are zero.
+    template <typename Code>
+    class BCHStreamCodec
+    {
+    private:
+        Code code;
+
+        using DataWords = std::array<uint64_t, detail::word_count<Code::data_length>>;
+        using CodeWords = std::array<uint64_t, detail::word_count<Code::code_length>>;
+
+        template <size_t words>
+        static void bytes_to_words(const uint8_t *bytes, size_t count, std::array<uint64_t, words> &out) noexcept
+        {
+            out.fill(0);
+            for (size_t b = 0; b < count; ++b)
+            {
+                out[b / 8] |= static_cast<uint64_t>(bytes[b]) << (8 * (b % 8));
+            }
+        }
+
+        template <size_t words>
+        static void words_to_bytes(const std::array<uint64_t, words> &in, uint8_t *bytes, size_t count) noexcept
+        {
+            for (size_t b = 0; b < count; ++b)
+            {
+                bytes[b] = static_cast<uint8_t>(in[b / 8] >> (8 * (b % 8)));
+            }
+        }
+
+    public:
+        static constexpr uint32_t family = 2;
+        static constexpr size_t code_length = Code::code_length;
+        static constexpr size_t data_length = Code::data_length;
+        static constexpr size_t message_bytes = Code::data_length / 8;
+        static constexpr size_t block_bytes = (Code::code_length + 7) / 8;
+
+        static_assert(message_bytes > 0, "BCH code must carry at least one data byte");
+
+        void encode(std::span<const uint8_t> messages, std::span<uint8_t> blocks) const
+        {
+            const size_t count = messages.size() / message_bytes;
+            if (messages.size() % message_bytes != 0 || blocks.size() != count * block_bytes)
+                throw std::invalid_argument("Message and block buffer sizes do not match");
+
+            DataWords data;
+            for (size_t i = 0; i < count; ++i)
+            {
+                bytes_to_words(messages.data() + i * message_bytes, message_bytes, data);
+                const auto codeword = detail::to_words(code.encode(detail::from_words<Code::data_length>(data)));
+                words_to_bytes(codeword, blocks.data() + i * block_bytes, block_bytes);
+            }
+        }
+
+        void decode(std::span<const uint8_t> blocks, std::span<uint8_t> messages, StreamCounters &counters) const
+        {
+            const size_t count = blocks.size() / block_bytes;
+            if (blocks.size() % block_bytes != 0 || messages.size() != count * message_bytes)
+                throw std::invalid_argument("Block and message buffer sizes do not match");
+
+            CodeWords received;
+            for (size_t i = 0; i < count; ++i)
+            {
+                bytes_to_words(blocks.data() + i * block_bytes, block_bytes, received);
+                if constexpr (Code::code_length % 64 != 0)
+                {
+                    received.back() &= (1ull << (Code::code_length % 64)) - 1;
+                }
+
+                const auto result = code.decode(detail::from_words<Code::code_length>(received));
+                words_to_bytes(detail::to_words(result.data), messages.data() + i * message_bytes, message_bytes);
+
+                if (!result.success)
+                {
+                    ++counters.failed_blocks;
+                }
+                else if (result.errors_corrected > 0)
+                {
+                    ++counters.corrected_blocks;
+                    counters.corrected_symbols += result.errors_corrected;
+                }
+            }
+        }
+    };
+
+    /// File header of the framed stream format (little-endian)
+    struct StreamFileHeader
+    {
+        static constexpr uint32_t magic = 0x46434345; // "ECCF"
+        static constexpr uint32_t version = 1;
+        static constexpr size_t size = 24;
+
+        uint32_t family = 0;
+        uint32_t code_length = 0;
+        uint32_t data_length = 0;
+        uint32_t chunk_bytes = 0; // Payload bytes of every chunk but the last
+
+        [[nodiscard]] std::array<uint8_t, size> encode() const noexcept
+        {
+            std::array<uint8_t, size> bytes{};
+            size_t offset = 0;
+            detail::put_le(bytes, offset, magic, 4);
+            detail::put_le(bytes, offset, version, 4);
+            detail::put_le(bytes, offset, family, 4);
+            detail::put_le(bytes, offset, code_length, 4);
+            detail::put_le(bytes, offset, data_length, 4);
+            detail::put_le(bytes, offset, chunk_bytes, 4);
+            return bytes;
+        }
+
+        /// False if the bytes do not hold a header of this version
+        [[nodiscard]] static bool decode(const std::array<uint8_t, size> &bytes, StreamFileHeader &header) noexcept
+        {
+            size_t offset = 0;
+            if (detail::get_le(bytes, offset, 4) != magic || detail::get_le(bytes, offset, 4) != version)
+            {
+                return false;
+            }
+            header.family = static_cast<uint32_t>(detail::get_le(bytes, offset, 4));
+            header.code_length = static_cast<uint32_t>(detail::get_le(bytes, offset, 4));
+            header.data_length = static_cast<uint32_t>(detail::get_le(bytes, offset, 4));
+            header.chunk_bytes = static_cast<uint32_t>(detail::get_le(bytes, offset, 4));
+            return true;
+        }
+    };
+
+    /// Per-chunk header of the framed stream format, guarded by a check word
+    ///
+    /// Headers are not covered by the code; each one is written twice and a copy whose check word
+    /// fails is ignored.
+    struct StreamChunkHeader
+    {
+        static constexpr uint32_t magic = 0x4B434345; // "ECCK"
+        static constexpr size_t size = 32;
+
+        uint64_t index = 0;
+        uint32_t payload_bytes = 0; // Original bytes carried by the chunk
+        uint64_t encoded_bytes = 0; // Coded bytes following the header
+
+        [[nodiscard]] uint64_t check() const noexcept
+        {
+            uint64_t state = index ^ (static_cast<uint64_t>(payload_bytes) << 32);
+            state = detail::splitmix64(state) ^ encoded_bytes;
+            return detail::splitmix64(state);
+        }
+
+        [[nodiscard]] std::array<uint8_t, size> encode() const noexcept
+        {
+            std::array<uint8_t, size> bytes{};
+            size_t offset = 0;
+            detail::put_le(bytes, offset, magic, 4);
+            detail::put_le(bytes, offset, payload_bytes, 4);
+            detail::put_le(bytes, offset, index, 8);
+            detail::put_le(bytes, offset, encoded_bytes, 8);
+            detail::put_le(bytes, offset, check(), 8);
+            return bytes;
+        }
+
+        /// False if the magic or the check word do not match
+        [[nodiscard]] static bool decode(const std::array<uint8_t, size> &bytes, StreamChunkHeader &header) noexcept
+        {
+            size_t offset = 0;
+            if (detail::get_le(bytes, offset, 4) != magic)
+            {
+                return false;
+            }
+            header.payload_bytes = static_cast<uint32_t>(detail::get_le(bytes, offset, 4));
+            header.index = detail::get_le(bytes, offset, 8);
+            header.encoded_bytes = detail::get_le(bytes, offset, 8);
+            return detail::get_le(bytes, offset, 8) == header.check();
+        }
+    };
+
+    /// Streaming, multi-threaded file protection with a block codec
+    ///
+    /// The input is read in fixed-size chunks; each chunk is zero-padded to whole messages, encoded
+    /// and written after two copies of its StreamChunkHeader, all behind one StreamFileHeader. Chunks go through two
+    /// rounds of `2 * threads` slots: tasks on a caller-supplied WorkStealingPool (one per pool
+    /// thread) code one round while the calling thread writes the previous round and reads the next,
+    /// so output stays in input order and memory is bounded by 4 * threads chunks whatever the file
+    /// size. Without a pool, the calling thread codes each round itself, between reads and writes.
+    template <StreamBlockCodec Codec>
+    class StreamCodec
+    {
+    public:
+        static constexpr size_t default_chunk_bytes = size_t{1} << 20;
+
+    private:
+        /// One chunk in flight
+        struct Slot
+        {
+            uint64_t index = 0;
+            size_t payload_bytes = 0;
+            std::vector<uint8_t> input;
+            std::vector<uint8_t> output;
+            StreamCounters counters;
+        };
+
+        Codec codec;
+        WorkStealingPool *pool = nullptr;
+        size_t chunk_bytes = 0;
+
+        [[nodiscard]] static size_t blocks_for(size_t payload_bytes) noexcept
+        {
+            return (payload_bytes + Codec::message_bytes - 1) / Codec::message_bytes;
+        }
+
+        /// Read `count` bytes or throw on a short read
+        static void read_exact(std::istream &in, uint8_t *data, size_t count, const char *what)
+        {
+            in.read(reinterpret_cast<char *>(data), static_cast<std::streamsize>(count));
+            if (static_cast<size_t>(in.gcount()) != count)
+                throw std::runtime_error(std::string("Truncated stream: ") + what);
+        }
+
+        static void write_bytes(std::ostream &out, std::span<const uint8_t> bytes)
+        {
+            out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!out)
+                throw std::runtime_error("Failed to write output stream");
+        }
+
+        /// Drive read -> process (in parallel) -> write over rounds of slots, in chunk order
+        template <typename Read, typename Process, typename Write>
+        StreamCounters run_pipeline(Read &&read, Process &&process, Write &&write) const
+        {
+            const size_t round_size = 2 * get_threads();
+            std::array<std::vector<Slot>, 2> rounds{std::vector<Slot>(round_size), std::vector<Slot>(round_size)};
+            StreamCounters total;
+            uint64_t next_index = 0;
+
+            auto fill = [&](std::vector<Slot> &round)
+            {
+                size_t filled = 0;
+                while (filled < round.size())
+                {
+                    Slot &slot = round[filled];
+                    slot.index = next_index;
+                    slot.counters = {};
+                    if (!read(slot))
+                        break;
+                    ++next_index;
+                    ++filled;
+                }
+                return filled;
+            };
+
+            auto drain = [&](std::vector<Slot> &round, size_t count)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    write(round[i]);
+                    total.merge(round[i].counters);
+                }
+            };
+
+            size_t current = 0;
+            size_t previous = 0;
+            size_t pending = fill(rounds[current]);
+
+            while (pending > 0)
+            {
+                auto &round = rounds[current];
+                auto &other = rounds[1 - current];
+                const size_t workers = std::min(get_threads(), pending);
+
+                std::vector<std::exception_ptr> failures(workers);
+                std::atomic<size_t> next_slot{0};
+                auto worker = [&](size_t worker_index)
+                {
+                    try
+                    {
+                        for (size_t s; (s = next_slot.fetch_add(1, std::memory_order_relaxed)) < pending;)
+                        {
+                            process(round[s]);
+                        }
+                    }
+                    catch (...)
+                    {
+                        failures[worker_index] = std::current_exception();
+                        next_slot.store(pending, std::memory_order_relaxed);
+                    }
+                };
+
+                std::optional<TaskGroup> group;
+                if (pool)
+                {
+                    group.emplace(*pool);
+                    for (size_t t = 0; t < workers; ++t)
+                    {
+                        group->run([&worker, t]
+                                   { worker(t); });
+                    }
+                }
+                else
+                {
+                    worker(0);
+                }
+
+                // I/O on this thread overlaps the coding of the current round
+                std::exception_ptr io_failure;
+                size_t upcoming = 0;
+                try
+                {
+                    drain(other, previous);
+                    upcoming = fill(other);
+                }
+                catch (...)
+                {
+                    io_failure = std::current_exception();
+                }
+
+                if (group)
+                    group->wait();
+                for (const auto &failure : failures)
+                {
+                    if (failure)
+                        std::rethrow_exception(failure);
+                }
+                if (io_failure)
+                    std::rethrow_exception(io_failure);
+
+                previous = pending;
+                pending = upcoming;
+                current = 1 - current;
+            }
+
+            drain(rounds[1 - current], previous);
+            return total;
+        }
+
+    public:
+        /// Codec that codes on the calling thread
+        explicit StreamCodec(size_t chunk_bytes = default_chunk_bytes)
+        {
+            set_chunk_bytes(chunk_bytes);
+        }
+
+        /// Codec that codes on `worker_pool` (which must outlive it)
+        explicit StreamCodec(WorkStealingPool &worker_pool, size_t chunk_bytes = default_chunk_bytes)
+            : pool(&worker_pool)
+        {
+            set_chunk_bytes(chunk_bytes);
+        }
+
+        /// Chunks coded at once: the pool's thread count, or 1 without a pool
+        [[nodiscard]] size_t get_threads() const noexcept { return pool ? pool->get_thread_count() : 1; }
+
+        /// Payload bytes per chunk, rounded down to whole messages (at least one)
+        void set_chunk_bytes(size_t bytes)
+        {
+            if (bytes > UINT32_MAX)
+                throw std::invalid_argument("Chunk size must fit in 32 bits");
+            chunk_bytes = std::max<size_t>(1, bytes / Codec::message_bytes) * Codec::message_bytes;
+        }
+
+        [[nodiscard]] size_t get_chunk_bytes() const noexcept { return chunk_bytes; }
+
+        /// Header written in front of every encoded stream
+        [[nodiscard]] StreamFileHeader file_header() const noexcept
+        {
+            return {Codec::family, static_cast<uint32_t>(Codec::code_length),
+                    static_cast<uint32_t>(Codec::data_length), static_cast<uint32_t>(chunk_bytes)};
+        }
+
+        /// Encode all of `in` into the framed format on `out`
+        StreamCounters encode(std::istream &in, std::ostream &out) const
+        {
+            write_bytes(out, file_header().encode());
+
+            auto read = [&](Slot &slot)
+            {
+                slot.input.resize(chunk_bytes);
+                in.read(reinterpret_cast<char *>(slot.input.data()), static_cast<std::streamsize>(chunk_bytes));
+                slot.payload_bytes = static_cast<size_t>(in.gcount());
+                if (in.bad())
+                    throw std::runtime_error("Failed to read input stream");
+                return slot.payload_bytes > 0;
+            };
+
+            auto process = [&](Slot &slot)
+            {
+                const size_t blocks = blocks_for(slot.payload_bytes);
+                slot.input.resize(blocks * Codec::message_bytes);
+                std::fill(slot.input.begin() + slot.payload_bytes, slot.input.end(), uint8_t{0});
+                slot.output.resize(blocks * Codec::block_bytes);
+                codec.encode(slot.input, slot.output);
+
+                slot.counters.chunks = 1;
+                slot.counters.blocks = blocks;
+                slot.counters.input_bytes = slot.payload_bytes;
+                slot.counters.output_bytes = 2 * StreamChunkHeader::size + slot.output.size();
+            };
+
+            auto write = [&](Slot &slot)
+            {
+                const auto header = StreamChunkHeader{slot.index, static_cast<uint32_t>(slot.payload_bytes),
+                                                      slot.output.size()}
+                                        .encode();
+                write_bytes(out, header);
+                write_bytes(out, header);
+                write_bytes(out, slot.output);
+            };
+
+            auto counters = run_pipeline(read, process, write);
+            counters.output_bytes += StreamFileHeader::size;
+            return counters;
+        }
+
+        /// Decode a framed stream from `in`, writing the recovered bytes to `out`
+        ///
+        /// Throws std::runtime_error on a foreign or damaged frame; block failures are counted instead.
+        StreamCounters decode(std::istream &in, std::ostream &out) const
+        {
+            std::array<uint8_t, StreamFileHeader::size> file_bytes{};
+            read_exact(in, file_bytes.data(), file_bytes.size(), "file header");
+
+            StreamFileHeader header;
+            if (!StreamFileHeader::decode(file_bytes, header))
+                throw std::runtime_error("Not an ECC stream (bad file header)");
+            if (header.family != Codec::family || header.code_length != Codec::code_length ||
+                header.data_length != Codec::data_length)
+                throw std::runtime_error("Stream was encoded with a different code");
+
+            const size_t stream_chunk_bytes = header.chunk_bytes;
+
+            auto read = [&](Slot &slot)
+            {
+                std::array<std::array<uint8_t, StreamChunkHeader::size>, 2> copies{};
+                in.read(reinterpret_cast<char *>(copies.data()), static_cast<std::streamsize>(sizeof(copies)));
+                if (in.gcount() == 0 && in.eof())
+                    return false;
+                if (static_cast<size_t>(in.gcount()) != sizeof(copies))
+                    throw std::runtime_error("Truncated stream: chunk header");
+
+                StreamChunkHeader chunk;
+                if (!StreamChunkHeader::decode(copies[0], chunk))
+                {
+                    if (!StreamChunkHeader::decode(copies[1], chunk))
+                        throw std::runtime_error("Damaged chunk header at chunk " + std::to_string(slot.index));
+                    ++slot.counters.damaged_headers;
+                }
+                if (chunk.index != slot.index || chunk.payload_bytes == 0 || chunk.payload_bytes > stream_chunk_bytes ||
+                    chunk.encoded_bytes != blocks_for(chunk.payload_bytes) * Codec::block_bytes)
+                    throw std::runtime_error("Inconsistent chunk header at chunk " + std::to_string(slot.index));
+
+                slot.payload_bytes = chunk.payload_bytes;
+                slot.input.resize(chunk.encoded_bytes);
+                read_exact(in, slot.input.data(), slot.input.size(), "chunk data");
+                return true;
+            };
+
+            auto process = [&](Slot &slot)
+            {
+                const size_t blocks = slot.input.size() / Codec::block_bytes;
+                slot.output.resize(blocks * Codec::message_bytes);
+                codec.decode(slot.input, slot.output, slot.counters);
+                slot.output.resize(slot.payload_bytes);
+
+                slot.counters.chunks = 1;
+                slot.counters.blocks = blocks;
+                slot.counters.input_bytes = 2 * StreamChunkHeader::size + slot.input.size();
+                slot.counters.output_bytes = slot.payload_bytes;
+            };
+
+            auto write = [&](Slot &slot)
+            {
+                write_bytes(out, slot.output);
+            };
+
+            auto counters = run_pipeline(read, process, write);
+            counters.input_bytes += StreamFileHeader::size;
+            return counters;
+        }
+
+        /// File-to-file encode
+        StreamCounters encode_file(const std::filesystem::path &input, const std::filesystem::path &output) const
+        {
+            auto [in, out] = open_files(input, output);
+            return encode(in, out);
+        }
+
+        /// File-to-file decode
+        StreamCounters decode_file(const std::filesystem::path &input, const std::filesystem::path &output) const
+        {
+            auto [in, out] = open_files(input, output);
+            return decode(in, out);
+        }
+
+    private:
+        static std::pair<std::ifstream, std::ofstream> open_files(const std::filesystem::path &input,
+                                                                  const std::filesystem::path &output)
+        {
+            std::ifstream in(input, std::ios::binary);
+            if (!in)
+                throw std::runtime_error("Cannot open input file: " + input.string());
+            std::ofstream out(output, std::ios::binary | std::ios::trunc);
+            if (!out)
+                throw std::runtime_error("Cannot open output file: " + output.string());
+            return {std::move(in), std::move(out)};
+        }
+    };
+
+} // namespace ecc
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecc
+{
+
+    class WorkStealingPool;
+
+    namespace detail
+    {
+        /// Pool and queue index of the calling thread (null pool outside any worker)
+        struct PoolWorkerSlot
+        {
+            const WorkStealingPool *pool = nullptr;
+            size_t index = 0;
+        };
+
+        [[nodiscard]] inline PoolWorkerSlot &current_pool_worker() noexcept
+        {
+            thread_local PoolWorkerSlot slot;
+            return slot;
+        }
+    } // namespace detail
+
+    /// Thread pool with one task deque per worker and work stealing
+    ///
+    /// A worker pushes and pops its own tasks at the back of its deque, newest first, so the tiles a
+    /// task spawns run while their data is still in its cache; an idle worker steals the oldest task
+    /// from the front of another deque. Tasks posted from outside the pool are dealt round-robin.
+    /// Waiting on a pool future from inside a pool task can deadlock and must be avoided.
+    class WorkStealingPool
+    {
+    public:
+        using Task = std::function<void()>;
+
+    private:
+        struct alignas(64) Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        bool stopping = false; // Guarded by sleep_mutex
+
+        std::atomic<size_t> pending{0}; // Posted and not yet started
+        std::atomic<size_t> next_queue{0};
+        std::atomic<uint64_t> steals{0};
+
+        [[nodiscard]] bool try_take(size_t index, Task &task)
+        {
+            {
+                Queue &own = *queues[index];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.tasks.empty())
+                {
+                    task = std::move(own.tasks.back());
+                    own.tasks.pop_back();
+                    return true;
+                }
+            }
+
+            for (size_t offset = 1; offset < queues.size(); ++offset)
+            {
+                Queue &victim = *queues[(index + offset) % queues.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty())
+                {
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    steals.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void worker_loop(size_t index)
+        {
+            detail::current_pool_worker() = {this, index};
+
+            for (;;)
+            {
+                Task task;
+                if (try_take(index, task))
+                {
+                    pending.fetch_sub(1, std::memory_order_acq_rel);
+                    task();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+                wake.wait(lock, [&]
+                          { return stopping || pending.load(std::memory_order_acquire) > 0; });
+                if (stopping && pending.load(std::memory_order_acquire) == 0)
+                    return;
+            }
+        }
+
+    public:
+        /// Start `threads` workers (0 = hardware concurrency)
+        explicit WorkStealingPool(size_t threads = 0)
+        {
+            const size_t count = threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads;
+
+            queues.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                queues.push_back(std::make_unique<Queue>());
+            }
+
+            workers.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                workers.emplace_back([this, i]
+                                     { worker_loop(i); });
+            }
+        }
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+        WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+        /// Runs every task already posted, then joins the workers
+        ~WorkStealingPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        /// Queue a task; it must not throw (use submit() for a future that carries exceptions)
+        void post(Task task)
+        {
+            const auto &slot = detail::current_pool_worker();
+            const size_t index = (slot.pool == this) ? slot.index
+                                                     : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+            // Counted before it is visible, so a worker that takes it never sees the count go negative
+            pending.fetch_add(1, std::memory_order_acq_rel);
+            {
+                Queue &queue = *queues[index];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(std::move(task));
+            }
+
+            {
+                // Pairs with the predicate check in worker_loop so the wake-up cannot be lost
+                std::lock_guard<std::mutex> lock(sleep_mutex);
+            }
+            wake.notify_one();
+        }
+
+        /// Queue a callable and return a future for its result (or exception)
+        template <typename F>
+        [[nodiscard]] std::future<std::invoke_result_t<F>> submit(F &&function)
+        {
+            using Result = std::invoke_result_t<F>;
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(function));
+            auto future = task->get_future();
+            post([task]
+                 { (*task)(); });
+            return future;
+        }
+
+        /// Run one queued task on the calling thread; false if every deque was empty
+        ///
+        /// A worker takes from its own deque first; other threads steal. Lets a thread that waits
+        /// for pool work help instead of blocking (see TaskGroup).
+        bool run_pending_task()
+        {
+            const auto &slot = detail::current_pool_worker();
+            Task task;
+            if (!try_take(slot.pool == this ? slot.index : 0, task))
+                return false;
+
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+            task();
+            return true;
+        }
+
+        /// Whether the calling thread is one of this pool's workers
+        [[nodiscard]] bool in_worker() const noexcept { return detail::current_pool_worker().pool == this; }
+
+        [[nodiscard]] size_t get_thread_count() const noexcept { return workers.size(); }
+
+        /// Tasks taken from another worker's deque so far
+        [[nodiscard]] uint64_t get_steal_count() const noexcept { return steals.load(std::memory_order_relaxed); }
+    };
+
+    /// Fork-join scope on a WorkStealingPool
+    ///
+    /// run() queues a task; wait() returns once every queued task has finished and rethrows the
+    /// first exception one of them threw. A pool worker that waits runs queued tasks meanwhile, so
+    /// groups nest inside pool tasks without tying up the workers; any other thread sleeps. Tasks
+    /// must not block on each other except through a nested group.
+    class TaskGroup
+    {
+    private:
+        WorkStealingPool &pool;
+        std::mutex mutex;
+        std::condition_variable finished;
+        size_t outstanding = 0;     // Guarded by mutex
+        std::exception_ptr failure; // Guarded by mutex
+
+        void wait_all()
+        {
+            if (pool.in_worker())
+            {
+                for (;;)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (outstanding == 0)
+                            return;
+                    }
+                    if (!pool.run_pending_task())
+                        std::this_thread::yield();
+                }
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [&]
+                          { return outstanding == 0; });
+        }
+
+    public:
+        explicit TaskGroup(WorkStealingPool &target) : pool(target) {}
+
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+        /// Waits for tasks still running, so none outlives the state it references
+        ~TaskGroup()
+        {
+            wait_all();
+        }
+
+        /// Queue `function` on the pool as part of this group
+        template <typename F>
+        void run(F &&function)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++outstanding;
+            }
+            pool.post([this, task = std::forward<F>(function)]() mutable
+                      {
+                          std::exception_ptr error;
+                          try
+                          {
+                              task();
+                          }
+                          catch (...)
+                          {
+                              error = std::current_exception();
+                          }
+
+                          // Notified under the lock: the waiter may destroy the group once it sees zero
+                          std::lock_guard<std::mutex> lock(mutex);
+                          if (error && !failure)
+                              failure = error;
+                          if (--outstanding == 0)
+                              finished.notify_all();
+                      });
+        }
+
+        /// Wait for every task run() queued, then rethrow the first exception among them
+        void wait()
+        {
+            wait_all();
+
+            std::exception_ptr error;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = std::exchange(failure, nullptr);
+            }
+            if (error)
+                std::rethrow_exception(error);
+        }
+    };
+
+} // namespace ecc
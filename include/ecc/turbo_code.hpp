@@ -0,0 +1,670 @@
+#pragma once
+
+#include "packed_codewords.hpp"
+#include "thread_pool.hpp"
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <cstdint>
+
+namespace ecc
+{
+
+    namespace detail
+    {
+        /// Constituent RSC trellis of TurboCode: feedback = input + s2, parity = feedback + s0 + s1,
+        /// state shifts right with the feedback entering at bit 2
+        struct TurboTrellis
+        {
+            std::array<std::array<uint8_t, 2>, 8> next{};
+            std::array<std::array<uint8_t, 2>, 8> parity{};
+            std::array<std::array<uint8_t, 2>, 8> previous{};       // The two states leading into a state
+            std::array<std::array<uint8_t, 2>, 8> previous_input{}; // and the inputs taking those branches
+        };
+
+        constexpr TurboTrellis make_turbo_trellis() noexcept
+        {
+            TurboTrellis trellis;
+            std::array<uint8_t, 8> incoming{};
+            for (uint8_t state = 0; state < 8; ++state)
+            {
+                for (uint8_t input = 0; input < 2; ++input)
+                {
+                    const uint8_t feedback = input ^ ((state >> 2) & 1);
+                    const uint8_t next = static_cast<uint8_t>(((state >> 1) | (feedback << 2)) & 7);
+                    trellis.parity[state][input] = feedback ^ (state & 1) ^ ((state >> 1) & 1);
+                    trellis.next[state][input] = next;
+                    trellis.previous[next][incoming[next]] = state;
+                    trellis.previous_input[next][incoming[next]++] = input;
+                }
+            }
+            return trellis;
+        }
+
+        inline constexpr TurboTrellis turbo_trellis = make_turbo_trellis();
+    } // namespace detail
+
+    /// Quadratic permutation polynomial interleaver pi(i) = (f1 i + f2 i^2) mod K, as used by LTE
+    ///
+    /// Forward and inverse tables are built once; shared() caches one interleaver per block size for
+    /// the whole process. A QPP is contention-free for every window length dividing K: the windows
+    /// of a parallel decoder always touch distinct windows of the other domain at each step.
+    class QPPInterleaver
+    {
+    private:
+        size_t length;
+        size_t f1, f2;
+        std::vector<uint32_t> forward_table;
+        std::vector<uint32_t> inverse_table;
+
+    public:
+        /// Build the tables; throws if K is zero or (f1, f2) does not give a permutation of [0, K)
+        QPPInterleaver(size_t block_length, size_t coefficient1, size_t coefficient2)
+            : length(checked_length(block_length)), f1(coefficient1 % length), f2(coefficient2 % length)
+        {
+            if (!build())
+                throw std::invalid_argument("QPP coefficients do not define a permutation");
+        }
+
+        /// Process-wide interleaver for block length K with coefficients from select_coefficients()
+        [[nodiscard]] static const QPPInterleaver &shared(size_t block_length)
+        {
+            static std::mutex cache_mutex;
+            static std::map<size_t, std::unique_ptr<const QPPInterleaver>> cache;
+
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            auto &entry = cache[block_length];
+            if (!entry)
+            {
+                const auto [c1, c2] = select_coefficients(block_length);
+                entry = std::make_unique<const QPPInterleaver>(block_length, c1, c2);
+            }
+            return *entry;
+        }
+
+        /// Coefficients with the best spread among valid QPP candidates
+        ///
+        /// f2 runs over multiples of the product of K's distinct prime factors and f1 over odd values
+        /// coprime to K; a candidate scores by the minimum of |i - j| + |pi(i) - pi(j)| (cyclic) over
+        /// pairs closer than spread_window. Falls back to the linear permutation f1 = 1, f2 = 0.
+        [[nodiscard]] static std::pair<size_t, size_t> select_coefficients(size_t block_length)
+        {
+            if (block_length == 0)
+                throw std::invalid_argument("Interleaver length must be positive");
+            if (block_length < 4)
+                return {1, 0};
+
+            size_t radical = 1;
+            for (size_t remaining = block_length, p = 2; remaining > 1; ++p)
+            {
+                if (p * p > remaining)
+                    p = remaining;
+                if (remaining % p == 0)
+                {
+                    radical *= p;
+                    while (remaining % p == 0)
+                        remaining /= p;
+                }
+            }
+
+            constexpr size_t spread_window = 16;
+            constexpr size_t f2_candidates = 8;
+            constexpr size_t f1_candidates = 8;
+
+            std::pair<size_t, size_t> best{1, 0};
+            size_t best_score = 0;
+            std::vector<uint32_t> table(block_length);
+
+            for (size_t a = 1, tried2 = 0; tried2 < f2_candidates && radical * a < block_length; ++a)
+            {
+                const size_t c2 = radical * a;
+                ++tried2;
+
+                // f1 near sqrt(2K) spreads neighbours well; step through odd coprime values
+                size_t c1 = static_cast<size_t>(std::sqrt(2.0 * static_cast<double>(block_length))) | 1;
+                for (size_t tried1 = 0; tried1 < f1_candidates && c1 < block_length; c1 += 2)
+                {
+                    if (std::gcd(c1, block_length) != 1)
+                        continue;
+                    ++tried1;
+
+                    if (!fill(block_length, c1, c2, table))
+                        continue;
+
+                    const size_t score = spread(table, spread_window);
+                    if (score > best_score)
+                    {
+                        best_score = score;
+                        best = {c1, c2};
+                    }
+                }
+            }
+
+            return best;
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return length; }
+        [[nodiscard]] size_t get_f1() const noexcept { return f1; }
+        [[nodiscard]] size_t get_f2() const noexcept { return f2; }
+
+        /// pi(i): position in the natural-order block read by interleaved position i
+        [[nodiscard]] uint32_t operator[](size_t i) const noexcept { return forward_table[i]; }
+
+        [[nodiscard]] const std::vector<uint32_t> &forward() const noexcept { return forward_table; }
+        [[nodiscard]] const std::vector<uint32_t> &inverse() const noexcept { return inverse_table; }
+
+    private:
+        static size_t checked_length(size_t block_length)
+        {
+            if (block_length == 0)
+                throw std::invalid_argument("Interleaver length must be positive");
+            return block_length;
+        }
+
+        bool build()
+        {
+            forward_table.resize(length);
+            if (!fill(length, f1, f2, forward_table))
+                return false;
+
+            inverse_table.resize(length);
+            for (size_t i = 0; i < length; ++i)
+            {
+                inverse_table[forward_table[i]] = static_cast<uint32_t>(i);
+            }
+            return true;
+        }
+
+        /// Fill pi(i) recursively (pi(i+1) = pi(i) + g(i), g(i+1) = g(i) + 2 f2) and check bijectivity
+        static bool fill(size_t block_length, size_t c1, size_t c2, std::vector<uint32_t> &table)
+        {
+            std::vector<uint8_t> seen(block_length, 0);
+            uint64_t value = 0;
+            uint64_t step = (c1 + c2) % block_length;
+            const uint64_t step_increment = (2 * c2) % block_length;
+
+            for (size_t i = 0; i < block_length; ++i)
+            {
+                if (seen[value])
+                    return false;
+                seen[value] = 1;
+                table[i] = static_cast<uint32_t>(value);
+
+                value = (value + step) % block_length;
+                step = (step + step_increment) % block_length;
+            }
+            return true;
+        }
+
+        static size_t spread(const std::vector<uint32_t> &table, size_t window)
+        {
+            const size_t block_length = table.size();
+            size_t score = block_length;
+            for (size_t i = 0; i < block_length; ++i)
+            {
+                for (size_t d = 1; d < window && i + d < block_length; ++d)
+                {
+                    const size_t gap = table[i] > table[i + d] ? table[i] - table[i + d] : table[i + d] - table[i];
+                    score = std::min(score, d + std::min(gap, block_length - gap));
+                }
+            }
+            return score;
+        }
+    };
+
+    /// Rate-1/3 parallel concatenated (turbo) code with two 8-state RSC encoders
+    ///
+    /// Codeword layout is (systematic, parity 1, parity 2) per information bit; the trellises are not
+    /// terminated. LLRs are log P(0)/P(1), so a hard 0 maps to a positive value.
+    ///
+    /// Decoding is iterative max-log-MAP. The block is cut into windows of window_length steps; each
+    /// window trains its forward and backward state metrics over training_length steps outside the
+    /// window (starting from equiprobable states), so windows are independent and can run on the
+    /// threads of a WorkStealingPool. Iterations stop once the hard decisions no longer change.
+    class TurboCode
+    {
+    private:
+        size_t k; // Information length
+        size_t n; // Codeword length (3*k for rate 1/3)
+        const QPPInterleaver *interleaver; // Shared per block length, see QPPInterleaver::shared()
+        size_t max_iterations;
+
+        size_t window_length = 64;
+        size_t training_length = 32;
+        WorkStealingPool *window_pool = nullptr;
+
+        static constexpr size_t states = 8;
+        static constexpr size_t parallel_min_length = 4096; // Blocks shorter than this decode serially
+        static constexpr float extrinsic_scale = 0.75f;     // Max-log-MAP extrinsic correction
+        static constexpr float hard_input_llr = 2.0f;
+
+        static constexpr const detail::TurboTrellis &trellis = detail::turbo_trellis;
+
+    public:
+        using CodeWord = std::vector<uint8_t>;
+        using DataWord = std::vector<uint8_t>;
+
+        static constexpr size_t code_length = 0; // Dynamic
+        static constexpr size_t data_length = 0; // Dynamic
+
+        /// Default unit of int8 input LLRs (the LDPC decoders' fixed-point LSB)
+        static constexpr float default_llr_lsb = 0.25f;
+
+        /// Reusable decoder buffers (one per thread)
+        struct Workspace
+        {
+            std::vector<float> systematic;
+            std::vector<float> parity1;
+            std::vector<float> parity2;
+            std::vector<float> apriori;             // Decoder 1 a priori (deinterleaved decoder 2 extrinsic)
+            std::vector<float> extrinsic1;          // Decoder 1 extrinsic, natural order
+            std::vector<float> interleaved_sys;     // Systematic LLRs in interleaved order
+            std::vector<float> interleaved_apriori; // Decoder 2 a priori
+            std::vector<float> extrinsic2;          // Decoder 2 extrinsic, interleaved order
+            std::vector<float> alpha;               // Forward metrics, window_length * states per thread
+            std::vector<uint8_t> decisions;
+        };
+
+        TurboCode(size_t info_length, size_t max_iter = 8)
+            : k(info_length), n(3 * info_length), interleaver(&QPPInterleaver::shared(info_length)),
+              max_iterations(max_iter)
+        {
+        }
+
+        /// Encode data using turbo code
+        [[nodiscard]] CodeWord encode(const DataWord &data) const
+        {
+            if (data.size() != k)
+                throw std::invalid_argument("Invalid data length");
+
+            CodeWord codeword(n);
+            encode_into(data, codeword);
+            return codeword;
+        }
+
+        /// Batch encode of a packed buffer of data words into `out` (packed codewords)
+        void encode(const PackedCodewords &data, PackedCodewords &out) const
+        {
+            if (data.codeword_length() != k)
+                throw std::invalid_argument("Packed data words do not match the information length");
+
+            out.reshape(n, data.size());
+            DataWord message(k);
+            CodeWord codeword(n);
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                data.load_bits(i, message);
+                encode_into(message, codeword);
+                out.store_bits(i, codeword);
+            }
+        }
+
+        /// Decode using iterative turbo decoding
+        struct DecodeResult
+        {
+            DataWord data;
+            bool success; // Hard decisions converged before max_iterations ran out
+            size_t iterations_used;
+        };
+
+        [[nodiscard]] DecodeResult decode(const CodeWord &received) const
+        {
+            Workspace workspace;
+            return decode(received, workspace);
+        }
+
+        /// Decode reusing `workspace` for all buffers
+        [[nodiscard]] DecodeResult decode(const CodeWord &received, Workspace &workspace) const
+        {
+            if (received.size() != n)
+                throw std::invalid_argument("Invalid codeword length");
+
+            prepare(workspace);
+            for (size_t i = 0; i < k; ++i)
+            {
+                workspace.systematic[i] = received[3 * i] ? -hard_input_llr : hard_input_llr;
+                workspace.parity1[i] = received[3 * i + 1] ? -hard_input_llr : hard_input_llr;
+                workspace.parity2[i] = received[3 * i + 2] ? -hard_input_llr : hard_input_llr;
+            }
+
+            return iterate(workspace);
+        }
+
+        /// Decode soft channel output: one int8 LLR per codeword bit in units of `lsb`
+        ///
+        /// Values are log P(0)/P(1) in codeword layout (systematic, parity 1, parity 2 per step); a
+        /// hard codeword is the special case +-hard_input_llr / lsb. Channel reliabilities feed the
+        /// branch metrics directly, so fewer iterations pass before the decisions settle.
+        [[nodiscard]] DecodeResult decode(std::span<const int8_t> llrs, float lsb = default_llr_lsb) const
+        {
+            Workspace workspace;
+            return decode(llrs, workspace, lsb);
+        }
+
+        /// Soft-input decode reusing `workspace` for all buffers
+        [[nodiscard]] DecodeResult decode(std::span<const int8_t> llrs, Workspace &workspace,
+                                          float lsb = default_llr_lsb) const
+        {
+            if (llrs.size() != n)
+                throw std::invalid_argument("Invalid LLR count");
+
+            prepare(workspace);
+            for (size_t i = 0; i < k; ++i)
+            {
+                workspace.systematic[i] = llrs[3 * i] * lsb;
+                workspace.parity1[i] = llrs[3 * i + 1] * lsb;
+                workspace.parity2[i] = llrs[3 * i + 2] * lsb;
+            }
+
+            return iterate(workspace);
+        }
+
+        /// Batch hard-input decode of a packed buffer of codewords into `out` (packed data words);
+        /// returns the number of words whose decisions had not converged, which are stored as is
+        size_t decode(const PackedCodewords &received, PackedCodewords &out) const
+        {
+            Workspace workspace;
+            return decode(received, out, workspace);
+        }
+
+        /// Packed batch decode reusing `workspace` for all buffers
+        size_t decode(const PackedCodewords &received, PackedCodewords &out, Workspace &workspace) const
+        {
+            if (received.codeword_length() != n)
+                throw std::invalid_argument("Packed codewords do not match the code length");
+
+            out.reshape(k, received.size());
+            size_t failures = 0;
+            for (size_t w = 0; w < received.size(); ++w)
+            {
+                prepare(workspace);
+                for (size_t i = 0; i < k; ++i)
+                {
+                    workspace.systematic[i] = received.get(w, 3 * i) ? -hard_input_llr : hard_input_llr;
+                    workspace.parity1[i] = received.get(w, 3 * i + 1) ? -hard_input_llr : hard_input_llr;
+                    workspace.parity2[i] = received.get(w, 3 * i + 2) ? -hard_input_llr : hard_input_llr;
+                }
+
+                failures += !run_iterations(workspace).success;
+                out.store_bits(w, workspace.decisions);
+            }
+
+            return failures;
+        }
+
+        /// Sliding-window geometry: window and training lengths in trellis steps
+        void set_window(size_t window, size_t training)
+        {
+            if (window == 0)
+                throw std::invalid_argument("Window length must be positive");
+            window_length = window;
+            training_length = training;
+        }
+
+        /// Split the windows of each half-iteration across the threads of `pool` (blocks of >= 4096
+        /// bits); the pool must outlive every decode that uses it
+        void set_window_pool(WorkStealingPool &pool) noexcept
+        {
+            window_pool = &pool;
+        }
+
+        [[nodiscard]] size_t get_window_length() const noexcept { return window_length; }
+        [[nodiscard]] size_t get_training_length() const noexcept { return training_length; }
+        [[nodiscard]] size_t get_window_threads() const noexcept { return window_pool ? window_pool->get_thread_count() : 1; }
+        [[nodiscard]] size_t get_info_length() const noexcept { return k; }
+        [[nodiscard]] const QPPInterleaver &get_interleaver() const noexcept { return *interleaver; }
+
+    private:
+        [[nodiscard]] size_t thread_count() const noexcept
+        {
+            if (get_window_threads() <= 1 || k < parallel_min_length)
+                return 1;
+            return std::min(get_window_threads(), (k + window_length - 1) / window_length);
+        }
+
+        void prepare(Workspace &ws) const
+        {
+            for (auto *buffer : {&ws.systematic, &ws.parity1, &ws.parity2, &ws.extrinsic1,
+                                 &ws.interleaved_sys, &ws.interleaved_apriori, &ws.extrinsic2})
+            {
+                buffer->resize(k);
+            }
+            ws.apriori.assign(k, 0.0f);
+            ws.alpha.resize(thread_count() * std::min(window_length, k) * states);
+            ws.decisions.resize(k);
+        }
+
+        /// Systematic bits and both parity sequences of `data` (k bits) into `codeword` (n bits)
+        void encode_into(std::span<const uint8_t> data, std::span<uint8_t> codeword) const
+        {
+            uint8_t state1 = 0;
+            uint8_t state2 = 0;
+            for (size_t i = 0; i < k; ++i)
+            {
+                const uint8_t input = data[i] & 1;
+                codeword[3 * i] = input;
+                codeword[3 * i + 1] = trellis.parity[state1][input];
+                state1 = trellis.next[state1][input];
+
+                // Second parity sequence from the interleaved data
+                const uint8_t interleaved = data[(*interleaver)[i]] & 1;
+                codeword[3 * i + 2] = trellis.parity[state2][interleaved];
+                state2 = trellis.next[state2][interleaved];
+            }
+        }
+
+        struct IterationResult
+        {
+            bool success;
+            size_t iterations_used;
+        };
+
+        /// Turbo iterations over the loaded channel LLRs
+        DecodeResult iterate(Workspace &ws) const
+        {
+            const IterationResult result = run_iterations(ws);
+            return {ws.decisions, result.success, result.iterations_used};
+        }
+
+        /// Turbo iterations leaving the decisions in ws.decisions
+        IterationResult run_iterations(Workspace &ws) const
+        {
+            const uint32_t *forward = interleaver->forward().data();
+            const uint32_t *inverse = interleaver->inverse().data();
+
+            for (size_t i = 0; i < k; ++i)
+            {
+                ws.interleaved_sys[i] = ws.systematic[forward[i]];
+                ws.decisions[i] = ws.systematic[i] < 0 ? 1 : 0;
+            }
+
+            size_t iterations = 0;
+            bool converged = false;
+            while (iterations < max_iterations && !converged)
+            {
+                ++iterations;
+
+                // Decoder 1 in natural order
+                max_log_map(ws.systematic, ws.parity1, ws.apriori, ws.extrinsic1, ws);
+
+                // Decoder 2 in interleaved order
+                for (size_t i = 0; i < k; ++i)
+                {
+                    ws.interleaved_apriori[i] = ws.extrinsic1[forward[i]];
+                }
+                max_log_map(ws.interleaved_sys, ws.parity2, ws.interleaved_apriori, ws.extrinsic2, ws);
+
+                // Deinterleave (a gather through the inverse table), decide, and stop once no decision changes
+                converged = true;
+                for (size_t i = 0; i < k; ++i)
+                {
+                    ws.apriori[i] = ws.extrinsic2[inverse[i]];
+                }
+                for (size_t i = 0; i < k; ++i)
+                {
+                    const float total = ws.systematic[i] + ws.extrinsic1[i] + ws.apriori[i];
+                    const uint8_t bit = total < 0 ? 1 : 0;
+                    converged = converged && (bit == ws.decisions[i]);
+                    ws.decisions[i] = bit;
+                }
+            }
+
+            return {converged, iterations};
+        }
+
+        /// One max-log-MAP pass: extrinsic[i] from systematic, parity and a priori LLRs
+        void max_log_map(const std::vector<float> &systematic, const std::vector<float> &parity,
+                         const std::vector<float> &apriori, std::vector<float> &extrinsic, Workspace &ws) const
+        {
+            const size_t window = std::min(window_length, k);
+            const size_t windows = (k + window - 1) / window;
+            const size_t threads = thread_count();
+
+            const auto run = [&](size_t thread, size_t first_window, size_t last_window)
+            {
+                float *alpha = ws.alpha.data() + thread * window * states;
+                for (size_t w = first_window; w < last_window; ++w)
+                {
+                    const size_t begin = w * window;
+                    decode_window(systematic, parity, apriori, extrinsic, begin, std::min(k, begin + window), alpha);
+                }
+            };
+
+            if (threads <= 1)
+            {
+                run(0, 0, windows);
+                return;
+            }
+
+            // Window group 0 runs on the calling thread
+            TaskGroup group(*window_pool);
+            const size_t per_thread = (windows + threads - 1) / threads;
+            for (size_t th = 1; th < threads; ++th)
+            {
+                const size_t first = std::min(windows, th * per_thread);
+                const size_t last = std::min(windows, first + per_thread);
+                group.run([&run, th, first, last]
+                          { run(th, first, last); });
+            }
+            run(0, 0, std::min(windows, per_thread));
+            group.wait();
+        }
+
+        /// Branch metrics of step i: index [state][input]
+        ///
+        /// A branch only depends on its (input, parity) bits, so there are four distinct values.
+        [[nodiscard]] static std::array<std::array<float, 2>, states> branch_metrics(float info, float parity) noexcept
+        {
+            const float same = 0.5f * (info + parity);     // (0, 0); (1, 1) is -same
+            const float opposite = 0.5f * (info - parity); // (0, 1); (1, 0) is -opposite
+            std::array<std::array<float, 2>, states> gamma{};
+            for (size_t s = 0; s < states; ++s)
+            {
+                gamma[s][0] = trellis.parity[s][0] ? opposite : same;
+                gamma[s][1] = trellis.parity[s][1] ? -same : -opposite;
+            }
+            return gamma;
+        }
+
+        static void forward_step(const std::array<float, states> &alpha, float info, float parity,
+                                 std::array<float, states> &next) noexcept
+        {
+            const auto gamma = branch_metrics(info, parity);
+            for (size_t t = 0; t < states; ++t)
+            {
+                const size_t a = trellis.previous[t][0];
+                const size_t b = trellis.previous[t][1];
+                next[t] = std::max(alpha[a] + gamma[a][trellis.previous_input[t][0]],
+                                   alpha[b] + gamma[b][trellis.previous_input[t][1]]);
+            }
+            const float norm = *std::max_element(next.begin(), next.end());
+            for (auto &metric : next)
+            {
+                metric -= norm;
+            }
+        }
+
+        static void backward_step(const std::array<float, states> &beta, float info, float parity,
+                                  std::array<float, states> &previous) noexcept
+        {
+            const auto gamma = branch_metrics(info, parity);
+            for (size_t s = 0; s < states; ++s)
+            {
+                previous[s] = std::max(gamma[s][0] + beta[trellis.next[s][0]], gamma[s][1] + beta[trellis.next[s][1]]);
+            }
+            const float norm = *std::max_element(previous.begin(), previous.end());
+            for (auto &metric : previous)
+            {
+                metric -= norm;
+            }
+        }
+
+        /// Max-log-MAP over steps [begin, end) with training-based boundary metrics
+        void decode_window(const std::vector<float> &systematic, const std::vector<float> &parity,
+                           const std::vector<float> &apriori, std::vector<float> &extrinsic,
+                           size_t begin, size_t end, float *alpha_store) const noexcept
+        {
+            constexpr float unreachable = -1e30f;
+
+            // Forward metrics at `begin`: known zero state at the block start, otherwise trained
+            std::array<float, states> alpha{};
+            std::array<float, states> scratch{};
+            const size_t train_from = begin > training_length ? begin - training_length : 0;
+            if (train_from == 0)
+            {
+                alpha.fill(unreachable);
+                alpha[0] = 0.0f;
+            }
+            for (size_t i = train_from; i < begin; ++i)
+            {
+                forward_step(alpha, systematic[i] + apriori[i], parity[i], scratch);
+                alpha = scratch;
+            }
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                std::copy(alpha.begin(), alpha.end(), alpha_store + (i - begin) * states);
+                forward_step(alpha, systematic[i] + apriori[i], parity[i], scratch);
+                alpha = scratch;
+            }
+
+            // Backward metrics at `end`: equiprobable (unterminated trellis) after training
+            std::array<float, states> beta{};
+            const size_t train_to = std::min(k, end + training_length);
+            for (size_t i = train_to; i-- > end;)
+            {
+                backward_step(beta, systematic[i] + apriori[i], parity[i], scratch);
+                beta = scratch;
+            }
+
+            for (size_t i = end; i-- > begin;)
+            {
+                // Extrinsic part: compare branches by parity metric only
+                const float *a = alpha_store + (i - begin) * states;
+                const float half_parity = 0.5f * parity[i];
+                float best0 = -std::numeric_limits<float>::infinity();
+                float best1 = -std::numeric_limits<float>::infinity();
+                for (size_t s = 0; s < states; ++s)
+                {
+                    const float p0 = trellis.parity[s][0] ? -half_parity : half_parity;
+                    const float p1 = trellis.parity[s][1] ? -half_parity : half_parity;
+                    best0 = std::max(best0, a[s] + p0 + beta[trellis.next[s][0]]);
+                    best1 = std::max(best1, a[s] + p1 + beta[trellis.next[s][1]]);
+                }
+                extrinsic[i] = extrinsic_scale * (best0 - best1);
+
+                backward_step(beta, systematic[i] + apriori[i], parity[i], scratch);
+                beta = scratch;
+            }
+        }
+    };
+
+} // namespace ecc
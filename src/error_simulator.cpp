@@ -1,3 +1,6 @@
+#include "ecc/rng.hpp"
+#include "ecc/gaussian_noise.hpp"
+#include "ecc/packed_codewords.hpp"
 #include <iostream>
 #include <vector>
 #include <random>
@@ -10,6 +13,10 @@
 #include <memory>
 #include <set>
 #include <iomanip>
+#include <span>
+#include <bit>
+#include <stdexcept>
+#include <string>
 
 namespace ecc
 {
@@ -35,47 +42,149 @@ namespace ecc
         size_t period = 7;             // For periodic errors
         double fading_amplitude = 0.5; // For fading channels
         size_t seed = 42;              // Random seed for reproducibility
+        bool skip_sampling = false;    // Geometric gap sampling for BSC/erasure (cost per error, not per bit)
     };
 
+    namespace detail
+    {
+        /// One codeword of 0/1 byte symbols, as seen by the channel kernels
+        struct ByteBitView
+        {
+            std::span<uint8_t> symbols;
+
+            [[nodiscard]] size_t size() const noexcept { return symbols.size(); }
+            [[nodiscard]] bool get(size_t i) const noexcept { return symbols[i] != 0; }
+            void set(size_t i, bool value) noexcept { symbols[i] = value ? 1 : 0; }
+            void flip(size_t i) noexcept { symbols[i] = (symbols[i] == 0) ? 1 : 0; }
+            void erase(size_t i) noexcept { symbols[i] = 2; } // Value 2 marks an erasure
+        };
+
+        /// One bit-packed codeword, as seen by the channel kernels
+        ///
+        /// Bits have no erasure symbol, so an erased position reads as 0, like PerformanceAnalyzer's BEC.
+        struct PackedBitView
+        {
+            std::span<uint64_t> words;
+            size_t length;
+
+            [[nodiscard]] size_t size() const noexcept { return length; }
+            [[nodiscard]] bool get(size_t i) const noexcept { return (words[i / 64] >> (i % 64)) & 1; }
+
+            void set(size_t i, bool value) noexcept
+            {
+                const uint64_t mask = 1ull << (i % 64);
+                words[i / 64] = value ? (words[i / 64] | mask) : (words[i / 64] & ~mask);
+            }
+
+            void flip(size_t i) noexcept { words[i / 64] ^= 1ull << (i % 64); }
+            void erase(size_t i) noexcept { set(i, false); }
+        };
+    } // namespace detail
+
     /// Channel model interface
     class ChannelModel
     {
     public:
         virtual ~ChannelModel() = default;
-        virtual std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword) = 0;
+
+        /// Corrupt one codeword in place
+        virtual void apply_errors(std::span<uint8_t> codeword) = 0;
+
+        /// Corrupt `codewords.size() / codeword_length` back-to-back codewords in place with one call
+        virtual void apply_errors_batch(std::span<uint8_t> codewords, size_t codeword_length) = 0;
+
+        /// Corrupt every codeword of a bit-packed buffer in place
+        virtual void apply_errors(PackedCodewords &codewords) = 0;
+
         virtual void set_parameters(const ErrorParameters &params) = 0;
         virtual std::string get_name() const = 0;
+
+        /// Copying wrapper around the in-place path
+        [[nodiscard]] std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword)
+        {
+            auto result = codeword;
+            apply_errors(std::span<uint8_t>(result));
+            return result;
+        }
+    };
+
+    /// CRTP base wiring the in-place entry points to `Derived::corrupt(View)`
+    ///
+    /// `corrupt` sees either a detail::ByteBitView or a detail::PackedBitView, so a channel is written
+    /// once for both layouts and draws the same random numbers in each. The batch loops call `corrupt`
+    /// statically, so a batch costs one virtual dispatch in total rather than one per codeword.
+    template <typename Derived>
+    class BasicChannel : public ChannelModel
+    {
+    public:
+        using ChannelModel::apply_errors;
+
+        void apply_errors(std::span<uint8_t> codeword) final
+        {
+            static_cast<Derived &>(*this).corrupt(detail::ByteBitView{codeword});
+        }
+
+        void apply_errors_batch(std::span<uint8_t> codewords, size_t codeword_length) final
+        {
+            if (codeword_length == 0 || codewords.size() % codeword_length != 0)
+            {
+                throw std::invalid_argument("Batch size is not a multiple of the codeword length");
+            }
+
+            auto &channel = static_cast<Derived &>(*this);
+            for (size_t offset = 0; offset < codewords.size(); offset += codeword_length)
+            {
+                channel.corrupt(detail::ByteBitView{codewords.subspan(offset, codeword_length)});
+            }
+        }
+
+        void apply_errors(PackedCodewords &codewords) final
+        {
+            auto &channel = static_cast<Derived &>(*this);
+            for (size_t i = 0; i < codewords.size(); ++i)
+            {
+                channel.corrupt(detail::PackedBitView{codewords.codeword(i), codewords.codeword_length()});
+            }
+        }
     };
 
     /// Binary Symmetric Channel (BSC)
-    class BSCChannel : public ChannelModel
+    class BSCChannel : public BasicChannel<BSCChannel>
     {
     private:
         ErrorParameters params_;
         mutable std::mt19937 rng_;
         mutable std::uniform_real_distribution<double> dist_;
+        GeometricSkipSampler skipper_;
 
     public:
         BSCChannel(const ErrorParameters &params = {})
-            : params_(params), rng_(params.seed), dist_(0.0, 1.0) {}
+            : params_(params), rng_(params.seed), dist_(0.0, 1.0), skipper_(params.probability) {}
 
-        std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword) override
+        template <typename View>
+        void corrupt(View result)
         {
-            auto result = codeword;
-            for (auto &bit : result)
+            if (params_.skip_sampling)
+            {
+                skipper_.for_each_event(result.size(), rng_, [&](size_t i)
+                                        { result.flip(i); });
+                return;
+            }
+
+            for (size_t i = 0; i < result.size(); ++i)
             {
                 if (dist_(rng_) < params_.probability)
                 {
-                    bit = (bit == 0) ? 1 : 0;
+                    result.flip(i);
                 }
             }
-            return result;
         }
 
         void set_parameters(const ErrorParameters &params) override
         {
             params_ = params;
             rng_.seed(params.seed);
+            skipper_.reset(params.probability);
         }
 
         std::string get_name() const override
@@ -85,38 +194,46 @@ namespace ecc
     };
 
     /// Additive White Gaussian Noise (AWGN) Channel
-    class AWGNChannel : public ChannelModel
+    class AWGNChannel : public BasicChannel<AWGNChannel>
     {
     private:
         ErrorParameters params_;
-        mutable std::mt19937 rng_;
-        mutable std::normal_distribution<double> noise_dist_;
+        GaussianNoise noise_;
 
     public:
         AWGNChannel(const ErrorParameters &params = {})
-            : params_(params), rng_(params.seed), noise_dist_(0.0, 1.0) {}
+            : params_(params), noise_(params.seed) {}
 
-        std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword) override
+        void corrupt(detail::ByteBitView result)
         {
-            auto result = codeword;
-            double snr_linear = std::pow(10.0, params_.probability / 10.0); // SNR in dB
-            double noise_variance = 1.0 / (2.0 * snr_linear);
+            // SNR in dB
+            noise_.bpsk_hard_decision(result.symbols, GaussianNoise::sigma_from_snr_db(params_.probability));
+        }
 
-            noise_dist_ = std::normal_distribution<double>(0.0, std::sqrt(noise_variance));
+        void corrupt(detail::PackedBitView result)
+        {
+            noise_.bpsk_hard_decision(result.words, result.length, GaussianNoise::sigma_from_snr_db(params_.probability));
+        }
 
-            for (auto &bit : result)
+        /// Soft-output mode: transmit back-to-back 0/1 `codewords` and write one int8 LLR per bit
+        ///
+        /// `llrs` is a contiguous buffer of the same size, in units of `lsb` (see GaussianNoise::bpsk_llr),
+        /// ready for the soft-input decode overloads of LDPCCode and TurboCode. Draws the noise the
+        /// hard-decision path would, so nonzero LLRs carry its decisions in their signs.
+        void apply_soft(std::span<const uint8_t> codewords, std::span<int8_t> llrs,
+                        float lsb = GaussianNoise::default_llr_lsb)
+        {
+            if (llrs.size() != codewords.size())
             {
-                double signal = (bit == 0) ? -1.0 : 1.0;
-                double received_signal = signal + noise_dist_(rng_);
-                bit = (received_signal > 0.0) ? 1 : 0;
+                throw std::invalid_argument("LLR buffer size must match the codeword bits");
             }
-            return result;
+            noise_.bpsk_llr(codewords, llrs, GaussianNoise::sigma_from_snr_db(params_.probability), lsb);
         }
 
         void set_parameters(const ErrorParameters &params) override
         {
             params_ = params;
-            rng_.seed(params.seed);
+            noise_ = GaussianNoise(params.seed);
         }
 
         std::string get_name() const override
@@ -126,7 +243,7 @@ namespace ecc
     };
 
     /// Burst Error Channel
-    class BurstErrorChannel : public ChannelModel
+    class BurstErrorChannel : public BasicChannel<BurstErrorChannel>
     {
     private:
         ErrorParameters params_;
@@ -136,12 +253,12 @@ namespace ecc
         BurstErrorChannel(const ErrorParameters &params = {})
             : params_(params), rng_(params.seed) {}
 
-        std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword) override
+        template <typename View>
+        void corrupt(View result)
         {
-            auto result = codeword;
 
             if (result.size() < params_.burst_length)
-                return result;
+                return;
 
             std::uniform_real_distribution<double> prob_dist(0.0, 1.0);
             std::uniform_int_distribution<size_t> pos_dist(0, result.size() - params_.burst_length);
@@ -152,11 +269,9 @@ namespace ecc
                 size_t start_pos = pos_dist(rng_);
                 for (size_t i = start_pos; i < start_pos + params_.burst_length; ++i)
                 {
-                    result[i] = (result[i] == 0) ? 1 : 0;
+                    result.flip(i);
                 }
             }
-
-            return result;
         }
 
         void set_parameters(const ErrorParameters &params) override
@@ -173,7 +288,7 @@ namespace ecc
     };
 
     /// Clustered Error Channel
-    class ClusteredErrorChannel : public ChannelModel
+    class ClusteredErrorChannel : public BasicChannel<ClusteredErrorChannel>
     {
     private:
         ErrorParameters params_;
@@ -183,9 +298,9 @@ namespace ecc
         ClusteredErrorChannel(const ErrorParameters &params = {})
             : params_(params), rng_(params.seed) {}
 
-        std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword) override
+        template <typename View>
+        void corrupt(View result)
         {
-            auto result = codeword;
             std::uniform_real_distribution<double> prob_dist(0.0, 1.0);
             std::uniform_int_distribution<size_t> pos_dist(0, result.size() - 1);
 
@@ -204,12 +319,10 @@ namespace ecc
                 {
                     if (prob_dist(rng_) < 0.8) // High probability within cluster
                     {
-                        result[i] = (result[i] == 0) ? 1 : 0;
+                        result.flip(i);
                     }
                 }
             }
-
-            return result;
         }
 
         void set_parameters(const ErrorParameters &params) override
@@ -226,34 +339,42 @@ namespace ecc
     };
 
     /// Erasure Channel
-    class ErasureChannel : public ChannelModel
+    class ErasureChannel : public BasicChannel<ErasureChannel>
     {
     private:
         ErrorParameters params_;
         mutable std::mt19937 rng_;
         mutable std::uniform_real_distribution<double> dist_;
+        GeometricSkipSampler skipper_;
 
     public:
         ErasureChannel(const ErrorParameters &params = {})
-            : params_(params), rng_(params.seed), dist_(0.0, 1.0) {}
+            : params_(params), rng_(params.seed), dist_(0.0, 1.0), skipper_(params.probability) {}
 
-        std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword) override
+        template <typename View>
+        void corrupt(View result)
         {
-            auto result = codeword;
-            for (auto &bit : result)
+            if (params_.skip_sampling)
+            {
+                skipper_.for_each_event(result.size(), rng_, [&](size_t i)
+                                        { result.erase(i); });
+                return;
+            }
+
+            for (size_t i = 0; i < result.size(); ++i)
             {
                 if (dist_(rng_) < params_.probability)
                 {
-                    bit = 2; // Use value 2 to indicate erasure (if supported)
+                    result.erase(i);
                 }
             }
-            return result;
         }
 
         void set_parameters(const ErrorParameters &params) override
         {
             params_ = params;
             rng_.seed(params.seed);
+            skipper_.reset(params.probability);
         }
 
         std::string get_name() const override
@@ -263,7 +384,7 @@ namespace ecc
     };
 
     /// Fading Channel
-    class FadingChannel : public ChannelModel
+    class FadingChannel : public BasicChannel<FadingChannel>
     {
     private:
         ErrorParameters params_;
@@ -277,22 +398,21 @@ namespace ecc
               fading_dist_(0.0, params.fading_amplitude),
               noise_dist_(0.0, 1.0) {}
 
-        std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword) override
+        template <typename View>
+        void corrupt(View result)
         {
-            auto result = codeword;
             double snr_linear = std::pow(10.0, params_.probability / 10.0);
             double noise_variance = 1.0 / (2.0 * snr_linear);
 
             noise_dist_ = std::normal_distribution<double>(0.0, std::sqrt(noise_variance));
 
-            for (auto &bit : result)
+            for (size_t i = 0; i < result.size(); ++i)
             {
-                double signal = (bit == 0) ? -1.0 : 1.0;
+                double signal = result.get(i) ? 1.0 : -1.0;
                 double fading_coeff = 1.0 + fading_dist_(rng_);
                 double received_signal = fading_coeff * signal + noise_dist_(rng_);
-                bit = (received_signal > 0.0) ? 1 : 0;
+                result.set(i, received_signal > 0.0);
             }
-            return result;
         }
 
         void set_parameters(const ErrorParameters &params) override
@@ -433,31 +553,53 @@ namespace ecc
         /// Apply errors to codeword
         std::vector<uint8_t> apply_errors(const std::vector<uint8_t> &codeword)
         {
-            if (!channel_)
-            {
-                throw std::runtime_error("No channel model set");
-            }
-            return channel_->apply_errors(codeword);
+            auto result = codeword;
+            apply_errors(std::span<uint8_t>(result));
+            return result;
+        }
+
+        /// Apply errors to codeword in place
+        void apply_errors(std::span<uint8_t> codeword)
+        {
+            require_channel().apply_errors(codeword);
+        }
+
+        /// Apply errors in place to back-to-back codewords of `codeword_length` symbols
+        void apply_errors_batch(std::span<uint8_t> codewords, size_t codeword_length)
+        {
+            require_channel().apply_errors_batch(codewords, codeword_length);
+        }
+
+        /// Apply errors in place to every codeword of a bit-packed buffer
+        void apply_errors(PackedCodewords &codewords)
+        {
+            require_channel().apply_errors(codewords);
         }
 
         /// Apply specific error pattern
         std::vector<uint8_t> apply_error_pattern(const std::vector<uint8_t> &codeword,
                                                  const std::vector<uint8_t> &error_pattern)
+        {
+            std::vector<uint8_t> result = codeword;
+            apply_error_pattern(std::span<uint8_t>(result), std::span<const uint8_t>(error_pattern));
+            return result;
+        }
+
+        /// Apply specific error pattern in place
+        void apply_error_pattern(std::span<uint8_t> codeword, std::span<const uint8_t> error_pattern)
         {
             if (codeword.size() != error_pattern.size())
             {
                 throw std::invalid_argument("Codeword and error pattern size mismatch");
             }
 
-            std::vector<uint8_t> result = codeword;
-            for (size_t i = 0; i < result.size(); ++i)
+            for (size_t i = 0; i < codeword.size(); ++i)
             {
                 if (error_pattern[i])
                 {
-                    result[i] = (result[i] == 0) ? 1 : 0;
+                    codeword[i] = (codeword[i] == 0) ? 1 : 0;
                 }
             }
-            return result;
         }
 
         /// Generate error statistics
@@ -493,6 +635,50 @@ namespace ecc
             return stats;
         }
 
+        /// Error statistics of bit-packed buffers, counted by XOR and popcount a word at a time
+        ///
+        /// Error positions are bit offsets into the concatenated codewords (codeword * length + bit).
+        ErrorStatistics analyze_errors(const PackedCodewords &original, const PackedCodewords &received)
+        {
+            if (original.codeword_length() != received.codeword_length() || original.size() != received.size())
+            {
+                throw std::invalid_argument("Packed buffers differ in shape");
+            }
+
+            ErrorStatistics stats{};
+            stats.total_bits = original.total_bits();
+
+            const size_t length = original.codeword_length();
+            for (size_t c = 0; c < original.size(); ++c)
+            {
+                const auto sent = original.codeword(c);
+                const auto got = received.codeword(c);
+                size_t codeword_errors = 0;
+
+                for (size_t w = 0; w < sent.size(); ++w)
+                {
+                    uint64_t diff = sent[w] ^ got[w];
+                    codeword_errors += static_cast<size_t>(std::popcount(diff));
+                    while (diff != 0)
+                    {
+                        stats.error_positions.push_back(c * length + 64 * w + static_cast<size_t>(std::countr_zero(diff)));
+                        diff &= diff - 1;
+                    }
+                }
+
+                stats.error_bits += codeword_errors;
+                stats.error_blocks += codeword_errors > 0;
+            }
+
+            if (!original.empty())
+            {
+                stats.bit_error_rate = static_cast<double>(stats.error_bits) / stats.total_bits;
+                stats.block_error_rate = static_cast<double>(stats.error_blocks) / original.size();
+            }
+
+            return stats;
+        }
+
         /// Test error correction capability
         template <typename CodeType>
         void test_error_correction_capability(size_t max_errors = 10, size_t iterations = 1000)
@@ -556,6 +742,16 @@ namespace ecc
         {
             return channel_ ? channel_->get_name() : "No Channel";
         }
+
+    private:
+        ChannelModel &require_channel()
+        {
+            if (!channel_)
+            {
+                throw std::runtime_error("No channel model set");
+            }
+            return *channel_;
+        }
     };
 
 } // namespace ecc
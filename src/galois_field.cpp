@@ -35,6 +35,12 @@ namespace ecc
             return std::make_unique<GF4096>(primitive_poly_12);
         }
 
+        /// Create GF(2^16) field for long-block codes
+        std::unique_ptr<GF65536> create_gf65536()
+        {
+            return std::make_unique<GF65536>(primitive_poly_16);
+        }
+
     } // namespace galois
 
     /// Utility functions for Galois field operations
@@ -153,7 +159,7 @@ namespace ecc
     {
 
         template <size_t m>
-        BenchmarkResults<m> benchmark_field_operations(size_t iterations)
+        BenchmarkResults<m> benchmark_field_operations(size_t iterations, size_t region_bytes)
         {
             GaloisField<m> field(galois_utils::get_default_primitive<m>());
             BenchmarkResults<m> results{};
@@ -249,6 +255,41 @@ namespace ecc
                 (void)result;
             }
 
+            // Benchmark region operations
+            if constexpr (m == 8)
+            {
+                results.region_bytes = region_bytes;
+
+                std::vector<uint8_t> src(region_bytes), dst(region_bytes);
+                for (auto &byte : src)
+                {
+                    byte = static_cast<uint8_t>(dis(gen));
+                }
+                const uint8_t c = static_cast<uint8_t>(data1.empty() ? 0x53 : std::max<uint32_t>(data1[0], 2));
+
+                // Repeat each kernel over at least `iterations` bytes (and no fewer than 8 passes)
+                const size_t passes = std::max<size_t>(8, iterations / std::max<size_t>(1, region_bytes));
+
+                auto measure_gbps = [&](auto &&kernel)
+                {
+                    auto start = std::chrono::high_resolution_clock::now();
+                    for (size_t pass = 0; pass < passes; ++pass)
+                    {
+                        kernel();
+                    }
+                    auto end = std::chrono::high_resolution_clock::now();
+                    double seconds = std::chrono::duration<double>(end - start).count();
+                    return seconds > 0.0 ? static_cast<double>(passes * region_bytes) / seconds / 1e9 : 0.0;
+                };
+
+                results.region_mul_gbps = measure_gbps([&]
+                                                       { galois_region::multiply_region(field, c, src, dst); });
+                results.region_mul_add_gbps = measure_gbps([&]
+                                                           { galois_region::mul_add_region(field, c, src, dst); });
+                results.region_xor_gbps = measure_gbps([&]
+                                                       { galois_region::xor_region(src, dst); });
+            }
+
             return results;
         }
 
@@ -264,6 +305,13 @@ namespace ecc
             std::cout << "Division:       " << results.div_time_ns << " ns/op\n";
             std::cout << "Inverse:        " << results.inv_time_ns << " ns/op\n";
             std::cout << "Exponentiation: " << results.exp_time_ns << " ns/op\n";
+            if (results.region_bytes > 0)
+            {
+                std::cout << "Region size:    " << results.region_bytes << " bytes\n";
+                std::cout << "Region mul:     " << results.region_mul_gbps << " GB/s\n";
+                std::cout << "Region mul-add: " << results.region_mul_add_gbps << " GB/s\n";
+                std::cout << "Region xor:     " << results.region_xor_gbps << " GB/s\n";
+            }
             std::cout << std::string(40, '=') << "\n";
         }
 
@@ -586,6 +634,7 @@ namespace ecc
     template class GaloisField<8>;
     template class GaloisField<10>;
     template class GaloisField<12>;
+    template class GaloisField<16>;
 
     template class GFPolynomial<3>;
     template class GFPolynomial<4>;
@@ -595,5 +644,6 @@ namespace ecc
     template class GFPolynomial<8>;
     template class GFPolynomial<10>;
     template class GFPolynomial<12>;
+    template class GFPolynomial<16>;
 
 } // namespace ecc
@@ -1,6 +1,7 @@
-#include <iostream>
+#include "ecc/ldpc_code.hpp"
 
 namespace ecc
 {
-    // Additional advanced ECC implementations
+    // Implementation details for LDPC codes
+    // Currently using header-only design
 }
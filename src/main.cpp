@@ -1,11 +1,16 @@
 #include "ecc/hamming_code.hpp"
 #include "ecc/reed_solomon.hpp"
 #include "ecc/performance_analyzer.hpp"
+#include "ecc/stream_codec.hpp"
+#include "ecc/thread_pool.hpp"
 #include <iostream>
 #include <string>
 #include <vector>
 #include <map>
 #include <functional>
+#include <memory>
+#include <algorithm>
+#include <chrono>
 
 namespace ecc
 {
@@ -16,6 +21,7 @@ namespace ecc
     private:
         std::map<std::string, std::function<void(const std::vector<std::string> &)>> commands;
         PerformanceAnalyzer analyzer;
+        std::unique_ptr<WorkStealingPool> pool; // Created by --threads N for N != 1
 
     public:
         CLI()
@@ -54,6 +60,16 @@ namespace ecc
         }
 
     private:
+        /// Pool of `threads` workers (0 = all cores) for the analyzer and streaming codecs; 1 keeps
+        /// all work on this thread
+        void use_threads(size_t threads)
+        {
+            if (threads == 1)
+                return;
+            pool = std::make_unique<WorkStealingPool>(threads);
+            analyzer.set_pool(*pool);
+        }
+
         void register_commands()
         {
             commands["help"] = [this](const auto &)
@@ -85,10 +101,108 @@ namespace ecc
             std::cout << "  ecc_demo encode --code hamming --n 7 --k 4 --data \"1011\"\n";
             std::cout << "  ecc_demo analyze --code hamming --snr 0:10:1 --iterations 1000\n";
             std::cout << "  ecc_demo compare --codes hamming,rs --snr 5\n";
+            std::cout << "  ecc_demo analyze --code rs --threads 0 --seed 42   (0 = all cores)\n";
+            std::cout << "  ecc_demo encode --code rs --n 255 --k 223 --input data.bin --output data.ecc --threads 0\n";
+            std::cout << "  ecc_demo decode --code bch --n 255 --t 8 --input data.ecc --output data.bin --chunk-size 1048576\n";
+            std::cout << "\nStreaming file codes: rs (255,223) (255,239) (255,191), bch n=255 t=8, bch n=1023 t=10\n";
+        }
+
+        [[nodiscard]] static bool has_option(const std::vector<std::string> &args, const std::string &name)
+        {
+            return std::find(args.begin(), args.end(), name) != args.end();
+        }
+
+        /// Streaming file mode of encode/decode, selected by --input
+        void stream_command(bool encoding, const std::vector<std::string> &args)
+        {
+            std::string code_type = "rs";
+            size_t n = 255, k = 223, t = 8;
+            size_t chunk_bytes = size_t{1} << 20;
+            std::string input, output;
+
+            // Parse arguments
+            for (size_t i = 1; i < args.size(); i += 2)
+            {
+                if (i + 1 < args.size())
+                {
+                    if (args[i] == "--code")
+                        code_type = args[i + 1];
+                    else if (args[i] == "--n")
+                        n = std::stoul(args[i + 1]);
+                    else if (args[i] == "--k")
+                        k = std::stoul(args[i + 1]);
+                    else if (args[i] == "--t")
+                        t = std::stoul(args[i + 1]);
+                    else if (args[i] == "--input")
+                        input = args[i + 1];
+                    else if (args[i] == "--output")
+                        output = args[i + 1];
+                    else if (args[i] == "--threads")
+                        use_threads(std::stoul(args[i + 1]));
+                    else if (args[i] == "--chunk-size")
+                        chunk_bytes = std::stoul(args[i + 1]);
+                }
+            }
+
+            if (input.empty() || output.empty())
+            {
+                std::cerr << "Streaming mode needs both --input and --output\n";
+                return;
+            }
+
+            auto run = [&]<typename Codec>()
+            {
+                stream_file<Codec>(encoding, input, output, chunk_bytes);
+            };
+
+            if (code_type == "rs" && n == 255 && k == 223)
+                run.template operator()<ReedSolomonStreamCodec<RS_255_223>>();
+            else if (code_type == "rs" && n == 255 && k == 239)
+                run.template operator()<ReedSolomonStreamCodec<RS_255_239>>();
+            else if (code_type == "rs" && n == 255 && k == 191)
+                run.template operator()<ReedSolomonStreamCodec<RS_255_191>>();
+            else if (code_type == "bch" && n == 255 && t == 8)
+                run.template operator()<BCHStreamCodec<BCHCode<8, 8>>>();
+            else if (code_type == "bch" && n == 1023 && t == 10)
+                run.template operator()<BCHStreamCodec<BCHCode<10, 10>>>();
+            else
+                std::cerr << "Unsupported code parameters for streaming\n";
+        }
+
+        template <typename Codec>
+        void stream_file(bool encoding, const std::string &input, const std::string &output,
+                         size_t chunk_bytes)
+        {
+            const StreamCodec<Codec> codec = pool ? StreamCodec<Codec>(*pool, chunk_bytes) : StreamCodec<Codec>(chunk_bytes);
+
+            const auto start = std::chrono::steady_clock::now();
+            const auto counters = encoding ? codec.encode_file(input, output) : codec.decode_file(input, output);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << (encoding ? "Encoded " : "Decoded ") << input << " -> " << output << "\n";
+            std::cout << "Chunks:            " << counters.chunks << " (" << codec.get_chunk_bytes() << " bytes, "
+                      << codec.get_threads() << " threads)\n";
+            std::cout << "Blocks:            " << counters.blocks << "\n";
+            std::cout << "Bytes in / out:    " << counters.input_bytes << " / " << counters.output_bytes << "\n";
+            if (!encoding)
+            {
+                std::cout << "Corrected blocks:  " << counters.corrected_blocks << " ("
+                          << counters.corrected_symbols << " symbols)\n";
+                std::cout << "Failed blocks:     " << counters.failed_blocks << "\n";
+                std::cout << "Damaged headers:   " << counters.damaged_headers << " (recovered)\n";
+            }
+            std::cout << "Throughput:        " << (seconds > 0.0 ? counters.input_bytes / seconds / 1e6 : 0.0)
+                      << " MB/s\n";
         }
 
         void encode_command(const std::vector<std::string> &args)
         {
+            if (has_option(args, "--input"))
+            {
+                stream_command(true, args);
+                return;
+            }
+
             std::string code_type = "hamming";
             int n = 7, k = 4;
             std::string data = "1011";
@@ -129,6 +243,12 @@ namespace ecc
 
         void decode_command(const std::vector<std::string> &args)
         {
+            if (has_option(args, "--input"))
+            {
+                stream_command(false, args);
+                return;
+            }
+
             std::string code_type = "hamming";
             int n = 7, k = 4;
             std::string received_data;
@@ -186,6 +306,10 @@ namespace ecc
                         snr_range = args[i + 1];
                     else if (args[i] == "--iterations")
                         iterations = std::stoi(args[i + 1]);
+                    else if (args[i] == "--threads")
+                        use_threads(std::stoul(args[i + 1]));
+                    else if (args[i] == "--seed")
+                        analyzer.set_seed(std::stoull(args[i + 1]));
                 }
             }
 
@@ -222,6 +346,10 @@ namespace ecc
                         snr = std::stod(args[i + 1]);
                     else if (args[i] == "--iterations")
                         iterations = std::stoi(args[i + 1]);
+                    else if (args[i] == "--threads")
+                        use_threads(std::stoul(args[i + 1]));
+                    else if (args[i] == "--seed")
+                        analyzer.set_seed(std::stoull(args[i + 1]));
                 }
             }
 
@@ -1,6 +1,7 @@
-#include <iostream>
+#include "ecc/turbo_code.hpp"
 
 namespace ecc
 {
-    // Turbo code implementation
+    // Implementation details for turbo codes
+    // Currently using header-only design
 }
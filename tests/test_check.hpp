@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+
+/// Test check that stays active in release (NDEBUG) builds, unlike assert()
+///
+/// Variadic, so conditions with template argument commas need no extra parentheses.
+#define ECC_CHECK(...)                                                                         \
+    do                                                                                         \
+    {                                                                                          \
+        if (!(__VA_ARGS__))                                                                    \
+        {                                                                                      \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #__VA_ARGS__ "\n"; \
+            std::abort();                                                                      \
+        }                                                                                      \
+    } while (false)
@@ -1,4 +1,5 @@
 #include "ecc/hamming_code.hpp"
+#include "ecc/memory_scrubber.hpp"
 #include "ecc/performance_analyzer.hpp"
 #include <iostream>
 #include <cassert>
@@ -29,8 +30,13 @@ namespace ecc::test
             test_double_error_detection();
             test_systematic_encoding();
             test_syndrome_calculation();
+            test_compile_time_tables();
             test_performance_requirements();
             test_edge_cases();
+            test_word_parallel_kernels();
+            test_batch_encode_decode();
+            test_secded_72_64();
+            test_memory_scrubber();
 
             print_results();
         }
@@ -166,6 +172,84 @@ namespace ecc::test
             std::cout << "✓\n";
         }
 
+        void test_compile_time_tables()
+        {
+            std::cout << "Testing compile-time generator and check tables... ";
+
+            // The tables are constant expressions
+            static_assert(Hamming_7_4::column_syndrome(0) == 3 && Hamming_7_4::column_syndrome(6) == 4);
+            static_assert(Hamming_7_4::generator_row(0)[0] == 0b0110001);
+            static_assert(Hamming_7_4::parity_check_row(0)[0] == 0b0011011);
+
+            check_tables<7, 4>();
+            check_tables<15, 11>();
+            check_tables<63, 57>();
+            check_tables<127, 120>();
+
+            std::cout << "✓\n";
+        }
+
+        /// G = [I_k | P] and H = [P^T | I_(n-k)] read back bit by bit: distinct non-zero columns,
+        /// G H^T = 0, and every single error's syndrome is its column
+        template <size_t n, size_t k>
+        void check_tables()
+        {
+            using Code = HammingCode<n, k>;
+            constexpr size_t r = n - k;
+            auto bit = [](const typename Code::CodeMask &row, size_t j)
+            { return (row[j / 64] >> (j % 64)) & 1; };
+
+            bool columns_ok = true;
+            std::vector<bool> seen(size_t{1} << r, false);
+            for (size_t j = 0; j < n; ++j)
+            {
+                const size_t column = Code::column_syndrome(j);
+                columns_ok = columns_ok && column != 0 && column < seen.size() && !seen[column];
+                if (column < seen.size())
+                {
+                    seen[column] = true;
+                }
+                for (size_t i = 0; i < r; ++i)
+                {
+                    columns_ok = columns_ok && bit(Code::parity_check_row(i), j) == ((column >> i) & 1);
+                }
+            }
+            assert_test(columns_ok, "H columns distinct, non-zero and matching column_syndrome");
+
+            bool generator_ok = true;
+            for (size_t j = 0; j < k; ++j)
+            {
+                const auto &row = Code::generator_row(j);
+                for (size_t c = 0; c < k; ++c)
+                {
+                    generator_ok = generator_ok && bit(row, c) == (c == j);
+                }
+                for (size_t i = 0; i < r; ++i)
+                {
+                    generator_ok = generator_ok && bit(row, k + i) == ((Code::column_syndrome(j) >> i) & 1);
+
+                    size_t product = 0;
+                    for (size_t c = 0; c < n; ++c)
+                    {
+                        product ^= bit(row, c) & bit(Code::parity_check_row(i), c);
+                    }
+                    generator_ok = generator_ok && product == 0;
+                }
+            }
+            assert_test(generator_ok, "G systematic and orthogonal to H");
+
+            Code code;
+            bool syndromes_ok = true;
+            for (size_t pos = 0; pos < n; ++pos)
+            {
+                typename Code::CodeWord error;
+                error.set(pos);
+                syndromes_ok = syndromes_ok && code.calculate_syndrome(error).to_ulong() == Code::column_syndrome(pos) &&
+                               code.decode(error).none();
+            }
+            assert_test(syndromes_ok, "Single-error syndromes index the lookup table");
+        }
+
         void test_performance_requirements()
         {
             std::cout << "Testing performance requirements... ";
@@ -224,6 +308,273 @@ namespace ecc::test
             std::cout << "✓\n";
         }
 
+        void test_word_parallel_kernels()
+        {
+            std::cout << "Testing word-parallel encode/syndrome kernels... ";
+
+            // Hamming(7,4) against hand-computed codewords: data bits 0..3 are the H columns 3, 5, 6, 7
+            // and parity bit i (codeword bit 4 + i) checks the data bits whose column has bit i set
+            Hamming_7_4 small;
+            constexpr uint64_t basis[4] = {0b0110001, 0b1010010, 0b1100100, 0b1111000};
+            bool small_matches = true;
+            for (uint64_t value = 0; value < 16; ++value)
+            {
+                uint64_t expected = 0;
+                for (size_t bit = 0; bit < 4; ++bit)
+                {
+                    expected ^= ((value >> bit) & 1) ? basis[bit] : 0;
+                }
+                small_matches = small_matches && small.encode_words({value})[0] == expected &&
+                                small.encode(std::bitset<4>(value)).to_ullong() == expected;
+            }
+            assert_test(small_matches, "Hamming(7,4) encode matches hand-computed codewords");
+
+            Hamming_63_57 code;
+            std::uniform_int_distribution<uint64_t> word_dist(0, (1ull << 57) - 1);
+
+            for (int test = 0; test < 100; ++test)
+            {
+                Hamming_63_57::DataMask packed{word_dist(rng)};
+                std::bitset<57> data(packed[0]);
+
+                auto codeword = code.encode(data);
+                auto packed_codeword = code.encode_words(packed);
+                assert_test(codeword == reference_encode<63>(data), "Packed encode matches reference encoder");
+                assert_test(codeword.to_ullong() == packed_codeword[0], "Packed encode matches bitset encode");
+                assert_test(code.syndrome_words(packed_codeword) == 0, "Zero packed syndrome for valid codeword");
+
+                size_t error_pos = static_cast<size_t>(test) % 63;
+                auto received = codeword;
+                received.flip(error_pos);
+                packed_codeword[0] ^= 1ull << error_pos;
+
+                assert_test(code.calculate_syndrome(received).to_ulong() == code.syndrome_words(packed_codeword),
+                            "Packed syndrome matches bitset syndrome");
+                assert_test(code.decode(received).to_ullong() == code.decode_words(packed_codeword)[0],
+                            "Packed decode matches bitset decode");
+            }
+
+            std::cout << "✓\n";
+        }
+
+        void test_batch_encode_decode()
+        {
+            std::cout << "Testing bit-sliced batch encode/decode... ";
+
+            Hamming_15_11 code;
+            std::uniform_int_distribution<int> bit_dist(0, 1);
+            std::uniform_int_distribution<size_t> pos_dist(0, 14);
+
+            // Span sizes around the block width exercise partial blocks
+            const size_t count = 2 * Hamming_15_11::batch_width + 7;
+            std::vector<std::bitset<11>> data(count);
+            for (auto &word : data)
+            {
+                for (size_t i = 0; i < 11; ++i)
+                {
+                    word[i] = bit_dist(rng);
+                }
+            }
+
+            std::vector<std::bitset<15>> codewords(count);
+            code.encode(std::span<const std::bitset<11>>(data), std::span<std::bitset<15>>(codewords));
+
+            bool encode_matches = true;
+            for (size_t i = 0; i < count; ++i)
+            {
+                encode_matches &= (codewords[i] == code.encode(data[i]));
+                codewords[i].flip(pos_dist(rng));
+            }
+            assert_test(encode_matches, "Batch encode matches scalar encode");
+
+            std::vector<std::bitset<11>> decoded(count);
+            size_t corrected = code.decode(std::span<const std::bitset<15>>(codewords),
+                                           std::span<std::bitset<11>>(decoded));
+
+            bool decode_matches = true;
+            for (size_t i = 0; i < count; ++i)
+            {
+                decode_matches &= (decoded[i] == code.decode(codewords[i]));
+            }
+            assert_test(decode_matches, "Batch decode matches scalar decode");
+            assert_test(corrected == count, "Batch decode reports corrections");
+
+            // SECDED batch path flags double errors
+            SECDED_16_11 secded;
+            std::vector<SECDED_16_11::CodeWord> received(count, secded.encode(data[0]));
+            for (auto &word : received)
+            {
+                word.flip(1);
+                word.flip(9);
+            }
+            std::vector<SECDED_16_11::SECDEDResult> results(count);
+            size_t double_errors = secded.decode_secded(std::span<const SECDED_16_11::CodeWord>(received),
+                                                        std::span<SECDED_16_11::SECDEDResult>(results));
+            assert_test(double_errors == count, "Batch SECDED double error detection");
+
+            std::cout << "✓\n";
+        }
+
+        void test_secded_72_64()
+        {
+            std::cout << "Testing SECDED(72,64) word kernel... ";
+
+            std::uniform_int_distribution<uint64_t> word_dist;
+            const uint64_t data = word_dist(rng);
+            const uint8_t check = SECDED72::encode(data);
+            assert_test(SECDED72::encode(0) == 0 && SECDED72::syndrome(data, check) == 0, "Codewords have zero syndrome");
+
+            // Every single-bit error is corrected and located
+            bool singles = true;
+            for (size_t bit = 0; bit < SECDED72::code_length; ++bit)
+            {
+                uint64_t stored = data;
+                uint8_t stored_check = check;
+                if (bit < 64)
+                    stored ^= 1ull << bit;
+                else
+                    stored_check ^= static_cast<uint8_t>(1u << (bit - 64));
+
+                const auto result = SECDED72::decode(stored, stored_check);
+                singles &= result.status == SECDED72::Status::SINGLE_ERROR_CORRECTED &&
+                           result.error_position == bit && result.data == data && result.check == check;
+            }
+            assert_test(singles, "SECDED(72,64) single error correction");
+
+            // Every double-bit error is detected
+            bool doubles = true;
+            for (size_t a = 0; a < SECDED72::code_length; ++a)
+            {
+                for (size_t b = a + 1; b < SECDED72::code_length; ++b)
+                {
+                    uint64_t stored = data;
+                    uint8_t stored_check = check;
+                    for (size_t bit : {a, b})
+                    {
+                        if (bit < 64)
+                            stored ^= 1ull << bit;
+                        else
+                            stored_check ^= static_cast<uint8_t>(1u << (bit - 64));
+                    }
+                    doubles &= SECDED72::decode(stored, stored_check).status == SECDED72::Status::DOUBLE_ERROR_DETECTED;
+                }
+            }
+            assert_test(doubles, "SECDED(72,64) double error detection");
+
+            // Bulk arrays: one single and one double error
+            std::vector<uint64_t> words(1000);
+            for (auto &word : words)
+            {
+                word = word_dist(rng);
+            }
+            const auto original = words;
+            std::vector<uint8_t> checks(words.size());
+            SECDED72::encode(words, checks);
+            assert_test(checks[17] == SECDED72::encode(words[17]), "Bulk encode matches word encode");
+
+            words[3] ^= 1ull << 40;
+            words[500] ^= 0x3;
+            const auto counts = SECDED72::decode(words, checks);
+            assert_test(counts.corrected == 1 && counts.double_errors == 1 && counts.uncorrectable == 0,
+                        "Bulk decode counts");
+            assert_test(words[3] == original[3] && words[500] != original[500], "Bulk decode corrects in place");
+
+            std::cout << "✓\n";
+        }
+
+        void test_memory_scrubber()
+        {
+            std::cout << "Testing SECDED memory scrubber... ";
+
+            std::uniform_int_distribution<uint64_t> word_dist;
+            std::vector<uint64_t> words(10000 + 3); // Partial last cache line
+            for (auto &word : words)
+            {
+                word = word_dist(rng);
+            }
+            const auto original = words;
+            std::vector<uint8_t> checks(words.size());
+
+            MemoryScrubber scrubber(words, checks);
+            scrubber.protect();
+
+            words[0] ^= 1ull << 5;
+            words[4321] ^= 1ull << 63;
+            checks[10002] ^= 0x10;
+            words[777] ^= 0x81;
+
+            scrubber.scrub_pass();
+            auto counters = scrubber.get_counters();
+            assert_test(counters.words_scanned == words.size() && counters.passes == 1, "Scrubber scans every word");
+            assert_test(counters.corrected == 3 && counters.double_errors == 1, "Scrubber counts");
+            assert_test(words[0] == original[0] && words[4321] == original[4321] &&
+                            checks[10002] == SECDED72::encode(words[10002]),
+                        "Scrubber corrects in place");
+
+            const auto events = scrubber.drain_events();
+            assert_test(events.size() == 1 && events[0].word_index == 777 && events[0].address == &words[777] &&
+                            events[0].status == SECDED72::Status::DOUBLE_ERROR_DETECTED,
+                        "Scrubber logs double errors with addresses");
+
+            // Background threads under a rate limit
+            words[777] = original[777];
+            scrubber.protect();
+            words[9000] ^= 1ull << 1;
+            scrubber.set_threads(2);
+            scrubber.set_rate_limit(50e6);
+            scrubber.start();
+            bool threw = false;
+            try
+            {
+                scrubber.set_threads(4);
+            }
+            catch (const std::logic_error &)
+            {
+                threw = true;
+            }
+            assert_test(threw, "Scrubber settings are fixed while running");
+
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (scrubber.get_counters().passes < 3 && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            scrubber.stop();
+
+            counters = scrubber.get_counters();
+            assert_test(counters.passes >= 3 && counters.corrected == 4, "Background scrubbing");
+            assert_test(words == original && !scrubber.running(), "Background scrubber stops cleanly");
+
+            std::cout << "✓\n";
+        }
+
+        /// Bit-by-bit systematic encoder written from the code's definition, independent of the
+        /// packed tables: data bit j is the j-th H column that is not a power of two, and parity bit
+        /// i is the XOR of the data bits whose column has bit i set
+        template <size_t n, size_t k>
+        static std::bitset<n> reference_encode(const std::bitset<k> &data)
+        {
+            std::bitset<n> codeword;
+            size_t column = 2;
+            for (size_t j = 0; j < k; ++j)
+            {
+                do
+                {
+                    ++column;
+                } while ((column & (column - 1)) == 0);
+
+                codeword[j] = data[j];
+                for (size_t i = 0; i < n - k; ++i)
+                {
+                    if (data[j] && ((column >> i) & 1))
+                    {
+                        codeword.flip(k + i);
+                    }
+                }
+            }
+            return codeword;
+        }
+
         void assert_test(bool condition, const std::string &test_name)
         {
             total_tests++;
@@ -1,11 +1,1552 @@
+#include "ecc/hamming_code.hpp"
+#include "ecc/reed_solomon.hpp"
+#include "ecc/bch_code.hpp"
+#include "ecc/ldpc_code.hpp"
+#include "ecc/turbo_code.hpp"
+#include "ecc/decoder_stats.hpp"
+#include "ecc/batch_codec.hpp"
+#include "ecc/spsc_ring.hpp"
+#include "ecc/concatenated_code.hpp"
+#include "ecc/packed_codewords.hpp"
+#include "ecc/performance_analyzer.hpp"
+#include "../benchmarks/ber_analysis.cpp"
+#include "test_check.hpp"
 #include <iostream>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <future>
+#include <filesystem>
 
 namespace ecc::test
 {
 
+    void test_rng_streams()
+    {
+        std::cout << "Testing counter-based RNG streams..." << std::endl;
+
+        Xoshiro256 a(42, 7), b(42, 7), c(42, 8), d(43, 7);
+        bool differs_by_stream = false;
+        bool differs_by_seed = false;
+        for (int i = 0; i < 64; ++i)
+        {
+            const auto value = a();
+            ECC_CHECK(value == b());
+            differs_by_stream |= value != c();
+            differs_by_seed |= value != d();
+        }
+        ECC_CHECK(differs_by_stream && differs_by_seed);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            const double u = a.uniform();
+            ECC_CHECK(u >= 0.0 && u < 1.0);
+        }
+
+        std::cout << "✓ Counter-based RNG stream test passed" << std::endl;
+    }
+
+    void test_parallel_monte_carlo()
+    {
+        std::cout << "Testing parallel Monte Carlo determinism..." << std::endl;
+
+        // Partial last chunk on purpose
+        const size_t iterations = 5 * PerformanceAnalyzer::chunk_iterations + 37;
+
+        PerformanceAnalyzer serial(1234);
+        const auto reference = serial.analyze_performance<Hamming_7_4>(ChannelType::BSC, 0.05, iterations);
+        ECC_CHECK(reference.total_blocks == iterations);
+        ECC_CHECK(reference.total_bits == iterations * Hamming_7_4::code_length);
+        ECC_CHECK(reference.error_bits > 0 && reference.error_blocks > 0);
+        ECC_CHECK(reference.error_blocks < reference.total_blocks);
+
+        for (size_t threads : {2u, 3u, 8u})
+        {
+            WorkStealingPool pool(threads);
+            PerformanceAnalyzer parallel(1234);
+            parallel.set_pool(pool);
+            const auto metrics = parallel.analyze_performance<Hamming_7_4>(ChannelType::BSC, 0.05, iterations);
+            ECC_CHECK(metrics.error_bits == reference.error_bits);
+            ECC_CHECK(metrics.error_blocks == reference.error_blocks);
+            ECC_CHECK(metrics.bit_error_rate == reference.bit_error_rate);
+            ECC_CHECK(metrics.block_error_rate == reference.block_error_rate);
+        }
+
+        // A different seed gives a different sample
+        PerformanceAnalyzer other(4321);
+        const auto resampled = other.analyze_performance<Hamming_7_4>(ChannelType::BSC, 0.05, iterations);
+        ECC_CHECK(resampled.error_bits != reference.error_bits || resampled.error_blocks != reference.error_blocks);
+
+        // Symbol codes with struct decode results go through the same engine
+        WorkStealingPool pool(2);
+        PerformanceAnalyzer rs(99);
+        rs.set_pool(pool);
+        const auto clean = rs.analyze_performance<RS_255_223>(ChannelType::BSC, 0.0, 300);
+        ECC_CHECK(clean.total_blocks == 300 && clean.error_bits == 0 && clean.error_blocks == 0);
+
+        const auto empty = serial.analyze_performance<Hamming_7_4>(ChannelType::BSC, 0.05, 0);
+        ECC_CHECK(empty.total_blocks == 0);
+
+        std::cout << "✓ Parallel Monte Carlo determinism test passed" << std::endl;
+    }
+
+    void test_batched_timing()
+    {
+        std::cout << "Testing batched latency instrumentation..." << std::endl;
+
+        ECC_CHECK(detail::timer_overhead_ns() >= 0.0);
+
+        std::vector<double> samples{5, 1, 4, 2, 3, 10, 9, 8, 7, 6};
+        ECC_CHECK(detail::percentile(samples, 0.5) == 5);
+        ECC_CHECK(detail::percentile(samples, 0.99) == 10);
+        ECC_CHECK(detail::percentile(samples, 0.0) == 1);
+
+        WorkStealingPool pool(2);
+        PerformanceAnalyzer analyzer(77);
+        analyzer.set_pool(pool);
+        analyzer.set_timing_batch(0);
+        ECC_CHECK(analyzer.get_timing_batch() == 1);
+        analyzer.set_timing_batch(1u << 20);
+        ECC_CHECK(analyzer.get_timing_batch() == PerformanceAnalyzer::chunk_iterations);
+
+        // The sample does not depend on how operations are grouped for timing
+        analyzer.set_timing_batch(1);
+        const auto single = analyzer.analyze_performance<Hamming_15_11>(ChannelType::AWGN, 4.0, 1500);
+        analyzer.set_timing_batch(64);
+        const auto batched = analyzer.analyze_performance<Hamming_15_11>(ChannelType::AWGN, 4.0, 1500);
+        ECC_CHECK(single.error_bits == batched.error_bits);
+        ECC_CHECK(single.error_blocks == batched.error_blocks);
+
+        for (const auto &latency : {batched.encode_latency, batched.decode_latency})
+        {
+            ECC_CHECK(latency.p50_ns >= 0.0);
+            ECC_CHECK(latency.p50_ns <= latency.p99_ns && latency.p99_ns <= latency.p999_ns);
+        }
+        ECC_CHECK(batched.encoding_time_ms >= 0.0 && batched.decoding_time_ms >= 0.0);
+
+        std::cout << "✓ Batched latency instrumentation test passed" << std::endl;
+    }
+
+    void test_in_place_channels()
+    {
+        std::cout << "Testing in-place and batched channel models..." << std::endl;
+
+        const size_t length = 63;
+        const size_t count = 40;
+        std::vector<uint8_t> clean(length * count);
+        for (size_t i = 0; i < clean.size(); ++i)
+        {
+            clean[i] = static_cast<uint8_t>((i * 7) % 3 == 0);
+        }
+
+        for (auto type : {ErrorType::RANDOM, ErrorType::BURST, ErrorType::CLUSTERED,
+                          ErrorType::ERASURE, ErrorType::FADING, ErrorType::PERIODIC})
+        {
+            ErrorParameters params;
+            params.probability = (type == ErrorType::FADING || type == ErrorType::PERIODIC) ? 3.0 : 0.3;
+
+            // Copying wrapper, per-codeword in-place calls and one batched call see the same stream
+            ErrorSimulator copying, in_place, batched;
+            copying.create_channel(type, params);
+            in_place.create_channel(type, params);
+            batched.create_channel(type, params);
+
+            std::vector<uint8_t> expected;
+            std::vector<uint8_t> single = clean;
+            for (size_t c = 0; c < count; ++c)
+            {
+                std::vector<uint8_t> word(clean.begin() + c * length, clean.begin() + (c + 1) * length);
+                auto corrupted = copying.apply_errors(word);
+                expected.insert(expected.end(), corrupted.begin(), corrupted.end());
+                in_place.apply_errors(std::span<uint8_t>(single).subspan(c * length, length));
+            }
+
+            std::vector<uint8_t> batch = clean;
+            batched.apply_errors_batch(batch, length);
+
+            ECC_CHECK(single == expected);
+            ECC_CHECK(batch == expected);
+            if (type != ErrorType::BURST)
+            {
+                ECC_CHECK(batch != clean);
+            }
+        }
+
+        ErrorSimulator simulator;
+        simulator.create_channel(ErrorType::RANDOM);
+        std::vector<uint8_t> odd(length + 1);
+        bool threw = false;
+        try
+        {
+            simulator.apply_errors_batch(odd, length);
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        ECC_CHECK(threw);
+
+        std::vector<uint8_t> word(8, 0);
+        const std::vector<uint8_t> pattern{1, 0, 0, 1, 0, 0, 0, 1};
+        simulator.apply_error_pattern(std::span<uint8_t>(word), pattern);
+        ECC_CHECK(word == pattern);
+
+        std::cout << "✓ In-place and batched channel model test passed" << std::endl;
+    }
+
+    void test_geometric_skip_sampling()
+    {
+        std::cout << "Testing geometric skip sampling..." << std::endl;
+
+        // Event count matches Bernoulli(p) within 5 sigma
+        const size_t bits = 2000000;
+        const double p = 0.01;
+        Xoshiro256 rng(5);
+        GeometricSkipSampler sampler(p);
+        size_t events = 0;
+        sampler.for_each_event(bits, rng, [&](size_t)
+                               { ++events; });
+        const double sigma = std::sqrt(bits * p * (1 - p));
+        ECC_CHECK(std::abs(static_cast<double>(events) - bits * p) < 5 * sigma);
+
+        // Gaps carry across calls: 7-bit pieces see the same event positions as one long stream
+        std::vector<size_t> whole, pieces;
+        Xoshiro256 a(9), b(9);
+        GeometricSkipSampler one(0.05), many(0.05);
+        one.for_each_event(7 * 1000, a, [&](size_t i)
+                           { whole.push_back(i); });
+        for (size_t word = 0; word < 1000; ++word)
+        {
+            many.for_each_event(7, b, [&](size_t i)
+                                { pieces.push_back(word * 7 + i); });
+        }
+        ECC_CHECK(!whole.empty() && whole == pieces);
+
+        // Degenerate probabilities
+        GeometricSkipSampler never(0.0), always(1.0);
+        size_t hits = 0;
+        never.for_each_event(1000, rng, [&](size_t)
+                             { ++hits; });
+        ECC_CHECK(hits == 0);
+        always.for_each_event(1000, rng, [&](size_t)
+                              { ++hits; });
+        ECC_CHECK(hits == 1000);
+
+        // Skip-sampled channels keep the batch/single equivalence and the error rate
+        for (auto type : {ErrorType::RANDOM, ErrorType::ERASURE})
+        {
+            ErrorParameters params;
+            params.probability = 1e-3;
+            params.skip_sampling = true;
+
+            ErrorSimulator single, batched;
+            single.create_channel(type, params);
+            batched.create_channel(type, params);
+
+            std::vector<uint8_t> words(7 * 100000, 0), expected = words;
+            for (size_t offset = 0; offset < expected.size(); offset += 7)
+            {
+                single.apply_errors(std::span<uint8_t>(expected).subspan(offset, 7));
+            }
+            batched.apply_errors_batch(words, 7);
+            ECC_CHECK(words == expected);
+
+            const auto corrupted = static_cast<double>(words.size() - std::count(words.begin(), words.end(), 0));
+            const double mean = words.size() * params.probability;
+            ECC_CHECK(std::abs(corrupted - mean) < 5 * std::sqrt(mean));
+        }
+
+        // The analyzer's BSC path uses the same sampler
+        WorkStealingPool pool(2);
+        PerformanceAnalyzer analyzer(11);
+        analyzer.set_pool(pool);
+        const auto metrics = analyzer.analyze_performance<Hamming_7_4>(ChannelType::BSC, 0.02, 20000);
+        const double expected_errors = metrics.total_bits * 0.02;
+        ECC_CHECK(std::abs(metrics.error_bits - expected_errors) < 5 * std::sqrt(expected_errors));
+        const auto quiet = analyzer.analyze_performance<Hamming_7_4>(ChannelType::BSC, 1e-6, 20000);
+        ECC_CHECK(quiet.error_bits < 10);
+
+        std::cout << "✓ Geometric skip sampling test passed" << std::endl;
+    }
+
+    void test_gaussian_noise()
+    {
+        std::cout << "Testing bulk Gaussian noise generator..." << std::endl;
+
+        for (float u : {1e-9f, 1e-3f, 0.25f, 0.5f, 0.7071f, 0.999f, 1.0f})
+        {
+            ECC_CHECK(std::abs(detail::fast_log(u) - std::log(u)) < 1e-5f * std::max(1.0f, std::abs(std::log(u))));
+        }
+        for (float t = 0.0f; t < 1.0f; t += 1.0f / 97)
+        {
+            float sine, cosine;
+            detail::fast_sincos_2pi(t, sine, cosine);
+            ECC_CHECK(std::abs(sine - std::sin(6.283185307f * t)) < 1e-5f);
+            ECC_CHECK(std::abs(cosine - std::cos(6.283185307f * t)) < 1e-5f);
+        }
+
+        // Moments and a two-sided tail of N(0, sigma^2); odd length exercises the partial block
+        const float sigma = 0.5f;
+        std::vector<float> samples(1000003);
+        GaussianNoise noise(2024);
+        noise.fill(samples, sigma);
+
+        double mean = 0.0, variance = 0.0;
+        size_t beyond_two_sigma = 0;
+        for (float x : samples)
+        {
+            mean += x;
+            variance += static_cast<double>(x) * x;
+            beyond_two_sigma += std::abs(x) > 2 * sigma;
+        }
+        mean /= samples.size();
+        variance /= samples.size();
+        ECC_CHECK(std::abs(mean) < 5 * sigma / std::sqrt(samples.size()));
+        ECC_CHECK(std::abs(variance / (sigma * sigma) - 1.0) < 0.01);
+        const double tail = static_cast<double>(beyond_two_sigma) / samples.size();
+        ECC_CHECK(std::abs(tail - 0.0455) < 0.002);
+
+        // Same seed, same noise
+        std::vector<float> again(samples.size());
+        GaussianNoise(2024).fill(again, sigma);
+        ECC_CHECK(again == samples);
+
+        // Uncoded BPSK at 4 dB: BER = Q(sqrt(2 * 10^0.4)) ~ 0.0125, through every AWGN path
+        const double expected_ber = 0.5 * std::erfc(std::sqrt(std::pow(10.0, 0.4)));
+        std::vector<uint8_t> bits(400000, 0);
+        GaussianNoise(7).bpsk_hard_decision(bits, GaussianNoise::sigma_from_snr_db(4.0));
+        const double direct = static_cast<double>(std::count(bits.begin(), bits.end(), 1)) / bits.size();
+        ECC_CHECK(std::abs(direct - expected_ber) < 0.001);
+
+        ErrorParameters params;
+        params.probability = 4.0;
+        AWGNChannel channel(params);
+        std::vector<uint8_t> words(400000, 1);
+        channel.apply_errors_batch(words, 100);
+        const double channel_ber = static_cast<double>(std::count(words.begin(), words.end(), 0)) / words.size();
+        ECC_CHECK(std::abs(channel_ber - expected_ber) < 0.001);
+
+        // Soft output draws the same noise: nonzero LLRs carry the hard decisions in their signs
+        const std::vector<uint8_t> ones(words.size(), 1);
+        std::vector<uint8_t> decided = ones;
+        AWGNChannel(params).apply_errors(std::span<uint8_t>(decided));
+        std::vector<int8_t> llrs(ones.size());
+        AWGNChannel(params).apply_soft(ones, llrs);
+        size_t disagreements = 0;
+        for (size_t i = 0; i < ones.size(); ++i)
+        {
+            disagreements += llrs[i] != 0 && (llrs[i] > 0) != (decided[i] == 0);
+        }
+        ECC_CHECK(disagreements == 0);
+
+        WorkStealingPool pool(2);
+        PerformanceAnalyzer analyzer(3);
+        analyzer.set_pool(pool);
+        const auto metrics = analyzer.analyze_performance<Hamming_15_11>(ChannelType::AWGN, 4.0, 20000);
+        ECC_CHECK(std::abs(metrics.bit_error_rate - expected_ber) < 0.001);
+
+        std::cout << "✓ Bulk Gaussian noise generator test passed" << std::endl;
+    }
+
+    void test_packed_codewords()
+    {
+        std::cout << "Testing bit-packed codeword buffers..." << std::endl;
+
+        // Bitset round trip across word boundaries, with tail bits kept clear
+        std::bitset<130> wide;
+        wide.set(0).set(63).set(64).set(129);
+        PackedCodewords packed_wide(130, 2);
+        packed_wide.store(1, wide);
+        ECC_CHECK(packed_wide.words_per_codeword() == 3);
+        ECC_CHECK(packed_wide.load<130>(1) == wide);
+        ECC_CHECK(packed_wide.get(1, 64) && !packed_wide.get(0, 64));
+        packed_wide.flip(0, 5);
+        ECC_CHECK(packed_wide.count_differences(PackedCodewords(130, 2)) == 5);
+
+        // Bit fields straddling a word boundary, and byte-per-bit round trips
+        packed_wide.set_bits(1, 60, 10, 0x2A5);
+        ECC_CHECK(packed_wide.get_bits(1, 60, 10) == 0x2A5);
+        ECC_CHECK(packed_wide.get(1, 63) == ((0x2A5 >> 3) & 1) && packed_wide.get(1, 129));
+        std::vector<uint8_t> unpacked(130);
+        packed_wide.load_bits(1, unpacked);
+        packed_wide.store_bits(0, unpacked);
+        ECC_CHECK(packed_wide.load<130>(0) == packed_wide.load<130>(1));
+
+        // Every channel gives the same bits on packed words as on byte symbols
+        const size_t length = 63;
+        const size_t count = 40;
+        std::vector<uint8_t> clean(length * count);
+        PackedCodewords packed_clean(length, count);
+        for (size_t i = 0; i < clean.size(); ++i)
+        {
+            clean[i] = static_cast<uint8_t>((i * 7) % 3 == 0);
+            packed_clean.set(i / length, i % length, clean[i]);
+        }
+
+        for (auto type : {ErrorType::RANDOM, ErrorType::BURST, ErrorType::CLUSTERED,
+                          ErrorType::ERASURE, ErrorType::FADING, ErrorType::PERIODIC})
+        {
+            ErrorParameters params;
+            params.probability = (type == ErrorType::FADING || type == ErrorType::PERIODIC) ? 3.0 : 0.3;
+
+            ErrorSimulator bytes, packed;
+            bytes.create_channel(type, params);
+            packed.create_channel(type, params);
+
+            std::vector<uint8_t> batch = clean;
+            bytes.apply_errors_batch(batch, length);
+            PackedCodewords words = packed_clean;
+            packed.apply_errors(words);
+
+            for (size_t i = 0; i < batch.size(); ++i)
+            {
+                // Packed bits have no erasure symbol: erased positions read as 0
+                const bool expected = batch[i] == 1;
+                ECC_CHECK(words.get(i / length, i % length) == expected);
+            }
+
+            // Popcount statistics agree with the byte-by-byte count
+            for (size_t i = 0; i < batch.size(); ++i)
+            {
+                batch[i] = batch[i] == 1;
+            }
+            const auto byte_stats = bytes.analyze_errors(clean, batch);
+            const auto packed_stats = packed.analyze_errors(packed_clean, words);
+            ECC_CHECK(packed_stats.total_bits == byte_stats.total_bits);
+            ECC_CHECK(packed_stats.error_bits == byte_stats.error_bits);
+            ECC_CHECK(packed_stats.error_positions == byte_stats.error_positions);
+            ECC_CHECK(packed_stats.error_blocks <= count);
+        }
+
+        // Packed batch codec APIs match the bitset paths
+        using Hamming_15_11 = HammingCode<15, 11>;
+        Hamming_15_11 hamming;
+        std::vector<Hamming_15_11::DataWord> data(100);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = Hamming_15_11::DataWord((i * 0x9E3779B9u) & 0x7FF);
+        }
+
+        PackedCodewords packed_data = PackedCodewords::pack<11>(data);
+        PackedCodewords packed_code;
+        hamming.encode(packed_data, packed_code);
+        const auto codewords = hamming.encode(std::span<const Hamming_15_11::DataWord>(data));
+        ECC_CHECK(packed_code.size() == data.size() && packed_code.codeword_length() == 15);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            ECC_CHECK(packed_code.load<15>(i) == codewords[i]);
+            packed_code.flip(i, i % 15);
+        }
+
+        PackedCodewords packed_decoded;
+        ECC_CHECK(hamming.decode(packed_code, packed_decoded) == data.size());
+        ECC_CHECK(packed_decoded.count_differences(packed_data) == 0);
+
+        BCHCode<6, 2> bch;
+        PackedCodewords bch_data(BCHCode<6, 2>::data_length, 10);
+        for (size_t i = 0; i < bch_data.size(); ++i)
+        {
+            bch_data.set(i, i, true);
+        }
+        PackedCodewords bch_code;
+        bch.encode(bch_data, bch_code);
+        for (size_t i = 0; i < bch_code.size(); ++i)
+        {
+            ECC_CHECK(bch_code.load<63>(i) == bch.encode(bch_data.load<BCHCode<6, 2>::data_length>(i)));
+            bch_code.flip(i, 3);
+            bch_code.flip(i, 40);
+        }
+        PackedCodewords bch_decoded;
+        ECC_CHECK(bch.decode(bch_code, bch_decoded) == 0);
+        ECC_CHECK(bch_decoded.count_differences(bch_data) == 0);
+
+        // Beyond t errors: the word is reported and its data passed through uncorrected
+        PackedCodewords bch_noisy = bch_code;
+        bch_noisy.flip(0, 10);
+        bch_noisy.flip(0, 20);
+        bch_noisy.flip(0, 30);
+        const auto bch_expected = bch.decode(bch_noisy.load<63>(0));
+        ECC_CHECK(bch.decode(bch_noisy, bch_decoded) == (bch_expected.success ? 0u : 1u));
+        ECC_CHECK((bch_decoded.load<BCHCode<6, 2>::data_length>(0) == bch_expected.data));
+
+        // Reed-Solomon: m-bit symbol fields, via the batched encoder (GF(2^8)) and word by word (GF(2^4))
+        RS_255_223 rs;
+        PackedCodewords rs_data(223 * 8, 40);
+        for (size_t i = 0; i < rs_data.size(); ++i)
+        {
+            for (size_t j = 0; j < 223; ++j)
+            {
+                rs_data.set_bits(i, j * 8, 8, (i * 31 + j * 7) & 0xFF);
+            }
+        }
+        PackedCodewords rs_code;
+        rs.encode(rs_data, rs_code);
+        ECC_CHECK(rs_code.codeword_length() == 255 * 8);
+        for (size_t i = 0; i < rs_code.size(); ++i)
+        {
+            RS_255_223::DataWord message;
+            for (size_t j = 0; j < 223; ++j)
+            {
+                message[j] = static_cast<uint32_t>(rs_data.get_bits(i, j * 8, 8));
+            }
+            const auto expected = rs.encode(message);
+            for (size_t j = 0; j < 255; ++j)
+            {
+                ECC_CHECK(rs_code.get_bits(i, j * 8, 8) == expected[j]);
+            }
+            for (size_t e = 0; e < i % 17; ++e)
+            {
+                rs_code.flip(i, (e * 113 + i) % (255 * 8));
+            }
+        }
+        PackedCodewords rs_decoded;
+        ECC_CHECK(rs.decode(rs_code, rs_decoded) == 0);
+        ECC_CHECK(rs_decoded.count_differences(rs_data) == 0);
+
+        ReedSolomonCode<15, 11, 4> rs_small;
+        PackedCodewords small_data(11 * 4, 16);
+        for (size_t i = 0; i < small_data.size(); ++i)
+        {
+            small_data.set_bits(i, 0, 44, (i + 1) * 0x9E3779B97ull);
+        }
+        PackedCodewords small_code;
+        rs_small.encode(small_data, small_code);
+        for (size_t i = 0; i < small_code.size(); ++i)
+        {
+            small_code.set_bits(i, 4 * (i % 15), 4, small_code.get_bits(i, 4 * (i % 15), 4) ^ 0x9);
+            small_code.flip(i, 4 * ((i + 7) % 15) + 2);
+        }
+        PackedCodewords small_decoded;
+        ECC_CHECK(rs_small.decode(small_code, small_decoded) == 0);
+        ECC_CHECK(small_decoded.count_differences(small_data) == 0);
+
+        // LDPC and turbo: packed buffers give the bits of the byte-per-bit paths
+        LDPCCode ldpc(128, 64, 20);
+        TurboCode turbo(64);
+        PackedCodewords soft_data(64, 12);
+        for (size_t i = 0; i < soft_data.size(); ++i)
+        {
+            soft_data.set_bits(i, 0, 64, (i + 3) * 0xD1B54A32D192ED03ull);
+        }
+
+        PackedCodewords ldpc_code, turbo_code;
+        ldpc.encode(soft_data, ldpc_code);
+        turbo.encode(soft_data, turbo_code);
+        std::vector<uint8_t> message(64);
+        for (size_t i = 0; i < soft_data.size(); ++i)
+        {
+            soft_data.load_bits(i, message);
+            std::vector<uint8_t> bits(ldpc_code.codeword_length());
+            ldpc_code.load_bits(i, bits);
+            ECC_CHECK(bits == ldpc.encode(message));
+            bits.resize(turbo_code.codeword_length());
+            turbo_code.load_bits(i, bits);
+            ECC_CHECK(bits == turbo.encode(message));
+
+            ldpc_code.flip(i, (i * 11) % 128);
+            turbo_code.flip(i, (i * 29) % 192);
+        }
+
+        auto ldpc_workspace = ldpc.make_workspace();
+        PackedCodewords ldpc_decoded, turbo_decoded;
+        const size_t ldpc_failures = ldpc.decode(ldpc_code, ldpc_decoded, ldpc_workspace);
+        const size_t turbo_failures = turbo.decode(turbo_code, turbo_decoded);
+        size_t expected_ldpc_failures = 0, expected_turbo_failures = 0;
+        for (size_t i = 0; i < soft_data.size(); ++i)
+        {
+            std::vector<uint8_t> bits(128);
+            ldpc_code.load_bits(i, bits);
+            const auto ldpc_result = ldpc.decode(bits);
+            expected_ldpc_failures += !ldpc_result.success;
+            bits.resize(192);
+            turbo_code.load_bits(i, bits);
+            const auto turbo_result = turbo.decode(bits);
+            expected_turbo_failures += !turbo_result.success;
+
+            ldpc_decoded.load_bits(i, message);
+            ECC_CHECK(message == ldpc_result.data);
+            turbo_decoded.load_bits(i, message);
+            ECC_CHECK(message == turbo_result.data);
+        }
+        ECC_CHECK(ldpc_failures == expected_ldpc_failures && turbo_failures == expected_turbo_failures);
+        ECC_CHECK(ldpc_decoded.count_differences(soft_data) == 0);
+
+        bool threw = false;
+        try
+        {
+            hamming.decode(packed_data, packed_decoded);
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        ECC_CHECK(threw);
+
+        std::cout << "✓ Bit-packed codeword buffer test passed" << std::endl;
+    }
+
+    void test_exhaustive_patterns()
+    {
+        std::cout << "Testing exhaustive error pattern enumeration..." << std::endl;
+
+        // Revolving-door order: unranking agrees with stepping, each step swaps one element
+        const size_t n = 9;
+        const detail::BinomialTable binomial(n, 5);
+        for (size_t w = 1; w <= 5; ++w)
+        {
+            std::vector<size_t> c(w + 1), expected(w);
+            detail::revolving_door_unrank(binomial, n, w, 0, std::span<size_t>(c).first(w));
+            c[w] = n;
+
+            for (uint64_t rank = 1; rank < binomial(n, w); ++rank)
+            {
+                const std::vector<size_t> before(c.begin(), c.begin() + w);
+                size_t removed, added;
+                ECC_CHECK(detail::revolving_door_next(c, removed, added));
+                detail::revolving_door_unrank(binomial, n, w, rank, expected);
+                ECC_CHECK(std::equal(expected.begin(), expected.end(), c.begin()));
+                ECC_CHECK(std::is_sorted(c.begin(), c.end()));
+                ECC_CHECK(std::count(before.begin(), before.end(), removed) == 1);
+                ECC_CHECK(std::count(c.begin(), c.begin() + w, added) == 1);
+                ECC_CHECK(std::count(c.begin(), c.begin() + w, removed) == 0);
+            }
+            size_t removed, added;
+            ECC_CHECK(!detail::revolving_door_next(c, removed, added));
+        }
+
+        ErrorPatternAnalyzer analyzer;
+
+        // Hamming(7,4): singles corrected, doubles miscorrected, the 7 weight-3 codewords undetected
+        auto hamming = analyzer.enumerate_error_patterns(Hamming_7_4{}, 3);
+        ECC_CHECK(hamming[0].patterns == 7 && hamming[0].corrected == 7);
+        ECC_CHECK(hamming[1].patterns == 21 && hamming[1].miscorrected == 21);
+        ECC_CHECK(hamming[2].patterns == 35 && hamming[2].undetected == 7 && hamming[2].miscorrected == 28);
+
+        // SECDED: every double error detected
+        auto secded = analyzer.enumerate_error_patterns(SECDED_8_4{}, 2);
+        ECC_CHECK(secded[0].corrected == 8 && secded[1].detected == 28);
+        auto secded72 = analyzer.enumerate_error_patterns(SECDED72{}, 2);
+        ECC_CHECK(secded72[0].corrected == 72 && secded72[1].patterns == 2556 && secded72[1].detected == 2556);
+
+        // BCH(63,51) t=2: syndrome columns match the decoder, thread split does not change counts
+        BCHCode<6, 2> bch;
+        std::bitset<63> single;
+        single.set(40);
+        ECC_CHECK(bch.column_syndrome(40) == bch.calculate_syndromes(single));
+
+        const auto serial = analyzer.enumerate_error_patterns(bch, 3);
+        ECC_CHECK(serial[0].corrected == 63 && serial[1].corrected == 1953);
+        ECC_CHECK(serial[2].patterns == 39711 && serial[2].corrected == 0 && serial[2].undetected == 0);
+
+        uint64_t decoded_weight_3 = 0;
+        for (size_t a = 0; a < 63; ++a)
+        {
+            for (size_t b = a + 1; b < 63; ++b)
+            {
+                for (size_t c = b + 1; c < 63; ++c)
+                {
+                    std::bitset<63> pattern;
+                    pattern.set(a).set(b).set(c);
+                    decoded_weight_3 += bch.decode(pattern).success;
+                }
+            }
+        }
+        ECC_CHECK(decoded_weight_3 == serial[2].miscorrected);
+
+        WorkStealingPool pool(3);
+        analyzer.set_pool(pool);
+        const auto parallel = analyzer.enumerate_error_patterns(bch, 3);
+        for (size_t w = 0; w < 3; ++w)
+        {
+            ECC_CHECK(parallel[w].patterns == serial[w].patterns && parallel[w].corrected == serial[w].corrected &&
+                   parallel[w].detected == serial[w].detected && parallel[w].miscorrected == serial[w].miscorrected);
+        }
+
+        std::cout << "✓ Exhaustive error pattern enumeration test passed" << std::endl;
+    }
+
+    void test_simd_dispatch()
+    {
+        std::cout << "Testing runtime SIMD dispatch..." << std::endl;
+
+        ECC_CHECK(parse_simd_level("avx2") == SimdLevel::AVX2 && !parse_simd_level("mmx"));
+        ECC_CHECK(std::getenv("ECC_SIMD_LEVEL") != nullptr || active_simd_level() == detected_simd_level());
+
+        Xoshiro256 rng(2024);
+        std::vector<uint8_t> region(1000 + 13);
+        for (auto &byte : region)
+        {
+            byte = static_cast<uint8_t>(rng());
+        }
+
+        std::vector<uint16_t> region16(500 + 7);
+        for (auto &word : region16)
+        {
+            word = static_cast<uint16_t>(rng());
+        }
+
+        std::vector<Hamming_63_57::DataWord> words(300);
+        for (auto &word : words)
+        {
+            word = Hamming_63_57::DataWord(rng());
+        }
+
+        RS_255_223 rs;
+        std::vector<uint8_t> rs_data(40 * RS_255_223::data_length);
+        for (auto &byte : rs_data)
+        {
+            byte = static_cast<uint8_t>(rng());
+        }
+        std::vector<uint8_t> rs_code(40 * RS_255_223::code_length);
+        rs.encode_bytes(rs_data, rs_code);
+        rs_code[5] ^= 0x40;
+        rs_code[3 * RS_255_223::code_length + 100] ^= 0x01;
+        RS_255_223::CodeWord rs_word;
+        std::copy(rs_code.begin(), rs_code.begin() + RS_255_223::code_length, rs_word.begin());
+
+        using BCH = BCHCode<8, 4>;
+        BCH bch;
+        BCH::DataWord bch_data;
+        for (size_t i = 0; i < BCH::data_length; ++i)
+        {
+            bch_data[i] = rng() & 1;
+        }
+        auto bch_word = bch.encode(bch_data);
+        bch_word.flip(3);
+        bch_word.flip(200);
+
+        // Every kernel family must give the same output at every level
+        struct Outputs
+        {
+            std::vector<uint8_t> region;
+            std::vector<uint16_t> region16;
+            std::vector<Hamming_63_57::CodeWord> hamming;
+            std::vector<Hamming_63_57::DataWord> decoded;
+            std::vector<uint8_t> syndromes;
+            RS_255_223::Syndromes rs_syndromes;
+            BCH::Syndromes bch_syndromes;
+            std::vector<float> noise;
+
+            bool operator==(const Outputs &) const = default;
+        };
+
+        auto run = [&]
+        {
+            Outputs out;
+            out.region = region;
+            const auto &field = GF256::shared();
+            galois_region::mul_add_region(field, 0x53, std::span<const uint8_t>(region).subspan(7),
+                                          std::span<uint8_t>(out.region).first(region.size() - 7));
+            galois_region::multiply_region(field, 0x8E, out.region);
+
+            out.region16 = region16;
+            const auto &field16 = GF65536::shared();
+            galois_region::mul_add_region(field16, 0xBEEF, std::span<const uint16_t>(region16).subspan(3),
+                                          std::span<uint16_t>(out.region16).first(region16.size() - 3));
+            galois_region::multiply_region(field16, 0x0123, out.region16);
+
+            Hamming_63_57 hamming;
+            out.hamming = hamming.encode(words);
+            out.hamming[17].flip(30);
+            out.decoded.resize(words.size());
+            ECC_CHECK(hamming.decode(out.hamming, out.decoded) == 1);
+
+            out.syndromes.resize(40 * RS_255_223::parity_length);
+            rs.calculate_syndromes_bytes(rs_code, out.syndromes);
+            out.rs_syndromes = rs.calculate_syndromes(rs_word);
+            out.bch_syndromes = bch.calculate_syndromes(bch_word);
+
+            // A build with FMA enabled globally may contract the scalar noise path differently
+#if !defined(__FMA__)
+            out.noise.resize(999);
+            GaussianNoise(11).fill(out.noise, 0.7f);
+#endif
+            return out;
+        };
+
+        force_simd_level(SimdLevel::Scalar);
+        const Outputs reference = run();
+        ECC_CHECK(reference.decoded == words);
+        ECC_CHECK(std::equal(reference.rs_syndromes.begin(), reference.rs_syndromes.end(), reference.syndromes.begin()));
+        ECC_CHECK(!BCH::syndromes_zero(reference.bch_syndromes));
+        for (size_t i = 0; i + 3 < region16.size(); ++i)
+        {
+            const auto &field16 = GF65536::shared();
+            ECC_CHECK(reference.region16[i] == field16.multiply(0x0123, region16[i] ^ field16.multiply(0xBEEF, region16[i + 3])));
+        }
+
+        size_t levels = 1;
+        for (SimdLevel level : {SimdLevel::SSE42, SimdLevel::AVX2, SimdLevel::AVX512, SimdLevel::NEON})
+        {
+            if (!detail::simd_level_supported(level, detected_simd_level()))
+            {
+                bool threw = false;
+                try
+                {
+                    force_simd_level(level);
+                }
+                catch (const std::invalid_argument &)
+                {
+                    threw = true;
+                }
+                ECC_CHECK(threw);
+                continue;
+            }
+
+            force_simd_level(level);
+            ECC_CHECK(active_simd_level() == level);
+            ECC_CHECK(run() == reference);
+            ++levels;
+        }
+        reset_simd_level();
+
+        std::cout << "✓ Runtime SIMD dispatch test passed (" << levels << " levels, detected "
+                  << simd_level_name(detected_simd_level()) << ")" << std::endl;
+    }
+
+    void test_decoder_stats()
+    {
+        std::cout << "Testing decoder stats policies..." << std::endl;
+
+        // The default policy adds no state
+        static_assert(sizeof(Hamming_7_4) == 1);
+        static_assert(!NoDecoderStats::enabled && DecoderStats::enabled);
+
+        Xoshiro256 rng(77);
+
+        // Hamming: single and batch decode paths
+        HammingCode<15, 11, DecoderStats> hamming;
+        std::vector<HammingCode<15, 11, DecoderStats>::CodeWord> codewords;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            codewords.push_back(hamming.encode(HammingCode<15, 11, DecoderStats>::DataWord(rng())));
+            if (i % 4 == 0)
+                codewords.back().flip(i % 15);
+        }
+        for (const auto &codeword : codewords)
+        {
+            (void)hamming.decode(codeword);
+        }
+        std::vector<HammingCode<15, 11, DecoderStats>::DataWord> decoded(codewords.size());
+        ECC_CHECK(hamming.decode(codewords, decoded) == 25);
+
+        auto stats = hamming.get_stats().snapshot();
+        ECC_CHECK(stats.decodes == 200 && stats.nonzero_syndromes == 50);
+        ECC_CHECK(stats.corrected_words == 50 && stats.corrected_symbols == 50 && stats.failures == 0);
+
+        // Copies share one set of counters, and threads add up exactly
+        const auto copy = hamming;
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < 4; ++t)
+        {
+            workers.emplace_back([&copy, &codewords]
+                                 {
+                for (const auto &codeword : codewords)
+                {
+                    (void)copy.decode(codeword);
+                } });
+        }
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+        stats = hamming.get_stats().snapshot();
+        ECC_CHECK(stats.decodes == 600 && stats.corrected_words == 150);
+
+        SECDEDHammingCode<7, 4, DecoderStats> secded;
+        auto double_error = secded.encode(std::bitset<4>(0b1011));
+        double_error.flip(1);
+        double_error.flip(5);
+        using SECDEDStatus = SECDEDHammingCode<7, 4, DecoderStats>::SECDEDResult::Status;
+        ECC_CHECK(secded.decode_secded(double_error).status == SECDEDStatus::DOUBLE_ERROR_DETECTED);
+        ECC_CHECK(secded.get_stats().snapshot().failures == 1);
+
+        // BCH: t errors corrected, Berlekamp-Massey steps counted
+        BCHCode<6, 2, DecoderStats> bch;
+        auto bch_word = bch.encode(BCHCode<6, 2>::DataWord(rng()));
+        (void)bch.decode(bch_word);
+        bch_word.flip(3);
+        bch_word.flip(40);
+        ECC_CHECK(bch.decode(bch_word).success);
+        stats = bch.get_stats().snapshot();
+        ECC_CHECK(stats.decodes == 2 && stats.nonzero_syndromes == 1 && stats.corrected_symbols == 2);
+        ECC_CHECK(stats.iterations == (BCHCode<6, 2>::syndrome_count));
+
+        // Reed-Solomon: t errors corrected, t + 1 detected
+        ReedSolomonCode<255, 223, 8, DecoderStats> rs;
+        RS_255_223::DataWord rs_data{};
+        for (auto &symbol : rs_data)
+        {
+            symbol = static_cast<uint32_t>(rng() & 0xFF);
+        }
+        auto rs_word = rs.encode(rs_data);
+        for (size_t e = 0; e < 16; ++e)
+        {
+            rs_word[7 * e] ^= 0x5A;
+        }
+        ECC_CHECK(rs.decode(rs_word).success);
+        rs_word[200] ^= 0x11;
+        ECC_CHECK(!rs.decode(rs_word).success);
+        stats = rs.get_stats().snapshot();
+        ECC_CHECK(stats.decodes == 2 && stats.corrected_words == 1 && stats.corrected_symbols == 16 && stats.failures == 1);
+
+        // LDPC: iterations and flipped bits
+        BasicLDPCCode<DecoderStats> ldpc(QCBaseGraph::ieee80211n_rate_half(), 27);
+        auto ldpc_word = ldpc.encode(std::vector<uint8_t>(ldpc.get_data_length(), 1));
+        auto workspace = ldpc.make_workspace();
+        (void)ldpc.decode(ldpc_word, workspace);
+        ldpc_word[10] ^= 1;
+        const auto ldpc_result = ldpc.decode(ldpc_word, workspace);
+        ECC_CHECK(ldpc_result.success);
+        stats = ldpc.get_stats().snapshot();
+        ECC_CHECK(stats.decodes == 2 && stats.nonzero_syndromes == 1 && stats.corrected_symbols == 1);
+        ECC_CHECK(stats.iterations >= ldpc_result.iterations_used && stats.iterations > 0);
+
+        // Without iterations the input comes back unchanged and still counts as a detected error
+        BasicLDPCCode<DecoderStats> stalled(QCBaseGraph::ieee80211n_rate_half(), 27, 0);
+        auto stalled_workspace = stalled.make_workspace();
+        ECC_CHECK(!stalled.decode(ldpc_word, stalled_workspace).success);
+        ECC_CHECK(stalled.get_stats().snapshot().nonzero_syndromes == 1);
+        ECC_CHECK(stalled.get_stats().snapshot().failures == 1 && stalled.get_stats().snapshot().corrected_symbols == 0);
+
+        // Prometheus text exposition
+        const DecoderStatsSeries series[] = {{{{"code", "rs_255_223"}}, rs.get_stats().snapshot()},
+                                             {{{"code", "ldpc"}, {"note", "a\"b"}}, stats}};
+        std::ostringstream text;
+        write_prometheus(text, series);
+        const std::string exported = text.str();
+        ECC_CHECK(exported.find("# TYPE ecc_decoder_failures_total counter\n") != std::string::npos);
+        ECC_CHECK(exported.find("ecc_decoder_corrected_symbols_total{code=\"rs_255_223\"} 16\n") != std::string::npos);
+        ECC_CHECK(exported.find("ecc_decoder_decodes_total{code=\"ldpc\",note=\"a\\\"b\"} 2\n") != std::string::npos);
+        ECC_CHECK(std::count(exported.begin(), exported.end(), '#') == 2 * static_cast<long>(decoder_event_count));
+
+        // A copy of the policy is a handle on the same counters
+        DecoderStats handle = rs.get_stats();
+        handle.reset();
+        ECC_CHECK(rs.get_stats().snapshot().decodes == 0);
+
+        std::cout << "✓ Decoder stats test passed" << std::endl;
+    }
+
+    /// Stream block codec whose decoder throws, for error propagation
+    struct ThrowingStreamCodec
+    {
+        static constexpr uint32_t family = 99;
+        static constexpr size_t code_length = 8;
+        static constexpr size_t data_length = 8;
+        static constexpr size_t message_bytes = 1;
+        static constexpr size_t block_bytes = 1;
+
+        void encode(std::span<const uint8_t> in, std::span<uint8_t> out) const
+        {
+            std::copy(in.begin(), in.end(), out.begin());
+        }
+        void decode(std::span<const uint8_t>, std::span<uint8_t>, StreamCounters &) const
+        {
+            throw std::runtime_error("decoder failure");
+        }
+    };
+
+    void test_batch_codec_service()
+    {
+        std::cout << "Testing work-stealing batch codec service..." << std::endl;
+
+        WorkStealingPool pool(4);
+        ECC_CHECK(pool.get_thread_count() == 4);
+
+        // Tasks submitted from inside the pool land on the submitter's deque and may be stolen
+        std::atomic<size_t> ran{0};
+        std::vector<std::future<std::vector<std::future<void>>>> spawned;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            spawned.push_back(pool.submit([&]
+                                          {
+                                              std::vector<std::future<void>> inner;
+                                              for (size_t j = 0; j < 16; ++j)
+                                              {
+                                                  inner.push_back(pool.submit([&]
+                                                                              { ran.fetch_add(1); }));
+                                              }
+                                              return inner;
+                                          }));
+        }
+        for (auto &future : spawned)
+        {
+            for (auto &inner : future.get())
+            {
+                inner.get();
+            }
+        }
+        ECC_CHECK(ran.load() == 8 * 16);
+
+        // Groups nested in pool tasks finish even with more waiting tasks than workers: a waiting
+        // worker runs queued tasks itself
+        WorkStealingPool single(1);
+        for (WorkStealingPool *target : {&pool, &single})
+        {
+            std::atomic<size_t> leaves{0};
+            TaskGroup outer(*target);
+            for (size_t i = 0; i < 8; ++i)
+            {
+                outer.run([&]
+                          {
+                              TaskGroup inner(*target);
+                              for (size_t j = 0; j < 16; ++j)
+                              {
+                                  inner.run([&]
+                                            { leaves.fetch_add(1); });
+                              }
+                              inner.wait();
+                          });
+            }
+            outer.wait();
+            ECC_CHECK(leaves.load() == 8 * 16);
+        }
+
+        // wait() rethrows the first exception of the group
+        TaskGroup failing_group(pool);
+        failing_group.run([]
+                    { throw std::runtime_error("task failure"); });
+        failing_group.run([] {});
+        bool rethrown = false;
+        try
+        {
+            failing_group.wait();
+        }
+        catch (const std::runtime_error &)
+        {
+            rethrown = true;
+        }
+        ECC_CHECK(rethrown);
+
+        BatchCodecService service(pool);
+        service.set_tile_bytes(4096);
+
+        using Codec = ReedSolomonStreamCodec<RS_255_223>;
+        const Codec codec;
+        constexpr size_t blocks = 500;
+
+        Xoshiro256 rng(35);
+        std::vector<uint8_t> messages(blocks * Codec::message_bytes);
+        for (auto &byte : messages)
+        {
+            byte = static_cast<uint8_t>(rng());
+        }
+
+        // Tiled encode matches one direct call
+        std::vector<uint8_t> encoded(blocks * Codec::block_bytes);
+        const BatchResult encode_result = service.encode(codec, messages, encoded).get();
+        ECC_CHECK(encode_result.blocks == blocks);
+        ECC_CHECK(encode_result.tiles == (blocks + 7) / 8); // 4096 / (223 + 255) = 8 blocks per tile
+
+        std::vector<uint8_t> direct(encoded.size());
+        codec.encode(messages, direct);
+        ECC_CHECK(encoded == direct);
+
+        // Decode corrects errors, counts them, and reports through a callback
+        for (size_t block = 0; block < blocks; block += 7)
+        {
+            for (size_t e = 0; e < 1 + block % 16; ++e)
+            {
+                encoded[block * Codec::block_bytes + 13 * e] ^= 0xA5;
+            }
+        }
+        encoded[3 * Codec::block_bytes] ^= 0x01;
+        for (size_t e = 0; e < 20; ++e)
+        {
+            encoded[10 * Codec::block_bytes + e] ^= 0xFF; // Beyond t = 16
+        }
+
+        std::vector<uint8_t> decoded(messages.size());
+        std::promise<BatchResult> done;
+        service.decode(codec, encoded, decoded, [&](const BatchResult &result, std::exception_ptr failure)
+                       {
+                           ECC_CHECK(!failure);
+                           done.set_value(result);
+                       });
+        const BatchResult decode_result = done.get_future().get();
+        ECC_CHECK(decode_result.blocks == blocks);
+        ECC_CHECK(decode_result.failed_blocks == 1);
+        ECC_CHECK(decode_result.corrected_blocks == 72 + 1); // Every 7th block and block 3
+        for (size_t block = 0; block < blocks; ++block)
+        {
+            if (block != 10)
+            {
+                ECC_CHECK(std::equal(decoded.begin() + block * Codec::message_bytes,
+                                  decoded.begin() + (block + 1) * Codec::message_bytes,
+                                  messages.begin() + block * Codec::message_bytes));
+            }
+        }
+
+        // Empty jobs complete on a pool thread, so a caller holding a lock the callback takes cannot
+        // deadlock; mismatched buffers are rejected before scheduling
+        ECC_CHECK(service.decode(codec, std::span<const uint8_t>(), std::span<uint8_t>()).get().tiles == 0);
+        {
+            std::mutex caller_mutex;
+            std::promise<std::thread::id> empty_done;
+            {
+                std::lock_guard<std::mutex> lock(caller_mutex);
+                service.encode(codec, std::span<const uint8_t>(), std::span<uint8_t>(),
+                               [&](const BatchResult &, std::exception_ptr)
+                               {
+                                   std::lock_guard<std::mutex> callback_lock(caller_mutex);
+                                   empty_done.set_value(std::this_thread::get_id());
+                               });
+            }
+            ECC_CHECK(empty_done.get_future().get() != std::this_thread::get_id());
+        }
+        bool threw = false;
+        try
+        {
+            (void)service.encode(codec, messages, std::span<uint8_t>(encoded).first(10));
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        ECC_CHECK(threw);
+
+        // A tile's exception reaches the future
+        const ThrowingStreamCodec throwing;
+        std::vector<uint8_t> bytes(10000);
+        auto failing = service.decode(throwing, bytes, bytes);
+        threw = false;
+        try
+        {
+            (void)failing.get();
+        }
+        catch (const std::runtime_error &)
+        {
+            threw = true;
+        }
+        ECC_CHECK(threw);
+
+        // Destroying a pool runs the tasks still queued
+        {
+            WorkStealingPool own(2);
+            for (size_t i = 0; i < 50; ++i)
+            {
+                own.post([&]
+                         { ran.fetch_add(1); });
+            }
+        }
+        ECC_CHECK(ran.load() == 8 * 16 + 50);
+
+        std::cout << "✓ Batch codec service test passed (" << pool.get_steal_count() << " steals)" << std::endl;
+    }
+
+    void test_spsc_ring()
+    {
+        // Capacity rounds up to a power of two; a full ring refuses pushes, an empty one pops
+        SpscRing<int> ring(5);
+        ECC_CHECK(ring.capacity() == 8 && ring.empty());
+        for (int i = 0; i < 8; ++i)
+        {
+            ECC_CHECK(ring.try_push(i));
+        }
+        ECC_CHECK(!ring.try_push(8) && ring.size() == 8);
+        int value = -1;
+        for (int i = 0; i < 8; ++i)
+        {
+            ECC_CHECK(ring.try_pop(value) && value == i);
+        }
+        ECC_CHECK(!ring.try_pop(value) && ring.empty());
+
+        // Items cross threads in order while the indices wrap many times
+        constexpr int count = 200000;
+        SpscRing<int> shared(16);
+        std::thread producer([&]
+                             {
+                                 for (int i = 0; i < count; ++i)
+                                 {
+                                     while (!shared.try_push(i))
+                                     {
+                                         std::this_thread::yield();
+                                     }
+                                 } });
+        long long sum = 0;
+        for (int expected = 0; expected < count; ++expected)
+        {
+            while (!shared.try_pop(value))
+            {
+                std::this_thread::yield();
+            }
+            ECC_CHECK(value == expected);
+            sum += value;
+        }
+        producer.join();
+        ECC_CHECK(sum == static_cast<long long>(count) * (count - 1) / 2);
+
+        bool threw = false;
+        try
+        {
+            SpscRing<int> empty(0);
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        ECC_CHECK(threw);
+
+        std::cout << "✓ SPSC ring test passed" << std::endl;
+    }
+
+    void test_concatenated_code()
+    {
+        std::cout << "Testing concatenated RS + inner code pipeline..." << std::endl;
+
+        using Outer = ReedSolomonCode<255, 223>;
+        std::mt19937 rng(41);
+        auto random_bytes = [&](size_t count)
+        {
+            std::vector<uint8_t> bytes(count);
+            for (auto &byte : bytes)
+            {
+                byte = static_cast<uint8_t>(rng());
+            }
+            return bytes;
+        };
+
+        // BCH(63,51) inner: scattered bit errors are cleaned up by the inner code, the rest by RS
+        ConcatenatedCode<Outer, BCHInnerCode<BCHCode<6, 2>>> bch_code(BCHInnerCode<BCHCode<6, 2>>{}, 4);
+        ECC_CHECK(bch_code.message_bytes() == 4 * 223);
+        ECC_CHECK(bch_code.inner_blocks() == (4 * 255 * 8 + 50) / 51);
+        ECC_CHECK(bch_code.channel_bits() == bch_code.inner_blocks() * 63);
+
+        auto workspace = bch_code.make_workspace();
+        const auto message = random_bytes(bch_code.message_bytes());
+        std::vector<uint8_t> channel(bch_code.channel_bits());
+        bch_code.encode(message, channel, workspace);
+
+        std::vector<uint8_t> decoded(message.size());
+        auto clean = bch_code.decode(channel, decoded, workspace);
+        ECC_CHECK(decoded == message);
+        ECC_CHECK(clean.inner_failures == 0 && clean.corrected_symbols == 0 && clean.outer_failures == 0);
+
+        std::bernoulli_distribution flip(0.005);
+        auto noisy = channel;
+        for (auto &bit : noisy)
+        {
+            bit ^= flip(rng) ? 1 : 0;
+        }
+        auto result = bch_code.decode(noisy, decoded, workspace);
+        ECC_CHECK(decoded == message && result.outer_failures == 0);
+
+        // LDPC inner: three destroyed inner blocks fail their checks and become RS erasures, which
+        // corrects more symbols per codeword than errors-only decoding could
+        LDPCInnerCode<> inner(LDPCCode(QCBaseGraph::ieee80211n_rate_half(), 27, 20));
+        ConcatenatedCode<Outer, LDPCInnerCode<>> ldpc_code(inner, 4);
+        auto ldpc_workspace = ldpc_code.make_workspace();
+        std::vector<uint8_t> ldpc_channel(ldpc_code.channel_bits());
+        ldpc_code.encode(message, ldpc_channel, ldpc_workspace);
+
+        for (size_t i = 5 * 648; i < 8 * 648; ++i)
+        {
+            ldpc_channel[i] = rng() % 2;
+        }
+        result = ldpc_code.decode(ldpc_channel, decoded, ldpc_workspace);
+        ECC_CHECK(decoded == message);
+        ECC_CHECK(result.inner_failures == 3 && result.outer_failures == 0);
+        ECC_CHECK(result.erased_symbols > 4 * Outer::error_correction_capability);
+        ECC_CHECK(result.corrected_symbols > 4 * Outer::error_correction_capability);
+
+        // Pipelined multi-frame decode matches frame-by-frame decoding
+        constexpr size_t frames = 6;
+        const auto messages = random_bytes(frames * bch_code.message_bytes());
+        std::vector<uint8_t> stream(frames * bch_code.channel_bits());
+        bch_code.encode_frames(messages, stream);
+        std::bernoulli_distribution heavy(0.02);
+        for (auto &bit : stream)
+        {
+            bit ^= heavy(rng) ? 1 : 0;
+        }
+
+        std::vector<uint8_t> serial(messages.size());
+        ConcatenatedDecodeResult serial_counts;
+        for (size_t f = 0; f < frames; ++f)
+        {
+            serial_counts.merge(bch_code.decode(std::span<const uint8_t>(stream).subspan(f * bch_code.channel_bits(), bch_code.channel_bits()),
+                                                std::span<uint8_t>(serial).subspan(f * bch_code.message_bytes(), bch_code.message_bytes()),
+                                                workspace));
+        }
+        std::vector<uint8_t> pipelined(messages.size());
+        const auto pipelined_counts = bch_code.decode_frames(stream, pipelined);
+        ECC_CHECK(pipelined == serial);
+        ECC_CHECK(pipelined_counts.frames == frames && pipelined_counts.inner_failures == serial_counts.inner_failures);
+        ECC_CHECK(pipelined_counts.corrected_symbols == serial_counts.corrected_symbols);
+        ECC_CHECK(pipelined_counts.outer_failures == serial_counts.outer_failures);
+        ECC_CHECK(serial_counts.inner_failures > 0);
+
+        bool threw = false;
+        try
+        {
+            (void)bch_code.decode_frames(std::span<const uint8_t>(stream).first(10), pipelined);
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        ECC_CHECK(threw);
+
+        std::cout << "✓ Concatenated code test passed (" << result.erased_symbols << " erasures filled, "
+                  << serial_counts.inner_failures << " inner failures over " << frames << " frames)" << std::endl;
+    }
+
+    void test_sweep_shards()
+    {
+        std::cout << "Testing sharded SNR sweep files..." << std::endl;
+
+        using benchmark::ShardHeader;
+        using benchmark::ShardRecord;
+
+        // Fixed-size blocks round-trip every field, and foreign bytes are rejected
+        ShardRecord record;
+        record.snr_db = 3.5;
+        record.seed = 0x0123456789ABCDEFull;
+        record.trials = 1000;
+        record.bit_errors = 17;
+        record.weighted_bit_errors = 0.375;
+        record.block_errors = 9;
+        record.ber_sum = 2.5;
+        record.ber_sum_squares = 0.75;
+        record.ber_events = 12;
+        record.bler_sum = 8.25;
+        record.bler_sum_squares = 7.5;
+        record.bler_events = 9;
+        record.elapsed_seconds = 0.125;
+        ShardRecord decoded_record;
+        ECC_CHECK(ShardRecord::decode(record.encode(), decoded_record) && decoded_record == record);
+        auto record_bytes = record.encode();
+        record_bytes[4] = 2; // Version 2 (no weighted errors)
+        ECC_CHECK(!ShardRecord::decode(record_bytes, decoded_record));
+
+        ShardHeader header{"RS(255,223)", 5000, true, 0.0625, 0.99};
+        ShardHeader decoded_header;
+        ECC_CHECK(ShardHeader::decode(header.encode(), decoded_header) && decoded_header == header);
+        ECC_CHECK(!ShardHeader::decode(std::array<char, ShardHeader::size>{}, decoded_header));
+
+        const auto directory = std::filesystem::temp_directory_path() / "ecc_sweep_shard_test";
+        std::filesystem::remove_all(directory);
+
+        benchmark::BERAnalysisConfig config;
+        config.snr_min_db = 4.0;
+        config.snr_max_db = 4.0;
+        config.trials_per_seed = 200;
+        config.save_to_csv = false;
+        config.output_directory = directory.string() + "/";
+        benchmark::BERAnalyzer analyzer(config);
+
+        using Code = HammingCode<7, 4>;
+        const std::string name = "Hamming(7,4)";
+        const auto plan = analyzer.plan_sweep(name, 4, 2);
+        ECC_CHECK(plan.size() == 2);
+        WorkStealingPool pool(2);
+        analyzer.run_sweep_shards<Code>(plan, pool);
+        const auto reference = analyzer.merge_sweep_shards<Code>(name);
+        ECC_CHECK(reference.block_counts.size() == 1 && reference.block_counts[0] == 4 * config.trials_per_seed);
+        ECC_CHECK(reference.error_counts[0] > 0 && reference.throughput_values[0] > 0.0);
+
+        // A record torn by a crash is cut off on resume and its seed run again
+        const auto first_shard = directory / "Hamming_7_4__snr4000_seeds0-2.part";
+        const auto full_size = ShardHeader::size + 2 * ShardRecord::size;
+        ECC_CHECK(std::filesystem::file_size(first_shard) == full_size);
+        std::filesystem::resize_file(first_shard, ShardHeader::size + ShardRecord::size + 40);
+        analyzer.run_sweep_shards<Code>(plan);
+        ECC_CHECK(std::filesystem::file_size(first_shard) == full_size);
+        auto merged = analyzer.merge_sweep_shards<Code>(name);
+        ECC_CHECK(merged.block_counts == reference.block_counts && merged.error_counts == reference.error_counts);
+        ECC_CHECK(merged.ber_values == reference.ber_values && merged.bler_values == reference.bler_values);
+
+        // Overlapping shards: each (SNR, seed) counts once
+        analyzer.run_sweep_shards<Code>({benchmark::SweepShard{name, 4.0, 1, 2}});
+        merged = analyzer.merge_sweep_shards<Code>(name);
+        ECC_CHECK(merged.block_counts == reference.block_counts && merged.ber_values == reference.ber_values);
+
+        // Files written under another configuration are neither resumed nor merged
+        auto expect_rejected = [&](const benchmark::BERAnalysisConfig &other)
+        {
+            benchmark::BERAnalyzer mismatched(other);
+            bool threw = false;
+            try
+            {
+                mismatched.run_sweep_shards<Code>(plan);
+            }
+            catch (const std::runtime_error &)
+            {
+                threw = true;
+            }
+            ECC_CHECK(threw);
+
+            threw = false;
+            try
+            {
+                (void)mismatched.merge_sweep_shards<Code>(name);
+            }
+            catch (const std::runtime_error &)
+            {
+                threw = true;
+            }
+            ECC_CHECK(threw);
+        };
+        auto other = config;
+        other.trials_per_seed = 100;
+        expect_rejected(other);
+        other = config;
+        other.importance_sampling = true;
+        expect_rejected(other);
+        other = config;
+        other.confidence_level = 0.99;
+        expect_rejected(other);
+        ECC_CHECK(std::filesystem::file_size(first_shard) == full_size);
+
+        std::filesystem::remove_all(directory);
+
+        std::cout << "✓ Sharded SNR sweep test passed" << std::endl;
+    }
+
+    void test_rate_estimation()
+    {
+        std::cout << "Testing rate estimators and importance sampling..." << std::endl;
+
+        ECC_CHECK(std::abs(benchmark::normal_quantile(0.975) - 1.959963985) < 1e-6);
+        ECC_CHECK(std::abs(benchmark::normal_quantile(0.995) - 2.575829304) < 1e-6);
+        ECC_CHECK(std::abs(benchmark::normal_quantile(0.5)) < 1e-9);
+
+        // 95% intervals of a Bernoulli(0.05) mean cover it in about 95% of runs
+        constexpr double p = 0.05;
+        constexpr size_t runs = 400;
+        Xoshiro256 rng(2024, 0);
+        std::bernoulli_distribution event(p);
+        size_t covered = 0;
+        for (size_t run = 0; run < runs; ++run)
+        {
+            benchmark::RateEstimator estimator;
+            for (size_t trial = 0; trial < 2000; ++trial)
+            {
+                estimator.add(event(rng) ? 1.0 : 0.0);
+            }
+            const auto interval = estimator.interval(0.95);
+            covered += interval.low <= p && p <= interval.high;
+        }
+        ECC_CHECK(covered >= 0.92 * runs && covered <= 0.98 * runs);
+
+        // With no events the upper end is the exact zero-event bound
+        benchmark::RateEstimator empty;
+        for (size_t trial = 0; trial < 100; ++trial)
+        {
+            empty.add(0.0);
+        }
+        ECC_CHECK(std::abs(empty.interval(0.95).high + std::log(0.05) / 100) < 1e-12);
+
+        // Importance sampling estimates agree with plain Monte Carlo at a moderate SNR
+        using Code = HammingCode<7, 4>;
+        const std::string name = "Hamming(7,4)";
+        const auto directory = std::filesystem::temp_directory_path() / "ecc_importance_test";
+        std::filesystem::remove_all(directory);
+
+        benchmark::BERAnalysisConfig config;
+        config.snr_min_db = 6.0;
+        config.snr_max_db = 6.0;
+        config.trials_per_seed = 20000;
+        config.save_to_csv = false;
+        config.output_directory = (directory / "plain").string() + "/";
+        benchmark::BERAnalyzer plain(config);
+        WorkStealingPool pool(4);
+        plain.run_sweep_shards<Code>(plain.plan_sweep(name, 4, 1), pool);
+        const auto mc = plain.merge_sweep_shards<Code>(name);
+
+        config.importance_sampling = true;
+        config.output_directory = (directory / "weighted").string() + "/";
+        benchmark::BERAnalyzer weighted(config);
+        weighted.run_sweep_shards<Code>(weighted.plan_sweep(name, 4, 1), pool);
+        const auto is = weighted.merge_sweep_shards<Code>(name);
+
+        auto agree = [](double a, const benchmark::ConfidenceInterval &a_interval, double b,
+                        const benchmark::ConfidenceInterval &b_interval)
+        {
+            // Half-widths are 1.96 sigma; allow 4 sigma of the difference
+            const double sigma_a = (a_interval.high - a_interval.low) / (2 * 1.96);
+            const double sigma_b = (b_interval.high - b_interval.low) / (2 * 1.96);
+            return std::abs(a - b) <= 4.0 * std::sqrt(sigma_a * sigma_a + sigma_b * sigma_b);
+        };
+        ECC_CHECK(mc.block_counts == is.block_counts && mc.bler_values[0] > 0.0);
+        ECC_CHECK(agree(mc.ber_values[0], mc.ber_intervals[0], is.ber_values[0], is.ber_intervals[0]));
+        ECC_CHECK(agree(mc.bler_values[0], mc.bler_intervals[0], is.bler_values[0], is.bler_intervals[0]));
+
+        // Error counts: plain MC mass equals the draws; under IS the mass carries the BER and the
+        // biased draws are far more numerous
+        ECC_CHECK(mc.error_mass[0] == static_cast<double>(mc.error_counts[0]));
+        const double bits = static_cast<double>(is.block_counts[0] * Code::code_length);
+        ECC_CHECK(std::abs(is.error_mass[0] - is.ber_values[0] * bits) <= 1e-9 * is.error_mass[0]);
+        ECC_CHECK(is.error_counts[0] > 2 * is.error_mass[0]);
+
+        std::filesystem::remove_all(directory);
+
+        std::cout << "✓ Rate estimation test passed" << std::endl;
+    }
+
+    void test_pipelined_sweep()
+    {
+        std::cout << "Testing pipelined BER simulation..." << std::endl;
+
+        // The same seeds give the same counts whether the trials run serially or through the
+        // stage threads, including a stop in the middle of a batch and importance weights
+        using Code = HammingCode<7, 4>;
+        for (bool importance : {false, true})
+        {
+            benchmark::BERAnalysisConfig config;
+            config.snr_min_db = 2.0;
+            config.snr_max_db = 5.0;
+            config.snr_step_db = 3.0;
+            config.iterations_per_point = 3000;
+            config.min_errors = 200;
+            config.max_iterations = 50000;
+            config.target_relative_error = importance ? 0.2 : 0.0;
+            config.importance_sampling = importance;
+            config.pipeline_batch_size = 97;
+            config.pipeline_depth = 3;
+            config.save_to_csv = false;
+
+            benchmark::BERAnalyzer serial(config);
+            const auto expected = serial.analyze_code<Code>("Hamming(7,4)");
+            config.pipelined = true;
+            benchmark::BERAnalyzer pipelined(config);
+            const auto actual = pipelined.analyze_code<Code>("Hamming(7,4)");
+
+            ECC_CHECK(expected.block_counts.size() == 2);
+            ECC_CHECK(actual.block_counts == expected.block_counts);
+            ECC_CHECK(actual.error_counts == expected.error_counts);
+            ECC_CHECK(actual.ber_values == expected.ber_values && actual.bler_values == expected.bler_values);
+            ECC_CHECK(expected.block_counts[0] % config.pipeline_batch_size != 0);
+        }
+
+        std::cout << "✓ Pipelined BER simulation test passed" << std::endl;
+    }
+
     void test_performance()
     {
-        std::cout << "Performance tests placeholder\n";
+        std::cout << "=== Performance Analyzer Tests ===" << std::endl;
+
+        test_rng_streams();
+        test_parallel_monte_carlo();
+        test_batched_timing();
+        test_in_place_channels();
+        test_geometric_skip_sampling();
+        test_gaussian_noise();
+        test_packed_codewords();
+        test_exhaustive_patterns();
+        test_simd_dispatch();
+        test_decoder_stats();
+        test_batch_codec_service();
+        test_spsc_ring();
+        test_concatenated_code();
+        test_sweep_shards();
+        test_rate_estimation();
+        test_pipelined_sweep();
+
+        std::cout << "\n🎉 All performance analyzer tests passed successfully!" << std::endl;
     }
 
 }